@@ -0,0 +1,248 @@
+/*
+ * Bar graph kernel benchmark
+ *
+ * Times the bar graph gauge inner loops (full-history redraw, per-column value
+ * mapping) with the lookup table and memset fills against the float / per-pixel
+ * reference, across the canvas sizes the power monitor actually creates, and
+ * checks that both paths produce identical pixels.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make bar_graph_kernels_bench
+ */
+#include "displayModules/shared/gauges/bar_graph_gauge/bar_graph_kernels.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 20000
+#define BAR_WIDTH 2
+#define BAR_GAP 3
+#define MAX_BARS 64
+
+// Canvas draw areas (cached_draw_width x cached_draw_height) as logged on the Pi
+typedef struct {
+	const char *name;
+	int width;
+	int height;
+	bool bipolar;
+	float baseline, min, max;
+} bench_gauge_t;
+
+static const bench_gauge_t gauges[] = {
+	{ "detail voltage (bipolar)",   229, 92,  true,  12.6f, 10.0f, 15.0f },
+	{ "detail solar (positive)",    229, 92,  false, 0.0f,  0.0f,  25.0f },
+	{ "grid voltage (bipolar)",     142, 58,  true,  12.6f, 10.0f, 15.0f },
+	{ "grid power (bipolar)",       142, 58,  true,  0.0f, -300.0f, 600.0f },
+	{ "single value (bipolar)",     226, 170, true,  0.0f, -20.0f, 50.0f },
+};
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void fill_history(float *values, int count, const bench_gauge_t *g)
+{
+	for (int i = 0; i < count; i++) {
+
+		// Sweep past both ends of the range so clamping is exercised; a few empty slots
+		float t = (float)i / (float)(count - 1);
+		values[i] = (i % 17 == 5) ? NAN : g->min - 1.0f + t * (g->max - g->min + 2.0f);
+	}
+}
+
+// Same mapping the gauge caches in configure_advanced (float scales + lookup table)
+static void build_map(bar_graph_kernel_map_t *map, const bench_gauge_t *g)
+{
+	int top_y = 2;
+	int h = g->height - 5 - top_y + 1;
+
+	bar_graph_kernel_map_init(map, g->bipolar, g->baseline, g->min, g->max, top_y, h);
+	bar_graph_kernel_map_build_lut(map);
+}
+
+static bool spans_equal(bar_graph_span_t a, bar_graph_span_t b)
+{
+	return a.y_start == b.y_start && a.y_end == b.y_end;
+}
+
+static bool check_value(const bar_graph_kernel_map_t *map, float v)
+{
+	bar_graph_span_t expected;
+	bar_graph_kernel_map_values_scalar(map, &v, 1, &expected);
+	return spans_equal(bar_graph_kernel_map_value(map, v), expected);
+}
+
+// Every lookup answer must match the float path: a dense sweep over (and past) the range,
+// plus every representable float within 64 ulps of each bucket threshold
+static int validate_lut(const bar_graph_kernel_map_t *map, const char *name)
+{
+	int mismatches = 0;
+	float lo = map->min_value - 1.0f;
+	float hi = map->max_value + 1.0f;
+	const int sweep = 1000000;
+
+	for (int i = 0; i <= sweep && mismatches < 10; i++) {
+
+		float v = lo + (hi - lo) * (float)i / (float)sweep;
+		if (!check_value(map, v)) {
+
+			printf("[E] %s: lookup differs from float path at %.9g\n", name, v);
+			mismatches++;
+		}
+	}
+
+	for (int e = 0; e < map->lut_count && mismatches < 10; e++) {
+
+		float t = map->lut[e].threshold;
+		if (!isfinite(t)) continue;
+
+		float v = t;
+		for (int k = 0; k < 64; k++) v = nextafterf(v, -INFINITY);
+		for (int k = 0; k < 128; k++, v = nextafterf(v, INFINITY)) {
+
+			if (!check_value(map, v)) {
+
+				printf("[E] %s: lookup differs from float path at %.9g (bucket %d)\n", name, v, e);
+				mismatches++;
+				break;
+			}
+		}
+	}
+
+	if (!check_value(map, NAN)) mismatches++;
+
+	return mismatches;
+}
+
+// Full-history redraw, as bar_graph_gauge_draw_all_data_snapshot() does it
+static void redraw(lv_color_t *buf, const bench_gauge_t *g, const bar_graph_kernel_map_t *map, const float *values, int bars, bool reference)
+{
+	const lv_color_t black = lv_color_hex(0x000000);
+	const lv_color_t bar = lv_color_hex(0xF6E7D2);
+	int top_y = map->top_y;
+	int h = map->h;
+	bar_graph_span_t spans[MAX_BARS];
+
+	if (reference) {
+
+		bar_graph_kernel_fill_rect_scalar(buf, g->width, 0, g->width, top_y, top_y + h, black);
+		bar_graph_kernel_map_values_scalar(map, values, bars, spans);
+	} else {
+
+		bar_graph_kernel_fill_rect(buf, g->width, 0, g->width, top_y, top_y + h, black);
+		bar_graph_kernel_map_values(map, values, bars, spans);
+	}
+
+	for (int i = 0; i < bars; i++) {
+
+		int x_start = g->width - BAR_WIDTH - i * (BAR_WIDTH + BAR_GAP);
+		if (reference) {
+
+			bar_graph_kernel_fill_rect_scalar(buf, g->width, x_start, x_start + BAR_WIDTH, spans[i].y_start, spans[i].y_end, bar);
+		} else {
+
+			bar_graph_kernel_fill_rect(buf, g->width, x_start, x_start + BAR_WIDTH, spans[i].y_start, spans[i].y_end, bar);
+		}
+	}
+}
+
+// One value per column, as the 1px scroll path maps its eased bar value
+static volatile int column_sink;
+
+static void map_columns(const bar_graph_kernel_map_t *map, const float *values, int bars, bool reference)
+{
+	int acc = 0;
+	for (int i = 0; i < bars; i++) {
+
+		bar_graph_span_t span;
+		if (reference) {
+
+			bar_graph_kernel_map_values_scalar(map, &values[i], 1, &span);
+		} else {
+
+			span = bar_graph_kernel_map_value(map, values[i]);
+		}
+		acc += span.y_end - span.y_start;
+	}
+	column_sink = acc;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	printf("bar_graph_kernels_bench: %d iterations\n", BENCH_ITERATIONS);
+	printf("%-26s %9s | %-14s %10s %10s %7s\n", "gauge", "size", "kernel", "ref ns", "fast ns", "speedup");
+
+	for (size_t gi = 0; gi < sizeof(gauges) / sizeof(gauges[0]); gi++) {
+
+		const bench_gauge_t *g = &gauges[gi];
+		size_t bytes = (size_t)g->width * g->height * sizeof(lv_color_t);
+		lv_color_t *ref = calloc(1, bytes);
+		lv_color_t *fast = calloc(1, bytes);
+		float values[MAX_BARS];
+		int bars = g->width / (BAR_WIDTH + BAR_GAP);
+		if (bars > MAX_BARS) bars = MAX_BARS;
+
+		bar_graph_kernel_map_t map;
+		build_map(&map, g);
+		fill_history(values, bars, g);
+
+		// Correctness: both paths must agree pixel for pixel
+		if (!map.lut) {
+
+			printf("[W] %s: range over lookup cap, float path only\n", g->name);
+		} else if (validate_lut(&map, g->name) != 0) {
+
+			failures++;
+		}
+
+		redraw(ref, g, &map, values, bars, true);
+		redraw(fast, g, &map, values, bars, false);
+		if (memcmp(ref, fast, bytes) != 0) {
+
+			printf("[E] %s: fast path differs from scalar reference\n", g->name);
+			failures++;
+		}
+
+		struct {
+			const char *name;
+			int kind;
+		} cases[] = { { "redraw", 0 }, { "map column", 1 } };
+
+		for (size_t ci = 0; ci < sizeof(cases) / sizeof(cases[0]); ci++) {
+
+			double t_ns[2];
+			for (int pass = 0; pass < 2; pass++) {
+
+				bool reference = (pass == 0);
+				lv_color_t *buf = reference ? ref : fast;
+				double start = now_ns();
+				for (int it = 0; it < BENCH_ITERATIONS; it++) {
+
+					switch (cases[ci].kind) {
+						case 0: redraw(buf, g, &map, values, bars, reference); break;
+						default: map_columns(&map, values, bars, reference); break;
+					}
+				}
+				t_ns[pass] = (now_ns() - start) / BENCH_ITERATIONS;
+			}
+
+			char size[16];
+			snprintf(size, sizeof(size), "%dx%d", g->width, g->height);
+			printf("%-26s %9s | %-14s %10.0f %10.0f %6.2fx\n",
+				g->name, size, cases[ci].name, t_ns[0], t_ns[1], t_ns[1] > 0 ? t_ns[0] / t_ns[1] : 0.0);
+		}
+
+		bar_graph_kernel_map_release(&map);
+		free(ref);
+		free(fast);
+	}
+
+	return failures ? 1 : 0;
+}
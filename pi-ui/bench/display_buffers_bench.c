@@ -0,0 +1,262 @@
+/*
+ * Display buffer strategy benchmark
+ *
+ * Renders a detail-screen-like scene (six bar graph canvases, a dozen value
+ * labels) through real LVGL with each draw buffer strategy the port supports
+ * (full, direct, partial stripes of several heights, zero-copy texture) and
+ * reports frame time, flushes and bytes uploaded per frame, and draw buffer
+ * memory.
+ *
+ * The flush callback copies each area into a 480x800 shadow frame exactly as
+ * the SDL port uploads into its portrait texture (rotation happens after that,
+ * on compose), and every strategy's final shadow frame must match the full
+ * strategy's pixel for pixel.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make display_buffers_bench
+ * Run on the Pi for representative numbers.
+ */
+#include "lvgl_port_buffers.h"
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HOR_RES 480
+#define VER_RES 800
+#define BYTES_PER_PX 2
+
+#define GAUGE_COUNT 6
+#define GAUGE_W 229
+#define GAUGE_H 92
+#define LABEL_COUNT 12
+
+typedef struct {
+	const char *name;
+	lvgl_port_buffer_config_t config;
+} bench_strategy_t;
+
+static const bench_strategy_t strategies[] = {
+	{ "full",        { LVGL_PORT_BUFFER_FULL,    0 } },
+	{ "direct",      { LVGL_PORT_BUFFER_DIRECT,  0 } },
+	{ "partial:20",  { LVGL_PORT_BUFFER_PARTIAL, 20 } },
+	{ "partial:40",  { LVGL_PORT_BUFFER_PARTIAL, 40 } },
+	{ "partial:80",  { LVGL_PORT_BUFFER_PARTIAL, 80 } },
+	{ "partial:160", { LVGL_PORT_BUFFER_PARTIAL, 160 } },
+	{ "texture",     { LVGL_PORT_BUFFER_TEXTURE, 0 } },   // Shadow frame stands in for the locked texture
+};
+
+typedef enum {
+	SCENARIO_FULL_REDRAW = 0,   // Screen change / modal close: everything invalidated
+	SCENARIO_GAUGE_SCROLL,      // Steady state: every gauge scrolls its ink band by 1px
+	SCENARIO_LABEL_TICK,        // Value labels change, nothing else
+	SCENARIO_COUNT
+} bench_scenario_t;
+
+static const char *scenario_names[SCENARIO_COUNT] = { "full redraw", "gauge scroll", "label tick" };
+static const int scenario_iterations[SCENARIO_COUNT] = { 100, 500, 500 };
+
+// Shadow of the SDL portrait texture
+static uint8_t shadow[VER_RES][HOR_RES * BYTES_PER_PX];
+static uint8_t reference[VER_RES][HOR_RES * BYTES_PER_PX];
+
+static lvgl_port_buffers_t *active_buffers;
+static uint32_t flush_count;
+static uint64_t flush_bytes;
+
+static uint8_t gauge_pixels[GAUGE_COUNT][GAUGE_W * GAUGE_H * 3];
+static lv_obj_t *gauges[GAUGE_COUNT];
+static lv_obj_t *labels[LABEL_COUNT];
+
+static double now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static uint32_t tick_cb(void)
+{
+	return (uint32_t)now_ms();
+}
+
+// Same upload the SDL port does with SDL_UpdateTexture(texture, &rect, pixels, pitch)
+static void bench_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+	flush_count++;
+
+	// Zero-copy: LVGL rendered straight into the shadow frame
+	if (active_buffers->external) {
+
+		lv_display_flush_ready(disp);
+		return;
+	}
+
+	int pitch;
+	const uint8_t *src = lvgl_port_buffers_area_pixels(active_buffers, disp, area, px_map, &pitch);
+	size_t row_bytes = (size_t)lv_area_get_width(area) * BYTES_PER_PX;
+
+	for (int32_t y = area->y1; y <= area->y2; y++) {
+
+		memcpy(&shadow[y][area->x1 * BYTES_PER_PX], src, row_bytes);
+		src += pitch;
+	}
+
+	flush_bytes += row_bytes * lv_area_get_height(area);
+	lv_display_flush_ready(disp);
+}
+
+// Bars every 5px (2px bar, 3px gap) with heights varying by column and scroll phase
+static void draw_gauge(int index, int phase)
+{
+	uint8_t *buf = gauge_pixels[index];
+	memset(buf, 0, sizeof(gauge_pixels[index]));
+
+	for (int x = 0; x < GAUGE_W; x++) {
+
+		if ((x + phase) % 5 >= 2) continue;
+		int bar = (x + phase) / 5 + index * 7;
+		int height = 10 + (bar * 37) % (GAUGE_H - 20);
+		for (int y = GAUGE_H - 4 - height; y < GAUGE_H - 4; y++) {
+
+			uint8_t *px = &buf[(y * GAUGE_W + x) * 3];
+			px[0] = 0xD2;
+			px[1] = 0xE7;
+			px[2] = 0xF6;
+		}
+	}
+}
+
+static void build_scene(lv_obj_t *screen)
+{
+	lv_obj_set_style_bg_color(screen, lv_color_hex(0x000000), 0);
+	lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+
+	for (int i = 0; i < GAUGE_COUNT; i++) {
+
+		draw_gauge(i, 0);
+		gauges[i] = lv_canvas_create(screen);
+		lv_canvas_set_buffer(gauges[i], gauge_pixels[i], GAUGE_W, GAUGE_H, LV_COLOR_FORMAT_RGB888);
+		lv_obj_set_pos(gauges[i], 8 + (i % 2) * (GAUGE_W + 6), 120 + (i / 2) * (GAUGE_H + 90));
+	}
+
+	for (int i = 0; i < LABEL_COUNT; i++) {
+
+		labels[i] = lv_label_create(screen);
+		lv_obj_set_style_text_font(labels[i], &lv_font_montserrat_16, 0);
+		lv_obj_set_style_text_color(labels[i], lv_color_hex(0xFFFFFF), 0);
+		lv_label_set_text(labels[i], "0.00");
+		lv_obj_set_pos(labels[i], 20 + (i % 2) * 240, 130 + GAUGE_H + (i / 2) * 50);
+	}
+}
+
+static void step(bench_scenario_t scenario, lv_obj_t *screen, int iteration)
+{
+	switch (scenario) {
+		case SCENARIO_FULL_REDRAW:
+			lv_obj_invalidate(screen);
+			break;
+
+		case SCENARIO_GAUGE_SCROLL:
+			for (int i = 0; i < GAUGE_COUNT; i++) {
+
+				// Rows that hold ink, across the drawn width (what the gauge invalidates)
+				draw_gauge(i, iteration + 1);
+				lv_area_t area;
+				lv_obj_get_coords(gauges[i], &area);
+				area.y1 += 6;
+				area.y2 -= 3;
+				lv_obj_invalidate_area(gauges[i], &area);
+			}
+			break;
+
+		default: {
+			char text[16];
+			for (int i = 0; i < 4; i++) {
+
+				snprintf(text, sizeof(text), "%d.%02d", 12 + (iteration + i) % 3, (iteration * 7 + i * 13) % 100);
+				lv_label_set_text(labels[(iteration + i) % LABEL_COUNT], text);
+			}
+			break;
+		}
+	}
+}
+
+static int run_strategy(const bench_strategy_t *strategy, bool is_reference)
+{
+	lv_display_t *disp = lv_display_create(HOR_RES, VER_RES);
+	lv_display_set_flush_cb(disp, bench_flush);
+	lv_display_set_default(disp);
+
+	lvgl_port_buffers_t buffers;
+	bool created = (strategy->config.mode == LVGL_PORT_BUFFER_TEXTURE)
+		? lvgl_port_buffers_create_external(disp, shadow, sizeof(shadow[0]), &buffers)
+		: lvgl_port_buffers_create(disp, &strategy->config, &buffers);
+	if (!created) {
+
+		lv_display_delete(disp);
+		return 1;
+	}
+	active_buffers = &buffers;
+
+	memset(shadow, 0, sizeof(shadow));
+	lv_obj_t *screen = lv_display_get_screen_active(disp);
+	build_scene(screen);
+	lv_refr_now(disp);
+
+	for (int s = 0; s < SCENARIO_COUNT; s++) {
+
+		int iterations = scenario_iterations[s];
+		flush_count = 0;
+		flush_bytes = 0;
+
+		double start = now_ms();
+		for (int it = 0; it < iterations; it++) {
+
+			step((bench_scenario_t)s, screen, it);
+			lv_refr_now(disp);
+		}
+		double frame_ms = (now_ms() - start) / iterations;
+
+		// Draw buffer memory (the texture strategy has none of its own)
+		float mem_kb = buffers.external ? 0.0f : 2.0f * buffers.buf_size / 1024.0f;
+		printf("%-12s %9.1f | %-13s %9.3f %9.1f %10.1f\n",
+			strategy->name, mem_kb, scenario_names[s],
+			frame_ms, (double)flush_count / iterations, flush_bytes / 1024.0 / iterations);
+	}
+
+	int failures = 0;
+	if (is_reference) {
+
+		memcpy(reference, shadow, sizeof(reference));
+	} else if (memcmp(reference, shadow, sizeof(reference)) != 0) {
+
+		printf("[E] %s: final frame differs from full-frame reference\n", strategy->name);
+		failures++;
+	}
+
+	active_buffers = NULL;
+	lv_display_delete(disp);
+	lvgl_port_buffers_destroy(&buffers);
+	return failures;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	lv_init();
+	lv_tick_set_cb(tick_cb);
+
+	printf("display_buffers_bench: %dx%d RGB565, %d gauges, %d labels\n", HOR_RES, VER_RES, GAUGE_COUNT, LABEL_COUNT);
+	printf("%-12s %9s | %-13s %9s %9s %10s\n", "strategy", "mem KB", "scenario", "ms/frame", "flushes", "KB/frame");
+
+	for (size_t i = 0; i < sizeof(strategies) / sizeof(strategies[0]); i++) {
+
+		failures += run_strategy(&strategies[i], i == 0);
+	}
+
+	lv_deinit();
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * Software draw unit benchmark
+ *
+ * Renders a detail-screen-like scene (header with back button and title, three
+ * full-width bar graph canvases, a bordered sensor data section, setting
+ * buttons and a status box) through real LVGL with the pthread OS layer and
+ * reports frame time for a screen open (full redraw), a gauge scroll and a
+ * label tick, using the port's default draw buffers (partial, 80 lines).
+ *
+ * The number of draw units is fixed at compile time (LV_DRAW_SW_DRAW_UNIT_CNT),
+ * so CMake builds one binary per count: draw_units_bench_1, _2 and _4. Each
+ * prints a checksum of its final frame; all counts must print the same one.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make run_draw_units_bench
+ * Run on the Pi for representative numbers.
+ */
+#include "lvgl_port_buffers.h"
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HOR_RES 480
+#define VER_RES 800
+#define BYTES_PER_PX 2
+
+#define GAUGE_COUNT 3
+#define GAUGE_W 440
+#define GAUGE_H 110
+#define VALUE_COUNT 8
+#define BUTTON_COUNT 3
+
+typedef enum {
+	SCENARIO_SCREEN_OPEN = 0,   // Detail screen created / modal closed: everything invalidated
+	SCENARIO_GAUGE_SCROLL,      // Steady state: every gauge scrolls by 1px
+	SCENARIO_LABEL_TICK,        // Sensor values change, nothing else
+	SCENARIO_COUNT
+} bench_scenario_t;
+
+static const char *scenario_names[SCENARIO_COUNT] = { "screen open", "gauge scroll", "label tick" };
+static const int scenario_iterations[SCENARIO_COUNT] = { 100, 500, 1000 };
+
+// Shadow of the SDL portrait texture
+static uint8_t shadow[VER_RES][HOR_RES * BYTES_PER_PX];
+
+static lvgl_port_buffers_t buffers;
+
+static uint8_t gauge_pixels[GAUGE_COUNT][GAUGE_W * GAUGE_H * 3];
+static lv_obj_t *gauges[GAUGE_COUNT];
+static lv_obj_t *values[VALUE_COUNT];
+
+static double now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static uint32_t tick_cb(void)
+{
+	return (uint32_t)now_ms();
+}
+
+static void bench_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+	int pitch;
+	const uint8_t *src = lvgl_port_buffers_area_pixels(&buffers, disp, area, px_map, &pitch);
+	size_t row_bytes = (size_t)lv_area_get_width(area) * BYTES_PER_PX;
+
+	for (int32_t y = area->y1; y <= area->y2; y++) {
+
+		memcpy(&shadow[y][area->x1 * BYTES_PER_PX], src, row_bytes);
+		src += pitch;
+	}
+
+	lv_display_flush_ready(disp);
+}
+
+// Bars every 5px (2px bar, 3px gap) with heights varying by column and scroll phase
+static void draw_gauge(int index, int phase)
+{
+	uint8_t *buf = gauge_pixels[index];
+	memset(buf, 0, sizeof(gauge_pixels[index]));
+
+	for (int x = 0; x < GAUGE_W; x++) {
+
+		if ((x + phase) % 5 >= 2) continue;
+		int bar = (x + phase) / 5 + index * 7;
+		int height = 10 + (bar * 37) % (GAUGE_H - 20);
+		for (int y = GAUGE_H - 4 - height; y < GAUGE_H - 4; y++) {
+
+			uint8_t *px = &buf[(y * GAUGE_W + x) * 3];
+			px[0] = 0xD2;
+			px[1] = 0xE7;
+			px[2] = 0xF6;
+		}
+	}
+}
+
+// Bordered, rounded box like the detail screen's sections and buttons
+static lv_obj_t *create_box(lv_obj_t *parent, int32_t x, int32_t y, int32_t w, int32_t h, int32_t border, int32_t radius)
+{
+	lv_obj_t *box = lv_obj_create(parent);
+	lv_obj_remove_style_all(box);
+	lv_obj_set_pos(box, x, y);
+	lv_obj_set_size(box, w, h);
+	lv_obj_set_style_bg_color(box, lv_color_hex(0x101418), 0);
+	lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+	lv_obj_set_style_border_color(box, lv_color_hex(0x3A4450), 0);
+	lv_obj_set_style_border_width(box, border, 0);
+	lv_obj_set_style_radius(box, radius, 0);
+	lv_obj_clear_flag(box, LV_OBJ_FLAG_SCROLLABLE);
+	return box;
+}
+
+static lv_obj_t *create_label(lv_obj_t *parent, const lv_font_t *font, const char *text, int32_t x, int32_t y)
+{
+	lv_obj_t *label = lv_label_create(parent);
+	lv_obj_set_style_text_font(label, font, 0);
+	lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+	lv_label_set_text(label, text);
+	lv_obj_set_pos(label, x, y);
+	return label;
+}
+
+static void build_scene(lv_obj_t *screen)
+{
+	lv_obj_set_style_bg_color(screen, lv_color_hex(0x000000), 0);
+	lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+
+	// Header: back button and title
+	lv_obj_t *back = create_box(screen, 10, 10, 90, 44, 2, 8);
+	create_label(back, &lv_font_montserrat_16, "Back", 22, 12);
+	create_label(screen, &lv_font_montserrat_24, "Starter Battery", 120, 18);
+
+	// Gauges
+	for (int i = 0; i < GAUGE_COUNT; i++) {
+
+		draw_gauge(i, 0);
+		gauges[i] = lv_canvas_create(screen);
+		lv_canvas_set_buffer(gauges[i], gauge_pixels[i], GAUGE_W, GAUGE_H, LV_COLOR_FORMAT_RGB888);
+		lv_obj_set_pos(gauges[i], 20, 70 + i * (GAUGE_H + 10));
+	}
+
+	// Sensor data section: name / value pairs
+	lv_obj_t *section = create_box(screen, 10, 440, 460, 200, 1, 4);
+	for (int i = 0; i < VALUE_COUNT; i++) {
+
+		int32_t x = 12 + (i % 2) * 228;
+		int32_t y = 10 + (i / 2) * 46;
+		create_label(section, &lv_font_montserrat_14, "Voltage", x, y);
+		values[i] = create_label(section, &lv_font_montserrat_16, "12.60 V", x, y + 18);
+	}
+
+	// Setting buttons and status box
+	static const char *button_texts[BUTTON_COUNT] = { "Alerts", "Timeline", "Reset" };
+	for (int i = 0; i < BUTTON_COUNT; i++) {
+
+		lv_obj_t *button = create_box(screen, 10 + i * 156, 654, 148, 56, 2, 8);
+		create_label(button, &lv_font_montserrat_16, button_texts[i], 30, 18);
+	}
+
+	lv_obj_t *status = create_box(screen, 10, 722, 460, 68, 2, 4);
+	create_label(status, &lv_font_montserrat_14, "Connected - updated 0.1 s ago", 14, 24);
+}
+
+static void step(bench_scenario_t scenario, lv_obj_t *screen, int iteration)
+{
+	switch (scenario) {
+		case SCENARIO_SCREEN_OPEN:
+			lv_obj_invalidate(screen);
+			break;
+
+		case SCENARIO_GAUGE_SCROLL:
+			for (int i = 0; i < GAUGE_COUNT; i++) {
+
+				draw_gauge(i, iteration + 1);
+				lv_obj_invalidate(gauges[i]);
+			}
+			break;
+
+		default: {
+			char text[16];
+			for (int i = 0; i < 4; i++) {
+
+				snprintf(text, sizeof(text), "%d.%02d V", 12 + (iteration + i) % 3, (iteration * 7 + i * 13) % 100);
+				lv_label_set_text(values[(iteration + i) % VALUE_COUNT], text);
+			}
+			break;
+		}
+	}
+}
+
+// FNV-1a over the final frame: identical for every draw unit count
+static uint32_t frame_checksum(void)
+{
+	uint32_t hash = 2166136261u;
+	const uint8_t *p = &shadow[0][0];
+	for (size_t i = 0; i < sizeof(shadow); i++) {
+
+		hash ^= p[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+int main(void)
+{
+	lv_init();
+	lv_tick_set_cb(tick_cb);
+
+	lv_display_t *disp = lv_display_create(HOR_RES, VER_RES);
+	lv_display_set_flush_cb(disp, bench_flush);
+	lv_display_set_default(disp);
+
+	lvgl_port_buffer_config_t config = lvgl_port_buffer_config_default();
+	if (!lvgl_port_buffers_create(disp, &config, &buffers)) {
+
+		lv_deinit();
+		return 1;
+	}
+
+	lv_obj_t *screen = lv_display_get_screen_active(disp);
+	build_scene(screen);
+	lv_refr_now(disp);
+
+	printf("draw_units_bench: %d draw unit%s, %dx%d RGB565, partial:%d\n", LV_DRAW_SW_DRAW_UNIT_CNT,
+		LV_DRAW_SW_DRAW_UNIT_CNT > 1 ? "s" : "", HOR_RES, VER_RES, config.partial_lines);
+	printf("%-13s %9s %9s\n", "scenario", "ms/frame", "fps");
+
+	for (int s = 0; s < SCENARIO_COUNT; s++) {
+
+		int iterations = scenario_iterations[s];
+		double start = now_ms();
+		for (int it = 0; it < iterations; it++) {
+
+			step((bench_scenario_t)s, screen, it);
+			lv_refr_now(disp);
+		}
+		double frame_ms = (now_ms() - start) / iterations;
+		printf("%-13s %9.3f %9.1f\n", scenario_names[s], frame_ms, frame_ms > 0 ? 1000.0 / frame_ms : 0.0);
+	}
+
+	printf("frame checksum: %08x\n", frame_checksum());
+
+	lv_display_delete(disp);
+	lvgl_port_buffers_destroy(&buffers);
+	lv_deinit();
+	return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Framebuffer backend benchmark
+ *
+ * Drives the mmap fbdev output (lvgl_port_fbdev) against a memfd of the real
+ * panel geometry (800x480 RGB565, two pages), or a device/file given on the
+ * command line, with the flush patterns LVGL produces: full frames in 80-line
+ * stripes, a gauge scroll (six gauge bands) and a label tick. Reports cost per
+ * frame (rotate + flip + page sync) and checks after every frame that the
+ * shown page, and the page drawn next, both equal the rotated portrait frame.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make fbdev_bench
+ * Run:   ./fbdev_bench [memfd | file:<path> | /dev/fbN]
+ */
+#include "lvgl_port_fbdev.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LVGL_W 480
+#define LVGL_H 800
+#define PANEL_W 800
+#define PANEL_H 480
+
+typedef struct {
+	const char *name;
+	int iterations;
+	int area_count;
+	lv_area_t areas[12];
+} bench_frame_t;
+
+static bench_frame_t frames[] = {
+	{ "full frame (stripes)", 200, 10, {
+		{ 0, 0, 479, 79 }, { 0, 80, 479, 159 }, { 0, 160, 479, 239 }, { 0, 240, 479, 319 },
+		{ 0, 320, 479, 399 }, { 0, 400, 479, 479 }, { 0, 480, 479, 559 }, { 0, 560, 479, 639 },
+		{ 0, 640, 479, 719 }, { 0, 720, 479, 799 } } },
+	{ "gauge scroll", 2000, 6, {
+		{ 8, 126, 236, 208 }, { 243, 126, 471, 208 }, { 8, 308, 236, 390 },
+		{ 243, 308, 471, 390 }, { 8, 490, 236, 572 }, { 243, 490, 471, 572 } } },
+	{ "label tick", 20000, 4, {
+		{ 20, 222, 62, 240 }, { 260, 222, 302, 240 }, { 20, 272, 62, 290 }, { 260, 272, 302, 290 } } },
+};
+
+// The LVGL frame as it stands; flushed areas are cut from it
+static uint16_t portrait[LVGL_H][LVGL_W];
+static uint16_t stripe[LVGL_W * LVGL_H];
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Change the pixels under an area, then flush it the way partial mode does (packed copy)
+static void flush(lvgl_port_fbdev_t *fb, const lv_area_t *a, uint32_t seed)
+{
+	int w = a->x2 - a->x1 + 1;
+	uint16_t *out = stripe;
+	for (int y = a->y1; y <= a->y2; y++) {
+		for (int x = a->x1; x <= a->x2; x++) {
+
+			portrait[y][x] = (uint16_t)((x * 31 + y * 17 + seed * 2654435761u) >> 7);
+			*out++ = portrait[y][x];
+		}
+	}
+	lvgl_port_fbdev_flush_area(fb, a, (const uint8_t *)stripe, w * 2);
+}
+
+static int check_page(const lvgl_port_fbdev_t *fb, const uint8_t *page, const char *what)
+{
+	for (int y = 0; y < LVGL_H; y++) {
+		for (int x = 0; x < LVGL_W; x++) {
+
+			const uint16_t *row = (const uint16_t *)(page + (size_t)x * fb->line_length);
+			if (row[LVGL_H - 1 - y] != portrait[y][x]) {
+
+				printf("[E] %s page: portrait (%d, %d) wrong\n", what, x, y);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *target = argc > 1 ? argv[1] : "memfd";
+	int failures = 0;
+
+	lvgl_port_fbdev_t fb;
+	if (!lvgl_port_fbdev_open(&fb, target, PANEL_W, PANEL_H, LVGL_W, LVGL_H)) return 1;
+	if (!fb.rotate) {
+
+		printf("[E] fbdev_bench expects a landscape panel\n");
+		lvgl_port_fbdev_close(&fb);
+		return 1;
+	}
+
+	printf("fbdev_bench: %s, %d page%s\n", target, fb.pages, fb.pages > 1 ? "s" : "");
+	printf("%-22s %8s | %10s %10s\n", "frame", "areas", "us/frame", "MB/s");
+
+	uint32_t seed = 1;
+	for (size_t fi = 0; fi < sizeof(frames) / sizeof(frames[0]); fi++) {
+
+		bench_frame_t *f = &frames[fi];
+		size_t px = 0;
+		for (int i = 0; i < f->area_count; i++) {
+
+			const lv_area_t *a = &f->areas[i];
+			px += (size_t)(a->x2 - a->x1 + 1) * (a->y2 - a->y1 + 1);
+		}
+
+		// Correctness first: both pages must track the portrait frame
+		for (int it = 0; it < 3 && !failures; it++) {
+
+			for (int i = 0; i < f->area_count; i++) flush(&fb, &f->areas[i], seed++);
+			lvgl_port_fbdev_present(&fb);
+			failures += check_page(&fb, fb.map + (size_t)fb.front * fb.page_size, "shown");
+			failures += check_page(&fb, lvgl_port_fbdev_back_page(&fb), "next");
+		}
+
+		// Timing excludes generating the pixels: each area is packed once and re-flushed unchanged
+		uint16_t *packed[12];
+		for (int i = 0; i < f->area_count; i++) {
+
+			const lv_area_t *a = &f->areas[i];
+			int w = a->x2 - a->x1 + 1;
+			packed[i] = malloc((size_t)w * (a->y2 - a->y1 + 1) * sizeof(uint16_t));
+			for (int y = a->y1; y <= a->y2; y++) {
+				memcpy(packed[i] + (size_t)(y - a->y1) * w, &portrait[y][a->x1], (size_t)w * sizeof(uint16_t));
+			}
+		}
+
+		double total = 0.0;
+		for (int it = 0; it < f->iterations; it++) {
+
+			double start = now_ns();
+			for (int i = 0; i < f->area_count; i++) {
+
+				const lv_area_t *a = &f->areas[i];
+				lvgl_port_fbdev_flush_area(&fb, a, (const uint8_t *)packed[i], (a->x2 - a->x1 + 1) * 2);
+			}
+			lvgl_port_fbdev_present(&fb);
+			total += now_ns() - start;
+		}
+
+		for (int i = 0; i < f->area_count; i++) free(packed[i]);
+
+		double ns = total / f->iterations;
+		printf("%-22s %8d | %10.1f %10.1f\n", f->name, f->area_count, ns / 1e3, px * 2.0 / ns * 1e3);
+	}
+
+	lvgl_port_fbdev_close(&fb);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * Binary font loader check
+ *
+ * Maps a binary font with font_mmap_load() and compares it with the compiled-in font it
+ * was made from: line metrics, then for every letter from U+0020 to U+007F whether the
+ * font has it, its descriptor (advance, box, offsets) and its bitmap bytes. A few digits
+ * are prefetched first and the rest are looked up cold, so both decode paths and their
+ * counters run. Last, a copy of the file marked as compressed must be refused.
+ *
+ * The default fixture, bench/fixtures/noplato_10.bin, was written from
+ * src/fonts/lv_font_noplato_10.c by fonts/c_font_to_bin.py; a font from
+ * fonts/build_bin_fonts.sh can be given instead. Exits non-zero on any mismatch.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make font_mmap_check
+ * Run:   ./font_mmap_check [<noplato_10.bin>]
+ */
+#include "utils/font_mmap.h"
+#include "utils/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FIRST_LETTER 0x20
+#define LAST_LETTER 0x7F
+#define PREFETCHED "0123456789"
+#define COMPRESSION_ID_OFFSET 41    // "head" table header, then bin_head_t.compression_id
+
+static const char *TAG = "font_mmap_check";
+
+// Linked in even with -DPI_UI_FONTS_MMAP=ON, where its header declares the mapped one
+extern const lv_font_t lv_font_noplato_10;
+
+static int mismatches = 0;
+
+static void mismatch(uint32_t letter, const char *what, int mapped, int compiled)
+{
+	LOG_E(TAG, "U+%04X %s: %d mapped, %d compiled in", (unsigned)letter, what, mapped, compiled);
+	mismatches++;
+}
+
+static const uint8_t *glyph_bitmap(const lv_font_t *font, const lv_font_glyph_dsc_t *glyph)
+{
+	const lv_font_fmt_txt_dsc_t *dsc = font->dsc;
+	return dsc->glyph_bitmap + dsc->glyph_dsc[glyph->gid.index].bitmap_index;
+}
+
+// Number of letters the fonts have in common
+static uint32_t compare_fonts(const lv_font_t *mapped, const lv_font_t *compiled)
+{
+	if (mapped->line_height != compiled->line_height) mismatch(0, "line height", mapped->line_height, compiled->line_height);
+	if (mapped->base_line != compiled->base_line) mismatch(0, "base line", mapped->base_line, compiled->base_line);
+	if (mapped->underline_position != compiled->underline_position) {
+
+		mismatch(0, "underline position", mapped->underline_position, compiled->underline_position);
+	}
+
+	uint32_t letters = 0;
+	for (uint32_t letter = FIRST_LETTER; letter <= LAST_LETTER; letter++) {
+
+		lv_font_glyph_dsc_t a;
+		lv_font_glyph_dsc_t b;
+		bool has_a = lv_font_get_glyph_dsc(mapped, &a, letter, 0);
+		bool has_b = lv_font_get_glyph_dsc(compiled, &b, letter, 0);
+		if (has_a != has_b) mismatch(letter, "present", has_a, has_b);
+		if (!has_a || !has_b) continue;
+
+		letters++;
+		if (a.adv_w != b.adv_w) mismatch(letter, "advance", a.adv_w, b.adv_w);
+		if (a.box_w != b.box_w) mismatch(letter, "box width", a.box_w, b.box_w);
+		if (a.box_h != b.box_h) mismatch(letter, "box height", a.box_h, b.box_h);
+		if (a.ofs_x != b.ofs_x) mismatch(letter, "x offset", a.ofs_x, b.ofs_x);
+		if (a.ofs_y != b.ofs_y) mismatch(letter, "y offset", a.ofs_y, b.ofs_y);
+		if (a.box_w != b.box_w || a.box_h != b.box_h || !a.box_w || !a.box_h) continue;
+
+		size_t bytes = ((size_t)a.box_w * a.box_h * ((const lv_font_fmt_txt_dsc_t *)compiled->dsc)->bpp + 7) / 8;
+		const uint8_t *bitmap_a = glyph_bitmap(mapped, &a);
+		const uint8_t *bitmap_b = glyph_bitmap(compiled, &b);
+		for (size_t i = 0; i < bytes; i++) {
+
+			if (bitmap_a[i] != bitmap_b[i]) {
+
+				mismatch(letter, "bitmap byte", bitmap_a[i], bitmap_b[i]);
+				break;
+			}
+		}
+	}
+	return letters;
+}
+
+// A copy of path with the compression id set must not load
+static bool compressed_refused(const char *path)
+{
+	FILE *in = fopen(path, "rb");
+	if (!in) return false;
+
+	static uint8_t data[64 * 1024];
+	size_t size = fread(data, 1, sizeof(data), in);
+	fclose(in);
+	if (size <= COMPRESSION_ID_OFFSET || size == sizeof(data)) return false;
+	data[COMPRESSION_ID_OFFSET] = 1;
+
+	char copy[] = "/tmp/font_mmap_check_XXXXXX";
+	int fd = mkstemp(copy);
+	if (fd < 0) return false;
+	bool written = write(fd, data, size) == (ssize_t)size;
+	close(fd);
+
+	lv_font_t font;
+	bool loaded = written && font_mmap_load(&font, copy);
+	if (loaded) font_mmap_release(&font);
+	unlink(copy);
+	return written && !loaded;
+}
+
+int main(int argc, char **argv)
+{
+	const char *path = argc > 1 ? argv[1] : FONT_MMAP_FIXTURE;
+	lv_init();
+
+	lv_font_t font;
+	if (!font_mmap_load(&font, path)) return 1;
+
+	uint32_t prefetched = font_mmap_prefetch(&font, PREFETCHED);
+	uint32_t letters = compare_fonts(&font, &lv_font_noplato_10);
+
+	font_mmap_stats_t stats;
+	font_mmap_get_stats(&stats);
+	bool counted = prefetched == strlen(PREFETCHED) && stats.glyphs_prefetched == prefetched &&
+		stats.glyphs_prefetched + stats.glyphs_lazy == letters;
+	if (!counted) {
+
+		LOG_E(TAG, "%u letters, %u prefetched (%u counted), %u decoded on lookup", (unsigned)letters,
+			(unsigned)prefetched, (unsigned)stats.glyphs_prefetched, (unsigned)stats.glyphs_lazy);
+	}
+	font_mmap_release(&font);
+
+	bool refused = compressed_refused(path);
+	if (!refused) LOG_E(TAG, "a compressed copy of %s loaded", path);
+
+	bool ok = mismatches == 0 && counted && refused;
+	printf("%s: %u letters, %d mismatches, %u prefetched, %u decoded on lookup, compressed copy %s: %s\n", path,
+		(unsigned)letters, mismatches, (unsigned)stats.glyphs_prefetched, (unsigned)stats.glyphs_lazy,
+		refused ? "refused" : "loaded", ok ? "OK" : "FAILED");
+	return ok ? 0 : 1;
+}
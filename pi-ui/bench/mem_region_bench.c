@@ -0,0 +1,161 @@
+/*
+ * Region allocator benchmark
+ *
+ * Replays screen visits against the region allocator (utils/mem_region.h) and against
+ * malloc: each visit allocates a widget tree worth of blocks (LVGL-like sizes, a few
+ * canvas-sized ones), churns part of it as views and modals come and go, leaves a few
+ * long-lived blocks in the global region, then frees the rest in random order and
+ * resets the screen's region. Reports ns per alloc+free pair, the cost of a reset and
+ * the chunk memory the screen region holds at its peak and after the reset.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make mem_region_bench
+ * Run:   ./mem_region_bench
+ */
+#include "utils/mem_region.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define VISITS 2000
+#define BLOCKS_PER_VISIT 3000
+#define CHURN_PER_VISIT 2000
+#define SURVIVORS_PER_VISIT 4
+#define MAX_SURVIVORS (VISITS * SURVIVORS_PER_VISIT)
+
+static void *blocks[BLOCKS_PER_VISIT];
+static void *survivors[MAX_SURVIVORS];
+static size_t sizes[BLOCKS_PER_VISIT + CHURN_PER_VISIT];
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Mostly object and style sized, 1 in 200 a canvas or icon buffer
+static size_t pick_size(void)
+{
+	int r = rand() % 1000;
+	if (r < 5) return 8 * 1024 + (size_t)(rand() % (64 * 1024));
+	if (r < 600) return 16 + (size_t)(rand() % 64);
+	if (r < 950) return 80 + (size_t)(rand() % 240);
+	return 320 + (size_t)(rand() % 700);
+}
+
+static void shuffle(void **ptrs, int count)
+{
+	for (int i = count - 1; i > 0; i--) {
+
+		int j = rand() % (i + 1);
+		void *tmp = ptrs[i];
+		ptrs[i] = ptrs[j];
+		ptrs[j] = tmp;
+	}
+}
+
+// One pass over all visits; region NULL = malloc/free
+static double run(mem_region_t *region, double *reset_ns, size_t *peak_chunks, size_t *kept_chunks)
+{
+	int survivor_count = 0;
+	double reset_total = 0;
+	*peak_chunks = 0;
+	srand(1);
+
+	double start = now_ns();
+	for (int visit = 0; visit < VISITS; visit++) {
+
+		for (int i = 0; i < BLOCKS_PER_VISIT + CHURN_PER_VISIT; i++) sizes[i] = pick_size();
+
+		if (region) mem_region_push(region);
+		for (int i = 0; i < BLOCKS_PER_VISIT; i++) {
+			blocks[i] = region ? mem_region_alloc_current(sizes[i]) : malloc(sizes[i]);
+		}
+
+		// Views and modals replaced while the screen is up
+		for (int i = 0; i < CHURN_PER_VISIT; i++) {
+
+			int slot = rand() % BLOCKS_PER_VISIT;
+			if (region) {
+
+				mem_region_free(blocks[slot]);
+				blocks[slot] = mem_region_alloc_current(sizes[BLOCKS_PER_VISIT + i]);
+			} else {
+
+				free(blocks[slot]);
+				blocks[slot] = malloc(sizes[BLOCKS_PER_VISIT + i]);
+			}
+		}
+
+		// Outlive the screen: timers, cache entries
+		for (int i = 0; i < SURVIVORS_PER_VISIT; i++) {
+			survivors[survivor_count++] = region ? mem_region_alloc(NULL, 48) : malloc(48);
+		}
+		if (region) mem_region_pop();
+
+		if (region) {
+
+			mem_region_stats_t stats;
+			mem_region_get_stats(region, &stats);
+			if (stats.chunk_bytes > *peak_chunks) *peak_chunks = stats.chunk_bytes;
+		}
+
+		shuffle(blocks, BLOCKS_PER_VISIT);
+		for (int i = 0; i < BLOCKS_PER_VISIT; i++) {
+			if (region) mem_region_free(blocks[i]);
+			else free(blocks[i]);
+		}
+
+		if (region) {
+
+			double reset_start = now_ns();
+			mem_region_reset(region);
+			reset_total += now_ns() - reset_start;
+		}
+	}
+	double total = now_ns() - start;
+
+	for (int i = 0; i < survivor_count; i++) {
+		if (region) mem_region_free(survivors[i]);
+		else free(survivors[i]);
+	}
+
+	*reset_ns = reset_total / VISITS;
+	*kept_chunks = 0;
+	if (region) {
+
+		mem_region_stats_t stats;
+		mem_region_get_stats(region, &stats);
+		*kept_chunks = stats.chunk_bytes;
+	}
+	return total / ((double)VISITS * (BLOCKS_PER_VISIT + CHURN_PER_VISIT));
+}
+
+int main(void)
+{
+	mem_region_t *region = mem_region_create("bench");
+	double reset_ns;
+	size_t peak_chunks;
+	size_t kept_chunks;
+
+	double region_ns = run(region, &reset_ns, &peak_chunks, &kept_chunks);
+
+	mem_region_stats_t stats;
+	mem_region_get_stats(region, &stats);
+	bool clean = stats.live_blocks == 0 && stats.resets == VISITS;
+
+	double unused_reset;
+	size_t unused_peak;
+	size_t unused_kept;
+	double malloc_ns = run(NULL, &unused_reset, &unused_peak, &unused_kept);
+
+	printf("region alloc+free:  %7.1f ns/pair\n", region_ns);
+	printf("malloc alloc+free:  %7.1f ns/pair\n", malloc_ns);
+	printf("region reset:       %7.1f ns\n", reset_ns);
+	printf("region chunks:      %7u KB peak, %u KB after reset\n", (unsigned)(peak_chunks / 1024), (unsigned)(kept_chunks / 1024));
+	printf("resets:             %7u of %d %s\n", (unsigned)stats.resets, VISITS, clean ? "" : "(live blocks left)");
+
+	mem_region_destroy(region);
+	return clean ? 0 : 1;
+}
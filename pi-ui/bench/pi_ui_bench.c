@@ -0,0 +1,419 @@
+/*
+ * Whole-application benchmark
+ *
+ * Runs the real pi_ui (screens, power monitor module, mock data) on the headless
+ * backend with the virtual clock and drives scripted scenarios through the same
+ * entry points touch input uses:
+ *
+ *   home_idle       home screen, nothing touched
+ *   detail_gauges   power monitor detail screen with all its gauges
+ *   view_cycle      home screen, cycling through every power_monitor_view_type_t twice
+ *   alerts_modal    detail screen, opening and closing the alerts modal
+ *   timeline_modal  detail screen, opening and closing the timeline modal
+ *   alerts_scroll   detail screen, an alerts modal with ALERTS_SCROLL_GAUGES gauges
+ *                   (more than its recycled rows) scrolled to the bottom and back
+ *   home_return     back on the home screen after the detail screen and its modals
+ *
+ * For each scenario it reports p50/p95/p99/max frame (main loop iteration) time,
+ * mean wall and CPU time per phase (lvgl_port_profile), and LVGL and libc
+ * allocation counts, counted through linker-wrapped allocators. Results go to a
+ * JSON file so builds can be compared; a summary goes to stderr since the app
+ * logs on stdout. The virtual clock and the fixed mock data seed make every run
+ * do the same work. Screen switches tear down the screens' allocation regions; the
+ * run fails if any LVGL allocation outlives its screen and keeps a region from
+ * being reset, or if alerts_scroll never recycled a row.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make pi_ui_bench
+ * Run:   ./pi_ui_bench [--json=<path>] [--step=<ms>]
+ * Run on the Pi for representative numbers.
+ */
+#include "lvgl_port_pi.h"
+#include "lvgl_port_profile.h"
+#include "utils/log.h"
+#include "screens/screen_manager.h"
+#include "displayModules/power-monitor/power-monitor.h"
+#include "displayModules/power-monitor/config/battery_alerts_config.h"
+#include "displayModules/shared/modals/alerts_modal/alerts_modal.h"
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+void app_main(void);
+bool app_main_ready(void);
+
+#define MAX_FRAMES 4096
+#define SETTLE_FRAMES 60            // Unmeasured frames before each scenario: transitions finish
+#define MODULE_NAME "power-monitor"
+#define ALERTS_SCROLL_GAUGES 24     // The six battery gauges, four times over
+#define ALERTS_SCROLL_STEP 120      // Pixels per frame: two frames per 240 px gauge section
+
+/* ===== Allocation counting (-Wl,--wrap) ===== */
+
+static atomic_uint_fast64_t lv_allocs;
+static atomic_uint_fast64_t libc_allocs;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_lv_malloc(size_t size);
+void *__real_lv_malloc_zeroed(size_t size);
+void *__real_lv_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+	atomic_fetch_add_explicit(&libc_allocs, 1, memory_order_relaxed);
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+	atomic_fetch_add_explicit(&libc_allocs, 1, memory_order_relaxed);
+	return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	atomic_fetch_add_explicit(&libc_allocs, 1, memory_order_relaxed);
+	return __real_realloc(ptr, size);
+}
+
+void *__wrap_lv_malloc(size_t size)
+{
+	atomic_fetch_add_explicit(&lv_allocs, 1, memory_order_relaxed);
+	return __real_lv_malloc(size);
+}
+
+void *__wrap_lv_malloc_zeroed(size_t size)
+{
+	atomic_fetch_add_explicit(&lv_allocs, 1, memory_order_relaxed);
+	return __real_lv_malloc_zeroed(size);
+}
+
+void *__wrap_lv_realloc(void *ptr, size_t size)
+{
+	atomic_fetch_add_explicit(&lv_allocs, 1, memory_order_relaxed);
+	return __real_lv_realloc(ptr, size);
+}
+
+/* ===== Scenarios ===== */
+
+typedef struct {
+	const char *name;
+	int frames;
+	void (*setup)(void);                 // LVGL lock held
+	void (*action)(int frame);           // LVGL lock held, before every measured frame
+} bench_scenario_t;
+
+static void go_home(void)
+{
+	if (screen_navigation_get_current_screen() != SCREEN_HOME) {
+		screen_navigation_request_home_screen();
+	}
+}
+
+static void go_detail(void)
+{
+	if (screen_navigation_get_current_screen() != SCREEN_DETAIL_VIEW) {
+		screen_navigation_request_detail_view(MODULE_NAME);
+	}
+}
+
+// 30 frames per view, 12 views, twice
+static void cycle_action(int frame)
+{
+	if (frame % 30 == 0) power_monitor_cycle_current_view();
+}
+
+// Open at 0, close at 60, 90 frames per round
+static void alerts_action(int frame)
+{
+	if (frame % 90 == 0 || frame % 90 == 60) power_monitor_handle_alerts_button();
+}
+
+static void timeline_action(int frame)
+{
+	if (frame % 90 == 0 || frame % 90 == 60) power_monitor_handle_timeline_button();
+}
+
+// A stand-alone alerts modal taller than its row pool, so scrolling has to recycle
+// rows; values come from the six battery gauges, edits go nowhere
+static alerts_modal_gauge_config_t scroll_gauges[ALERTS_SCROLL_GAUGES];
+static alerts_modal_t *scroll_modal;
+static uint32_t scroll_rows_rebound;
+
+static float scroll_get_value(int gauge_index, int field_type)
+{
+	return power_monitor_get_state_values(gauge_index % 6, field_type);
+}
+
+static void scroll_set_value(int gauge_index, int field_type, float value)
+{
+	(void)gauge_index;
+	(void)field_type;
+	(void)value;
+}
+
+static void alerts_scroll_setup(void)
+{
+	go_detail();
+
+	for (int i = 0; i < ALERTS_SCROLL_GAUGES; i++) {
+		scroll_gauges[i] = voltage_gauge_configs[i % 6];
+	}
+	alerts_modal_config_t config = {
+		.gauge_count = ALERTS_SCROLL_GAUGES,
+		.gauges = scroll_gauges,
+		.get_value_cb = scroll_get_value,
+		.set_value_cb = scroll_set_value,
+		.refresh_cb = NULL,
+		.modal_title = "ALERTS SCROLL",
+	};
+	// Built during the settle frames
+	scroll_modal = alerts_modal_create(&config, NULL);
+	alerts_modal_show(scroll_modal);
+}
+
+// Down to the bottom, back to the top, then destroyed on the last frame
+static void alerts_scroll_action(int frame)
+{
+	if (!scroll_modal) return;
+
+	int half = ALERTS_SCROLL_GAUGES * 2;
+	if (frame < half) {
+
+		lv_obj_scroll_by_bounded(scroll_modal->content_container, 0, -ALERTS_SCROLL_STEP, LV_ANIM_OFF);
+	} else if (frame < 2 * half) {
+
+		lv_obj_scroll_by_bounded(scroll_modal->content_container, 0, ALERTS_SCROLL_STEP, LV_ANIM_OFF);
+	} else {
+
+		scroll_rows_rebound = scroll_modal->rows_rebound;
+		alerts_modal_destroy(scroll_modal);
+		scroll_modal = NULL;
+	}
+}
+
+static const bench_scenario_t scenarios[] = {
+	{ "home_idle",      600,                              go_home,   NULL },
+	{ "detail_gauges",  600,                              go_detail, NULL },
+	{ "view_cycle",     30 * POWER_MONITOR_VIEW_COUNT * 2, go_home,   cycle_action },
+	{ "alerts_modal",   90 * 5,                           go_detail, alerts_action },
+	{ "timeline_modal", 90 * 5,                           go_detail, timeline_action },
+	{ "alerts_scroll",  ALERTS_SCROLL_GAUGES * 4 + 1,     alerts_scroll_setup, alerts_scroll_action },
+	{ "home_return",    600,                              go_home,   NULL },
+};
+#define SCENARIO_COUNT (int)(sizeof(scenarios) / sizeof(scenarios[0]))
+
+/* ===== Recording ===== */
+
+typedef struct {
+	int frames;
+	int rendered;
+	uint32_t frame_wall_us[MAX_FRAMES];
+	uint64_t cpu_us;
+	uint64_t phase_wall_us[LVGL_PORT_PHASE_COUNT];
+	uint64_t phase_cpu_us[LVGL_PORT_PHASE_COUNT];
+} bench_record_t;
+
+static bench_record_t record;
+static bool recording = false;
+
+static void frame_cb(const lvgl_port_frame_profile_t *frame, void *user_data)
+{
+	if (!recording || record.frames >= MAX_FRAMES) return;
+
+	record.frame_wall_us[record.frames++] = frame->wall_us;
+	if (frame->rendered) record.rendered++;
+	record.cpu_us += frame->cpu_us;
+	for (int i = 0; i < LVGL_PORT_PHASE_COUNT; i++) {
+
+		record.phase_wall_us[i] += frame->phase_wall_us[i];
+		record.phase_cpu_us[i] += frame->phase_cpu_us[i];
+	}
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Nearest rank on a sorted array
+static uint32_t percentile(const uint32_t *sorted, int count, int pct)
+{
+	if (count == 0) return 0;
+
+	int rank = (pct * count + 99) / 100;
+	if (rank < 1) rank = 1;
+	return sorted[rank - 1];
+}
+
+static bool run_frames(int count)
+{
+	for (int i = 0; i < count; i++) {
+
+		if (!lvgl_port_step()) return false;
+	}
+	return true;
+}
+
+static void write_scenario_json(FILE *json, const bench_scenario_t *scenario, uint64_t lv_count, uint64_t libc_count, bool first)
+{
+	static uint32_t sorted[MAX_FRAMES];
+	int n = record.frames;
+	memcpy(sorted, record.frame_wall_us, (size_t)n * sizeof(uint32_t));
+	qsort(sorted, (size_t)n, sizeof(uint32_t), compare_u32);
+
+	uint64_t total_us = 0;
+	for (int i = 0; i < n; i++) total_us += sorted[i];
+	double div = n > 0 ? (double)n : 1.0;
+
+	lv_mem_monitor_t mem;
+	lv_mem_monitor(&mem);
+
+	fprintf(json, "%s    {\n", first ? "" : ",\n");
+	fprintf(json, "      \"name\": \"%s\",\n", scenario->name);
+	fprintf(json, "      \"frames\": %d,\n", n);
+	fprintf(json, "      \"rendered\": %d,\n", record.rendered);
+	fprintf(json, "      \"frame_us\": { \"p50\": %u, \"p95\": %u, \"p99\": %u, \"max\": %u, \"mean\": %.1f },\n",
+		percentile(sorted, n, 50), percentile(sorted, n, 95), percentile(sorted, n, 99),
+		n > 0 ? sorted[n - 1] : 0, total_us / div);
+	fprintf(json, "      \"cpu_us_per_frame\": %.1f,\n", record.cpu_us / div);
+	fprintf(json, "      \"phases\": {\n");
+	for (int p = 0; p < LVGL_PORT_PHASE_COUNT; p++) {
+
+		fprintf(json, "        \"%s\": { \"wall_us\": %.1f, \"cpu_us\": %.1f, \"cpu_ms_total\": %.3f }%s\n",
+			lvgl_port_profile_phase_name((lvgl_port_phase_t)p),
+			record.phase_wall_us[p] / div, record.phase_cpu_us[p] / div, record.phase_cpu_us[p] / 1000.0,
+			p + 1 < LVGL_PORT_PHASE_COUNT ? "," : "");
+	}
+	fprintf(json, "      },\n");
+	fprintf(json, "      \"allocations\": { \"lv\": %llu, \"libc\": %llu, \"per_frame\": %.2f, \"lv_mem_used\": %zu, \"lv_mem_max_used\": %zu }\n",
+		(unsigned long long)lv_count, (unsigned long long)libc_count, (lv_count + libc_count) / div,
+		mem.total_size - mem.free_size, mem.max_used);
+	fprintf(json, "    }");
+
+	fprintf(stderr, "%-15s %6d %6d %8u %8u %8u %8u %9.1f %9.2f\n", scenario->name, n, record.rendered,
+		percentile(sorted, n, 50), percentile(sorted, n, 95), percentile(sorted, n, 99),
+		n > 0 ? sorted[n - 1] : 0, record.cpu_us / div, (lv_count + libc_count) / div);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *json_path = "pi_ui_bench.json";
+	long step_ms = LV_DEF_REFR_PERIOD;
+
+	for (int i = 1; i < argc; i++) {
+
+		if (strncmp(argv[i], "--json=", 7) == 0 && argv[i][7] != '\0') {
+
+			json_path = argv[i] + 7;
+		} else if (strncmp(argv[i], "--step=", 7) == 0) {
+
+			step_ms = strtol(argv[i] + 7, NULL, 10);
+		} else {
+
+			fprintf(stderr, "Usage: %s [--json=<path>] [--step=<ms>]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	char output_spec[32];
+	snprintf(output_spec, sizeof(output_spec), "headless:%ld", step_ms);
+	if (!lvgl_port_set_output(output_spec)) {
+
+		fprintf(stderr, "Invalid step %ld ms\n", step_ms);
+		return 1;
+	}
+	lvgl_port_set_fps_visible(false);
+
+	FILE *json = fopen(json_path, "w");
+	if (!json) {
+
+		fprintf(stderr, "Cannot write %s\n", json_path);
+		return 1;
+	}
+
+	log_init();
+	app_main();
+
+	lvgl_port_profile_set_frame_cb(frame_cb, NULL);
+	lvgl_port_profile_set_cpu(true);
+	lvgl_port_profile_set_enabled(true);
+
+	fprintf(json, "{\n");
+	fprintf(json, "  \"bench\": \"pi_ui_bench\",\n");
+	fprintf(json, "  \"step_ms\": %ld,\n", step_ms);
+	fprintf(json, "  \"draw_units\": %d,\n", LV_DRAW_SW_DRAW_UNIT_CNT);
+	fprintf(json, "  \"scenarios\": [\n");
+
+	fprintf(stderr, "pi_ui_bench: headless, %ld ms virtual step, %d draw units\n", step_ms, LV_DRAW_SW_DRAW_UNIT_CNT);
+	fprintf(stderr, "%-15s %6s %6s %8s %8s %8s %8s %9s %9s\n", "scenario", "frames", "rendr",
+		"p50 us", "p95 us", "p99 us", "max us", "cpu us/f", "allocs/f");
+
+	// Boot: workers load state and data source, screen manager builds home, first data arrives
+	bool ok = true;
+	while (ok && !app_main_ready()) ok = lvgl_port_step();
+	ok = ok && run_frames(SETTLE_FRAMES);
+	for (int s = 0; ok && s < SCENARIO_COUNT; s++) {
+
+		const bench_scenario_t *scenario = &scenarios[s];
+
+		lvgl_port_lock(0);
+		scenario->setup();
+		lvgl_port_unlock();
+		ok = run_frames(SETTLE_FRAMES);
+		if (!ok) break;
+
+		memset(&record, 0, sizeof(record));
+		uint64_t lv_start = atomic_load(&lv_allocs);
+		uint64_t libc_start = atomic_load(&libc_allocs);
+		recording = true;
+
+		for (int frame = 0; ok && frame < scenario->frames; frame++) {
+
+			if (scenario->action) {
+
+				lvgl_port_lock(0);
+				scenario->action(frame);
+				lvgl_port_unlock();
+			}
+			ok = lvgl_port_step();
+		}
+
+		recording = false;
+		write_scenario_json(json, scenario, atomic_load(&lv_allocs) - lv_start,
+			atomic_load(&libc_allocs) - libc_start, s == 0);
+	}
+
+	// A second of virtual time: deferred destroys run and torn-down screen regions either
+	// reset or time out as leaked
+	ok = ok && run_frames(SETTLE_FRAMES + (int)(1000 / step_ms));
+	uint32_t regions_released;
+	uint32_t regions_leaked;
+	screen_manager_get_region_counts(&regions_released, &regions_leaked);
+
+	fprintf(json, "\n  ],\n");
+	fprintf(json, "  \"alerts_rows_rebound\": %u,\n", (unsigned)scroll_rows_rebound);
+	fprintf(json, "  \"screen_regions\": { \"reset\": %u, \"leaked\": %u }\n}\n",
+		(unsigned)regions_released, (unsigned)regions_leaked);
+	fclose(json);
+
+	lvgl_port_profile_set_enabled(false);
+	lvgl_port_deinit();
+
+	if (!ok) {
+
+		fprintf(stderr, "pi_ui_bench: main loop ended early\n");
+		return 1;
+	}
+
+	fprintf(stderr, "screen regions: %u reset at teardown, %u leaked\n", (unsigned)regions_released, (unsigned)regions_leaked);
+	fprintf(stderr, "alerts_scroll: %u rows rebound\n", (unsigned)scroll_rows_rebound);
+	fprintf(stderr, "Results written to %s\n", json_path);
+	return (regions_leaked || scroll_rows_rebound == 0) ? 1 : 0;
+}
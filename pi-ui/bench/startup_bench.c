@@ -0,0 +1,182 @@
+/*
+ * Startup benchmark
+ *
+ * Boots the real pi_ui (app_main) on the headless backend with the real clock, in a
+ * fresh child process per run, and reports:
+ *
+ *   first frame   first refresh that drew something (the boot screen)
+ *   ready         boot steps done: screen manager, UI timer and data producer running
+ *   first value   first frame drawn after a produced sample went through the UI
+ *
+ * all in milliseconds from startup_profile_init() (entry of main), plus min, median and
+ * max over the runs, and the process RSS at the first value next to the executable
+ * size. Build once as is and once with -DPI_UI_FONTS_MMAP=ON to compare compiled-in
+ * fonts against mapped ones (font files, resident pages and glyphs paged in are
+ * reported then). The per-phase timings are in the app log (tag "startup") on
+ * stdout; the results go to stderr.
+ *
+ * Build: cmake -DPI_UI_BUILD_BENCH=ON ..  &&  make startup_bench
+ * Run:   ./startup_bench [--runs=<n>] > /dev/null
+ * Run on the Pi, after a reboot or drop_caches for a cold start.
+ */
+#include "lvgl_port_pi.h"
+#include "utils/log.h"
+#include "utils/startup_profile.h"
+#include "utils/font_mmap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+void app_main(void);
+bool app_main_ready(void);
+
+#define MAX_RUNS 50
+#define RUN_TIMEOUT_US 10000000     // A run that shows no value by then failed
+
+typedef struct {
+	uint64_t first_frame_us;
+	uint64_t ready_us;
+	uint64_t first_value_us;
+	uint64_t rss_kb;
+	font_mmap_stats_t fonts;
+} startup_result_t;
+
+static uint64_t rss_kb(void)
+{
+	FILE *status = fopen("/proc/self/status", "r");
+	if (!status) return 0;
+
+	char line[128];
+	unsigned long long kb = 0;
+	while (fgets(line, sizeof(line), status)) {
+		if (sscanf(line, "VmRSS: %llu kB", &kb) == 1) break;
+	}
+	fclose(status);
+	return kb;
+}
+
+static void child_run(int fd)
+{
+	startup_result_t result = { 0 };
+
+	startup_profile_init();
+	log_init();
+	lvgl_port_set_output("headless");
+	lvgl_port_set_fps_visible(false);
+
+	app_main();
+	while (startup_profile_now_us() < RUN_TIMEOUT_US && lvgl_port_step()) {
+
+		if (!result.ready_us && app_main_ready()) result.ready_us = startup_profile_now_us();
+		if (startup_profile_first_live_value_us()) break;
+	}
+
+	result.first_frame_us = startup_profile_first_frame_us();
+	result.first_value_us = startup_profile_first_live_value_us();
+	result.rss_kb = rss_kb();
+	font_mmap_get_stats(&result.fonts);
+	if (write(fd, &result, sizeof(result)) != (ssize_t)sizeof(result)) {
+		exit(1);
+	}
+	exit(0); // Flushes the log
+}
+
+static bool run_once(startup_result_t *result)
+{
+	int fds[2];
+	if (pipe(fds) != 0) return false;
+
+	fflush(NULL);
+	pid_t pid = fork();
+	if (pid < 0) return false;
+	if (pid == 0) {
+
+		close(fds[0]);
+		child_run(fds[1]);
+	}
+
+	close(fds[1]);
+	bool ok = read(fds[0], result, sizeof(*result)) == (ssize_t)sizeof(*result);
+	close(fds[0]);
+
+	int status;
+	waitpid(pid, &status, 0);
+	return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0 && result->first_value_us;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+	return (x > y) - (x < y);
+}
+
+static void print_stat(const char *name, uint64_t *values, int count)
+{
+	qsort(values, (size_t)count, sizeof(uint64_t), compare_u64);
+	fprintf(stderr, "%-12s %9.1f %9.1f %9.1f\n", name,
+		values[0] / 1000.0, values[count / 2] / 1000.0, values[count - 1] / 1000.0);
+}
+
+int main(int argc, char *argv[])
+{
+	int runs = 5;
+
+	for (int i = 1; i < argc; i++) {
+
+		if (strncmp(argv[i], "--runs=", 7) == 0) {
+
+			runs = atoi(argv[i] + 7);
+		} else {
+
+			fprintf(stderr, "Usage: %s [--runs=<n>]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (runs < 1 || runs > MAX_RUNS) {
+
+		fprintf(stderr, "Runs must be 1..%d\n", MAX_RUNS);
+		return 1;
+	}
+
+	struct stat exe;
+	if (stat("/proc/self/exe", &exe) == 0) {
+		fprintf(stderr, "executable: %lld KB\n", (long long)exe.st_size / 1024);
+	}
+
+	uint64_t first_frame[MAX_RUNS], ready[MAX_RUNS], first_value[MAX_RUNS], rss[MAX_RUNS];
+	for (int r = 0; r < runs; r++) {
+
+		startup_result_t result;
+		if (!run_once(&result)) {
+
+			fprintf(stderr, "Run %d failed (no live value within %d s)\n", r + 1, RUN_TIMEOUT_US / 1000000);
+			return 1;
+		}
+		fprintf(stderr, "run %2d: first frame %7.1f ms, ready %7.1f ms, first value %7.1f ms, rss %6llu KB\n", r + 1,
+			result.first_frame_us / 1000.0, result.ready_us / 1000.0, result.first_value_us / 1000.0,
+			(unsigned long long)result.rss_kb);
+		if (result.fonts.fonts) {
+
+			fprintf(stderr, "        fonts: %d mapped, %zu KB of files, %zu KB resident, %zu KB heap, "
+				"%u glyphs prefetched, %u paged in on first draw\n", result.fonts.fonts,
+				result.fonts.file_bytes / 1024, result.fonts.resident_bytes / 1024, result.fonts.heap_bytes / 1024,
+				result.fonts.glyphs_prefetched, result.fonts.glyphs_lazy);
+		}
+		first_frame[r] = result.first_frame_us;
+		ready[r] = result.ready_us;
+		first_value[r] = result.first_value_us;
+		rss[r] = result.rss_kb; // print_stat divides by 1000: MB
+	}
+
+	fprintf(stderr, "\n%-12s %9s %9s %9s\n", "ms", "min", "median", "max");
+	print_stat("first frame", first_frame, runs);
+	print_stat("ready", ready, runs);
+	print_stat("first value", first_value, runs);
+	print_stat("rss (MB)", rss, runs);
+	return 0;
+}
@@ -0,0 +1,23 @@
+#!/bin/bash
+
+# Binary versions of the app fonts, for builds with -DPI_UI_FONTS_MMAP=ON.
+# Same glyphs and options as the compiled-in ones (Opts line of src/fonts/lv_font_*.c),
+# written to fonts/bin/ (PI_UI_FONT_DIR). Needs lv_font_conv: npm i -g lv_font_conv
+set -e
+cd "$(dirname "$0")/.."
+mkdir -p fonts/bin
+
+convert() {
+    local name=$1 font=$2 size=$3
+    lv_font_conv --no-compress --bpp 4 --size "$size" --font "$font" -r 0x20-0x7F,0x2E \
+        --format bin -o "fonts/bin/$name.bin" --force-fast-kern-format
+    echo "fonts/bin/$name.bin: $(wc -c < "fonts/bin/$name.bin") bytes"
+}
+
+convert noplato_10 "fonts/Noplato Mono.ttf" 10
+convert noplato_14 "fonts/Noplato Mono.ttf" 14
+convert noplato_18 "fonts/Noplato Mono.ttf" 18
+convert noplato_20 "fonts/Noplato Mono.ttf" 20
+convert noplato_24 "fonts/Noplato Mono.ttf" 24
+convert noplato_32 "fonts/Noplato Mono.ttf" 32
+convert zector_72 "fonts/Zector.ttf" 72
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Rewrites a compiled-in font (src/fonts/lv_font_*.c, lv_font_conv --format lvgl) in
+lv_font_conv's binary layout (--format bin), glyph for glyph.
+
+Only for fixtures: the font_mmap check compares what font_mmap_load() decodes from the
+result with the compiled-in font it came from. Real binary fonts come from
+build_bin_fonts.sh. Handles what the app fonts use: uncompressed bitmaps, tiny and
+sparse tiny character maps, no kerning.
+
+Usage: fonts/c_font_to_bin.py src/fonts/lv_font_noplato_10.c bench/fixtures/noplato_10.bin
+"""
+import re
+import struct
+import sys
+
+
+def fail(message):
+    sys.exit(f"c_font_to_bin: {message}")
+
+
+def array_body(source, name):
+    match = re.search(r"\b" + name + r"\[\]\s*=\s*\{(.*?)\n\};", source, re.S)
+    if not match:
+        fail(f"no {name}[]")
+    return re.sub(r"/\*.*?\*/", "", match.group(1), flags=re.S)
+
+
+def field(text, name):
+    match = re.search(r"\." + name + r"\s*=\s*([^,\s}]+)", text)
+    if not match:
+        fail(f"no .{name}")
+    return match.group(1)
+
+
+def number(text, name):
+    return int(field(text, name), 0)
+
+
+def parse(source):
+    font = {}
+    font["size"] = int(re.search(r"Size: (\d+) px", source).group(1))
+
+    font["bitmap"] = bytes(int(b, 16) for b in re.findall(r"0x[0-9a-fA-F]+", array_body(source, "glyph_bitmap")))
+    font["glyphs"] = [
+        {key: number(entry, key) for key in ("bitmap_index", "adv_w", "box_w", "box_h", "ofs_x", "ofs_y")}
+        for entry in re.findall(r"\{([^{}]*)\}", array_body(source, "glyph_dsc"))
+    ]
+
+    font["cmaps"] = []
+    for entry in re.findall(r"\{([^{}]*)\}", array_body(source, "cmaps")):
+        cmap = {key: number(entry, key) for key in ("range_start", "range_length", "glyph_id_start", "list_length")}
+        cmap["type"] = field(entry, "type")
+        cmap["unicode_list"] = []
+        if cmap["type"] == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            cmap["unicode_list"] = [int(v, 0) for v in array_body(source, field(entry, "unicode_list")).replace(",", " ").split()]
+        elif cmap["type"] != "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            fail(f"{cmap['type']} character maps are not supported")
+        font["cmaps"].append(cmap)
+
+    dsc = re.search(r"lv_font_fmt_txt_dsc_t font_dsc = \{(.*?)\n\};", source, re.S).group(1)
+    if field(dsc, "kern_dsc") != "NULL":
+        fail("kerning is not supported")
+    if number(dsc, "bitmap_format") != 0:
+        fail("compressed bitmaps are not supported")
+    font["bpp"] = number(dsc, "bpp")
+
+    public = re.search(r"lv_font_t lv_font_\w+ = \{(.*?)\n\};", source, re.S).group(1)
+    for key in ("line_height", "base_line", "underline_position", "underline_thickness"):
+        font[key] = number(public, key)
+    return font
+
+
+def signed_bits(values):
+    bits = 1
+    while any(not -(1 << (bits - 1)) <= v < (1 << (bits - 1)) for v in values):
+        bits += 1
+    return bits
+
+
+def unsigned_bits(values):
+    return max(max(values).bit_length(), 1)
+
+
+class BitWriter:
+    """MSB first, like lv_font_conv."""
+
+    def __init__(self):
+        self.bits = []
+
+    def write(self, value, count):
+        for i in range(count - 1, -1, -1):
+            self.bits.append((value >> i) & 1)
+
+    def to_bytes(self):
+        padded = self.bits + [0] * (-len(self.bits) % 8)
+        return bytes(int("".join(map(str, padded[i:i + 8])), 2) for i in range(0, len(padded), 8))
+
+
+def table(label, body):
+    return struct.pack("<I4s", 8 + len(body), label) + body
+
+
+def encode(font):
+    glyphs = font["glyphs"]
+    bpp = font["bpp"]
+
+    # adv_w keeps its 4 fractional bits (advance_width_format 1)
+    adv_bits = unsigned_bits([g["adv_w"] for g in glyphs])
+    xy_bits = signed_bits([g["ofs_x"] for g in glyphs] + [g["ofs_y"] for g in glyphs])
+    wh_bits = unsigned_bits([g["box_w"] for g in glyphs] + [g["box_h"] for g in glyphs])
+
+    records = []
+    for g in glyphs:
+        writer = BitWriter()
+        writer.write(g["adv_w"], adv_bits)
+        writer.write(g["ofs_x"] & ((1 << xy_bits) - 1), xy_bits)
+        writer.write(g["ofs_y"] & ((1 << xy_bits) - 1), xy_bits)
+        writer.write(g["box_w"], wh_bits)
+        writer.write(g["box_h"], wh_bits)
+        pixels = g["box_w"] * g["box_h"]
+        bitmap = font["bitmap"][g["bitmap_index"]:g["bitmap_index"] + (pixels * bpp + 7) // 8]
+        for i in range(pixels):
+            bit = i * bpp
+            writer.write((bitmap[bit // 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1), bpp)
+        records.append(writer.to_bytes())
+
+    offsets = []
+    glyf = b""
+    for record in records:
+        offsets.append(8 + len(glyf))
+        glyf += record
+    loc_format = 1 if offsets[-1] > 0xFFFF else 0
+    loca = struct.pack("<I", len(offsets)) + b"".join(struct.pack("<I" if loc_format else "<H", o) for o in offsets)
+
+    entries = b""
+    lists = b""
+    lists_start = 8 + 4 + 16 * len(font["cmaps"])
+    for cmap in font["cmaps"]:
+        tiny = cmap["type"] == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"
+        offset = 0 if tiny else lists_start + len(lists)
+        entries += struct.pack("<IIHHHBB", offset, cmap["range_start"], cmap["range_length"], cmap["glyph_id_start"],
+                               len(cmap["unicode_list"]), 2 if tiny else 3, 0)
+        lists += b"".join(struct.pack("<H", v) for v in cmap["unicode_list"])
+        lists += b"\0" * (-len(lists) % 4)
+    cmap_table = struct.pack("<I", len(font["cmaps"])) + entries + lists
+
+    descent = -font["base_line"]
+    ascent = font["line_height"] + descent
+    boxes = [g for g in glyphs if g["box_h"]]
+    head = struct.pack("<IHHHhHhHhhHHBBBBBBBBBBhH",
+                       1, 3, font["size"], ascent, descent, ascent, descent, 0,
+                       min(g["ofs_y"] for g in boxes), max(g["ofs_y"] + g["box_h"] for g in boxes),
+                       0, 0, loc_format, 0, 1, bpp, xy_bits, wh_bits, adv_bits, 0, 0, 0,
+                       font["underline_position"], font["underline_thickness"])
+
+    return table(b"head", head) + table(b"cmap", cmap_table) + table(b"loca", loca) + table(b"glyf", glyf)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    with open(sys.argv[1]) as source:
+        font = parse(source.read())
+    data = encode(font)
+    with open(sys.argv[2], "wb") as out:
+        out.write(data)
+    print(f"{sys.argv[2]}: {len(font['glyphs'])} glyphs, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -40,7 +40,7 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM   /* Per-screen regions, see src/lvgl_port_mem.c */
 
 /** Possible values
  * - LV_STDLIB_BUILTIN:     LVGL's built in implementation
@@ -107,7 +107,7 @@
  * - LV_OS_MQX
  * - LV_OS_SDL2
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+#define LV_USE_OS   LV_OS_PTHREAD
 
 #if LV_USE_OS == LV_OS_CUSTOM
 	#define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -154,7 +154,7 @@
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
-#define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)         /**< [bytes]*/
+#define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024)        /**< [bytes]*/
 
 /** Thread priority of the drawing task.
  *  Higher values mean higher priority.
@@ -191,8 +191,12 @@
 
 	/** Set number of draw units.
 	 *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
-	 *  - > 1 means multiple threads will render the screen in parallel. */
-	#define LV_DRAW_SW_DRAW_UNIT_CNT    1
+	 *  - > 1 means multiple threads will render the screen in parallel.
+	 *  - Set by the build (PI_UI_DRAW_UNITS); 3 leaves a core of the Pi's 4 for the
+	 *    presenter and data threads. */
+	#ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+		#define LV_DRAW_SW_DRAW_UNIT_CNT    3
+	#endif
 
 	/** Use Arm-2D to accelerate software (sw) rendering. */
 	#define LV_USE_DRAW_ARM2D_SYNC      0
@@ -1051,7 +1055,7 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
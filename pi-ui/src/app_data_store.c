@@ -3,6 +3,7 @@
 #include "data/config.h"
 #include "data/mock_data/mock_data.h"
 #include "data/lerp_data/lerp_data.h"
+#include "utils/log.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -16,16 +17,16 @@ static bool g_initialized = false;
 void app_data_store_init(void)
 {
 	if (g_initialized) {
-		printf("[W] %s: Already initialized\n", TAG);
+		LOG_W(TAG, "Already initialized");
 		return;
 	}
 
-	printf("[I] %s: Initializing app data store\n", TAG);
+	LOG_I(TAG, "Initializing app data store");
 
 	// Allocate power monitor data
 	g_app_data_store.power_monitor = calloc(1, sizeof(power_monitor_data_t));
 	if (!g_app_data_store.power_monitor) {
-		printf("[E] %s: Failed to allocate power monitor data\n", TAG);
+		LOG_E(TAG, "Failed to allocate power monitor data");
 		return;
 	}
 
@@ -38,7 +39,7 @@ void app_data_store_init(void)
 	// Initialize other module data here as needed
 
 	g_initialized = true;
-	printf("[I] %s: App data store initialized\n", TAG);
+	LOG_I(TAG, "App data store initialized");
 }
 
 void app_data_store_update(void)
@@ -67,7 +68,7 @@ void app_data_store_cleanup(void)
 		return;
 	}
 
-	printf("[I] %s: Cleaning up app data store\n", TAG);
+	LOG_I(TAG, "Cleaning up app data store");
 
 	// Free power monitor data
 	if (g_app_data_store.power_monitor) {
@@ -79,7 +80,7 @@ void app_data_store_cleanup(void)
 
 	memset(&g_app_data_store, 0, sizeof(app_data_store_t));
 	g_initialized = false;
-	printf("[I] %s: App data store cleanup complete\n", TAG);
+	LOG_I(TAG, "App data store cleanup complete");
 }
 
 app_data_store_t* app_data_store_get(void)
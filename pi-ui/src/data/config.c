@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include "config.h"
+#include "../utils/log.h"
 
 #include <string.h>
 
@@ -11,14 +12,13 @@ data_source_t g_data_source = DATA_SOURCE_MOCK; // Default to mock data
 void data_config_init(void)
 {
 
-	printf("[I] config: Data source: %s\n", data_config_get_source_name(g_data_source));
+	LOG_I(TAG, "Data source: %s", data_config_get_source_name(g_data_source));
 }
 
 void data_config_set_source(data_source_t source)
 {
 	if (source >= DATA_SOURCE_COUNT) {
-		printf(
-			"[W] config: Invalid data source: %d, keeping current: %s\n",
+		LOG_W(TAG, "Invalid data source: %d, keeping current: %s",
 			source, data_config_get_source_name(g_data_source)
 		);
 		return;
@@ -27,8 +27,7 @@ void data_config_set_source(data_source_t source)
 	data_source_t old_source = g_data_source;
 	g_data_source = source;
 
-	printf(
-		"[I] config: Data source changed from %s to %s\n",
+	LOG_I(TAG, "Data source changed from %s to %s",
 		data_config_get_source_name(old_source),
 		data_config_get_source_name(g_data_source)
 	);
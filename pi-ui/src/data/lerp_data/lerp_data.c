@@ -5,6 +5,8 @@
 #include <string.h>
 #include <math.h>
 #include "../../displayModules/power-monitor/power-monitor.h"
+#include "../../utils/time_source.h"
+#include "../../utils/log.h"
 
 static const char *TAG = "lerp_data";
 
@@ -36,7 +38,7 @@ void lerp_data_update(void)
 {
 	if (!g_lerp_initialized) {
 
-		printf("[W] lerp_data: LERP data not initialized\n");
+		LOG_W(TAG, "LERP data not initialized");
 		return;
 	}
 
@@ -54,7 +56,7 @@ void lerp_data_set_targets(const void* raw_data)
 {
 	if (!g_lerp_initialized) {
 
-		printf("[W] lerp_data: LERP data not initialized\n");
+		LOG_W(TAG, "LERP data not initialized");
 		return;
 	}
 
@@ -75,7 +77,7 @@ void lerp_data_get_current(lerp_power_monitor_data_t* output)
 {
 	if (!g_lerp_initialized || !output) {
 
-		printf("[W] lerp_data: LERP data not initialized or output is NULL\n");
+		LOG_W(TAG, "LERP data not initialized or output is NULL");
 		return;
 	}
 
@@ -104,7 +106,7 @@ void lerp_value_init(lerp_value_t* lerp_val, float initial_value)
 {
 	if (!lerp_val) {
 
-		printf("[E] lerp_data: LERP value pointer is NULL\n");
+		LOG_E(TAG, "LERP value pointer is NULL");
 		return;
 	}
 
@@ -120,7 +122,7 @@ void lerp_value_set_target(lerp_value_t* lerp_val, float target_value)
 {
 	if (!lerp_val) {
 
-		printf("[E] lerp_data: LERP value pointer is NULL\n");
+		LOG_E(TAG, "LERP value pointer is NULL");
 		return;
 	}
 
@@ -152,9 +154,7 @@ void lerp_value_update(lerp_value_t* lerp_val)
 		lerp_val->is_interpolating = false;
 	}
 
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	lerp_val->last_update_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	lerp_val->last_update_ms = time_source_ms();
 }
 
 // Get raw value (always current sensor reading)
@@ -162,7 +162,7 @@ float lerp_value_get_raw(const lerp_value_t* lerp_val)
 {
 	if (!lerp_val) {
 
-		printf("[E] lerp_data: LERP value pointer is NULL\n");
+		LOG_E(TAG, "LERP value pointer is NULL");
 		return 0.0f;
 	}
 
@@ -174,7 +174,7 @@ float lerp_value_get_display(const lerp_value_t* lerp_val)
 {
 	if (!lerp_val) {
 
-		printf("[E] lerp_data: LERP value pointer is NULL\n");
+		LOG_E(TAG, "LERP value pointer is NULL");
 		return 0.0f;
 	}
 
@@ -7,6 +7,8 @@
 #include <string.h>
 #include "../../displayModules/power-monitor/power-monitor.h"
 #include "../../state/device_state.h"
+#include "../../utils/time_source.h"
+#include "../../utils/log.h"
 
 static const char *TAG = "mock_data";
 
@@ -32,12 +34,10 @@ static void update_compressor_controller_mock_data(void);
 
 void mock_data_init(void)
 {
-		printf("[I] mock_data: Initializing mock data component\n");
+		LOG_I(TAG, "Initializing mock data component");
 
-	// Initialize random seed
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	g_random_seed = (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+	// Initialize random seed; fixed on the virtual clock so simulated runs replay exactly
+	g_random_seed = time_source_is_virtual() ? MOCK_DATA_VIRTUAL_SEED : (uint32_t)time_source_us();
 	srand(g_random_seed);
 
 	// Initialize all data structures
@@ -86,7 +86,7 @@ void mock_data_init(void)
 	g_mock_data.gps.heading_degrees = 0.0f;
 	g_mock_data.gps.satellites_visible = 8;
 	g_mock_data.gps.has_fix = true;
-	g_mock_data.gps.last_fix_time = time(NULL);
+	g_mock_data.gps.last_fix_time = time_source_wall();
 
 	g_mock_data.coolant_temp.engine_coolant_temp = 90.0f;
 	g_mock_data.coolant_temp.transmission_temp = 80.0f;
@@ -129,7 +129,7 @@ void mock_data_init(void)
 	g_mock_data.sweep_cycle_count = 0;
 	g_mock_data.mock_data_enabled = true;
 
-		printf("[I] mock_data: Mock data component initialized successfully\n");
+		LOG_I(TAG, "Mock data component initialized successfully");
 }
 
 void mock_data_update(void)
@@ -138,9 +138,7 @@ void mock_data_update(void)
 		return;
 	}
 
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_time = ts.tv_sec * 1000 + ts.tv_nsec / 1000000; // Convert to milliseconds
+	uint32_t current_time = time_source_ms(); // Convert to milliseconds
 
 	// Update every interval
 	if (current_time - g_mock_data.last_update_time < g_update_interval_ms) {
@@ -184,13 +182,13 @@ void mock_data_update(void)
 void mock_data_enable(bool enable)
 {
 	g_mock_data.mock_data_enabled = enable;
-		printf("[I] mock_data: Mock data %s\n", enable ? "enabled" : "disabled");
+		LOG_I(TAG, "Mock data %s", enable ? "enabled" : "disabled");
 }
 
 void mock_data_set_update_interval(uint32_t interval_ms)
 {
 	g_update_interval_ms = interval_ms;
-		printf("[I] mock_data: Mock data update interval set to %lu ms\n", interval_ms);
+		LOG_I(TAG, "Mock data update interval set to %u ms", (unsigned)interval_ms);
 }
 
 // Data getter functions
@@ -243,9 +241,7 @@ float mock_data_random_float(float min, float max)
 
 float mock_data_sweep_float(float min, float max, uint32_t cycle_count, uint32_t sweep_duration_ms)
 {
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_time = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t current_time = time_source_ms();
 	float sweep_progress = (float)(current_time % sweep_duration_ms) / (float)sweep_duration_ms;
 
 	// Create a smooth sine wave sweep
@@ -267,9 +263,7 @@ uint32_t mock_data_random_uint32(uint32_t min, uint32_t max)
 static void update_power_monitor_mock_data(void)
 {
 	// Get current time for error simulation
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_time_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t current_time_ms = time_source_ms();
 
 	// Simulate realistic power monitoring scenarios
 	g_mock_data.power_monitor.ignition_on = mock_data_random_bool(0.3f); // 30% chance ignition is on
@@ -417,7 +411,7 @@ static void update_gps_mock_data(void)
 	g_mock_data.gps.has_fix = mock_data_random_bool(0.95f);
 
 	if (g_mock_data.gps.has_fix) {
-		g_mock_data.gps.last_fix_time = time(NULL);
+		g_mock_data.gps.last_fix_time = time_source_wall();
 	}
 }
 
@@ -534,9 +528,7 @@ void mock_data_write_to_state_objects(void)
 
 	// Rate limiting - only update every 100ms for more responsive updates
 	static uint32_t last_write_time = 0;
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_time = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t current_time = time_source_ms();
 	if (current_time - last_write_time < 100) {
 		return;
 	}
@@ -545,13 +537,13 @@ void mock_data_write_to_state_objects(void)
 	// Write power monitor data to state
 	power_monitor_data_t *power_data = power_monitor_get_data();
 	if (!power_data) {
-		printf("[W] mock_data: power_data is NULL, skipping state write\n");
+		LOG_W(TAG, "power_data is NULL, skipping state write");
 		return;
 	}
 
 	mock_power_monitor_data_t *mock_power = mock_data_get_power_monitor();
 	if (!mock_power) {
-		printf("[W] mock_data: mock_power is NULL, skipping state write\n");
+		LOG_W(TAG, "mock_power is NULL, skipping state write");
 		return;
 	}
 
@@ -13,6 +13,7 @@ extern "C" {
 // Mock data configuration
 #define MOCK_UPDATE_INTERVAL_MS 1000  // Update every 1000ms for maximum stability
 #define MOCK_SWEEP_DURATION_MS 5000   // Complete sweep every 5 seconds
+#define MOCK_DATA_VIRTUAL_SEED 0x5EED  // rand() seed on the virtual clock
 
 // Power Monitor Mock Data
 typedef struct {
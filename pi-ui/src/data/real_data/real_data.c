@@ -1,13 +1,14 @@
 #include <stdio.h>
 #include "real_data.h"
+#include "../../utils/log.h"
 
 
 static const char *TAG = "real_data";
 
 void real_data_init(void)
 {
-		printf("[I] real_data: Initializing real data component\n");
-	printf("[I] real_data: Real data component initialized (placeholder implementation)\n");
+		LOG_I(TAG, "Initializing real data component");
+	LOG_I(TAG, "Real data component initialized (placeholder implementation)");
 }
 
 void real_data_update(void)
@@ -18,7 +19,7 @@ void real_data_update(void)
 	update_count++;
 
 	if (update_count % 100 == 0) {
-		printf("[I] real_data: Real data update cycle: %d\n", update_count);
+		LOG_I(TAG, "Real data update cycle: %d", update_count);
 	}
 }
 
@@ -31,54 +32,54 @@ void real_data_write_to_state_objects(void)
 
 	// Placeholder implementation
 	// This will be implemented when real sensors are connected
-	printf("[D] real_data: Writing real data to state objects (placeholder)\n");
+	LOG_D(TAG, "Writing real data to state objects (placeholder)");
 }
 
 // Placeholder getter functions
 void* real_data_get_power_monitor(void)
 {
-		printf("[D] real_data: Getting real power monitor data (placeholder)\n");
+		LOG_D(TAG, "Getting real power monitor data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_temp_humidity(void)
 {
-		printf("[D] real_data: Getting real temp humidity data (placeholder)\n");
+		LOG_D(TAG, "Getting real temp humidity data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_inclinometer(void)
 {
-	printf("[D] real_data: Getting real inclinometer data (placeholder)\n");
+	LOG_D(TAG, "Getting real inclinometer data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_gps(void)
 {
-	printf("[D] real_data: Getting real GPS data (placeholder)\n");
+	LOG_D(TAG, "Getting real GPS data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_coolant_temp(void)
 {
-	printf("[D] real_data: Getting real coolant temp data (placeholder)\n");
+	LOG_D(TAG, "Getting real coolant temp data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_voltage_monitor(void)
 {
-	printf("[D] real_data: Getting real voltage monitor data (placeholder)\n");
+	LOG_D(TAG, "Getting real voltage monitor data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_tpms(void)
 {
-	printf("[D] real_data: Getting real TPMS data (placeholder)\n");
+	LOG_D(TAG, "Getting real TPMS data (placeholder)");
 	return NULL;
 }
 
 void* real_data_get_compressor_controller(void)
 {
-	printf("[D] real_data: Getting real compressor controller data (placeholder)\n");
+	LOG_D(TAG, "Getting real compressor controller data (placeholder)");
 	return NULL;
 }
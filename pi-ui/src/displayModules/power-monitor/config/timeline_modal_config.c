@@ -1,7 +1,10 @@
 #include "timeline_modal_config.h"
 #include "../../../state/device_state.h"
+#include "../../../utils/log.h"
 #include <stdio.h>
 
+static const char *TAG = "power_monitor";
+
 // Timeline option configurations
 const timeline_option_config_t power_monitor_timeline_options[TIMELINE_COUNT] = {
 	[TIMELINE_30_SECONDS] = {
@@ -83,7 +86,7 @@ const timeline_modal_config_t power_monitor_timeline_modal_config = {
 // Power monitor timeline changed callback
 void power_monitor_timeline_changed_callback(int gauge_index, int duration_seconds, bool is_current_view)
 {
-	printf("[I] power_monitor: Timeline changed for gauge %d to %d seconds (%s view)\n",
+	LOG_I(TAG, "Timeline changed for gauge %d to %d seconds (%s view)",
 		   gauge_index, duration_seconds, is_current_view ? "current" : "detail");
 
 	// Map gauge index to data type
@@ -96,7 +99,7 @@ void power_monitor_timeline_changed_callback(int gauge_index, int duration_secon
 		case 4: gauge_type = POWER_MONITOR_DATA_SOLAR_VOLTAGE; break;
 		case 5: gauge_type = POWER_MONITOR_DATA_SOLAR_CURRENT; break;
 		default:
-			printf("[E] power_monitor: Invalid gauge index %d\n", gauge_index);
+			LOG_E(TAG, "Invalid gauge index %d", gauge_index);
 			return;
 	}
 
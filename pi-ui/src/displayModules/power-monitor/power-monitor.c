@@ -13,6 +13,8 @@
 #include "../../data/mock_data/mock_data.h"
 #include "../../data/lerp_data/lerp_data.h"
 #include "../../data/config.h"
+#include "../../utils/time_source.h"
+#include "../../utils/trace.h"
 
 // Views
 #include "views/voltage_grid_view/voltage_grid_view.h"
@@ -75,6 +77,7 @@ extern single_value_bar_graph_view_state_t* single_view_solar_power;
 #include "../../screens/screen_manager.h"
 #include "../../screens/detail_screen/detail_screen.h"
 #include "../../screens/home_screen/home_screen.h"
+#include "../../screens/screen_transition.h"
 
 // Module Configurations
 #include "config/battery_alerts_config.h"
@@ -82,7 +85,9 @@ extern single_value_bar_graph_view_state_t* single_view_solar_power;
 
 // UI Styling
 #include "../../displayModules/shared/palette.h"
+#include "../../fonts/app_fonts.h"
 #include "../../fonts/lv_font_noplato_24.h"
+#include "../../utils/log.h"
 
 
 // Power monitor data defaults
@@ -180,7 +185,7 @@ static power_monitor_view_type_t get_current_view_type(void)
 	int view_index = power_monitor_get_view_index();
 
 	if (view_index < 0 || view_index >= POWER_MONITOR_VIEW_COUNT) {
-		printf("[E] power_monitor: Invalid view index: %d (total: %d)\n", view_index, POWER_MONITOR_VIEW_COUNT);
+		LOG_E(TAG, "Invalid view index: %d (total: %d)", view_index, POWER_MONITOR_VIEW_COUNT);
 		return POWER_MONITOR_VIEW_BAR_GRAPH; // Default fallback
 	}
 
@@ -197,14 +202,14 @@ static void power_monitor_navigation_cycle_to_next_view(void)
 
 	// Get current index from device state
 	int current_index = power_monitor_get_view_index();
-	printf("[I] power_monitor: Before cycle: index=%d, total_views=%d\n", current_index, POWER_MONITOR_VIEW_COUNT);
+	LOG_I(TAG, "Before cycle: index=%d, total_views=%d", current_index, POWER_MONITOR_VIEW_COUNT);
 
 	// Simple wrap-around logic
 	int next_index = (current_index + 1) % POWER_MONITOR_VIEW_COUNT;
 
 	// Update device state directly
 	power_monitor_set_view_index(next_index);
-	printf("[I] power_monitor: View cycle complete - updated from index %d to %d\n", current_index, next_index);
+	LOG_I(TAG, "View cycle complete - updated from index %d to %d", current_index, next_index);
 }
 
 // Callback to request home screen after LVGL cleanup
@@ -234,12 +239,12 @@ static void power_monitor_destroy_detail_screen_timer_cb(lv_timer_t* timer)
 static void power_monitor_navigation_hide_detail_screen(void)
 {
 	if (s_ui_state.navigation_teardown_in_progress) {
-		printf("[W] power_monitor: Navigation teardown in progress, ignoring hide request\n");
+		LOG_W(TAG, "Navigation teardown in progress, ignoring hide request");
 		return;
 	}
 	s_ui_state.navigation_teardown_in_progress = true;
 	if (s_detail_destroy_pending) {
-		printf("[W] power_monitor: Destroy already pending, ignoring duplicate request\n");
+		LOG_W(TAG, "Destroy already pending, ignoring duplicate request");
 		return; // keep teardown flag set until callback clears
 	}
 	s_detail_destroy_pending = true;
@@ -253,12 +258,12 @@ static void power_monitor_navigation_hide_detail_screen(void)
 
 static void power_monitor_navigation_request_home_screen(void)
 {
-	printf("[I] power_monitor: About to request home screen transition\n");
+	LOG_I(TAG, "About to request home screen transition");
 	extern void screen_navigation_request_home_screen(void);
-	printf("[I] power_monitor: Calling screen_navigation_request_home_screen\n");
+	LOG_I(TAG, "Calling screen_navigation_request_home_screen");
 	screen_navigation_request_home_screen();
-	printf("[I] power_monitor: Home screen transition requested\n");
-	printf("[I] power_monitor: power_monitor_navigation_request_home_screen completed\n");
+	LOG_I(TAG, "Home screen transition requested");
+	LOG_I(TAG, "power_monitor_navigation_request_home_screen completed");
 }
 
 
@@ -271,7 +276,7 @@ static lv_obj_t* power_monitor_container = NULL;
 static void power_monitor_init_widget(void)
 {
 	if (power_monitor_container) {
-		printf("[I] power_monitor: Container already initialized\n");
+		LOG_I(TAG, "Container already initialized");
 		return;
 	}
 
@@ -283,7 +288,7 @@ static void power_monitor_init_widget(void)
 	lv_obj_set_style_border_width(power_monitor_container, 0, 0);
 	lv_obj_clear_flag(power_monitor_container, LV_OBJ_FLAG_SCROLLABLE);
 
-	printf("[I] power_monitor: Power monitor container created successfully\n");
+	LOG_I(TAG, "Power monitor container created successfully");
 }
 
 
@@ -293,14 +298,14 @@ void power_monitor_create_current_view_content(lv_obj_t* container)
 
 	if (!container) {
 
-		printf("[E] power_monitor: Container is NULL\n");
+		LOG_E(TAG, "Container is NULL");
 		return;
 	}
 
 	// Safety check: validate container
 	if (!lv_obj_is_valid(container)) {
 
-		printf("[E] power_monitor: Container is not valid\n");
+		LOG_E(TAG, "Container is not valid");
 		return;
 	}
 
@@ -366,7 +371,7 @@ void power_monitor_create_current_view_content(lv_obj_t* container)
 // Simple view cycling - just calls the main cycling function
 static void power_monitor_cycle_view(void)
 {
-	printf("[I] power_monitor: === CYCLING CURRENT VIEW ===\n");
+	LOG_I(TAG, "=== CYCLING CURRENT VIEW ===");
 	power_monitor_cycle_current_view();
 }
 
@@ -641,6 +646,8 @@ gauge_map_entry_t gauge_map[POWER_MONITOR_GAUGE_COUNT] = {
 // Update all persistent gauge histories every frame (data-only, no UI)
 void power_monitor_update_all_gauge_histories(void)
 {
+	TRACE_SCOPE("gauge_histories");
+
 	app_data_store_t* store = app_data_store_get();
 	if (!store) return;
 
@@ -649,9 +656,7 @@ void power_monitor_update_all_gauge_histories(void)
 	lerp_data_get_current(&lerp_data);
 
 	// Get current timestamp
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t current_ms = time_source_ms();
 
 	// Update each gauge instance using the gauge map
 	for (int i = 0; i < POWER_MONITOR_GAUGE_COUNT; i++) {
@@ -757,6 +762,7 @@ void power_monitor_update_all_gauge_histories(void)
 			}
 
 			// Get the current value using function pointer from gauge map
+			TRACE_INSTANT("history_sample");
 			float current_value = entry->data_getter( &lerp_data );
 
 			// Advance head and write to ring buffer
@@ -784,10 +790,10 @@ void power_monitor_update_all_gauge_histories(void)
 // Create 6 bar graph gauges in the gauges container (matching original detail.c)
 static void power_monitor_create_detail_gauges(lv_obj_t* container)
 {
-	printf("[D] power_monitor_create_detail_gauges: CALLED with container=%p\n", (void*)container);
+	LOG_D(TAG, "CALLED with container=%p", (void*)container);
 
 	if (!container) {
-		printf("[E] power_monitor: Gauges container is NULL\n");
+		LOG_E(TAG, "Gauges container is NULL");
 		return;
 	}
 
@@ -801,7 +807,7 @@ static void power_monitor_create_detail_gauges(lv_obj_t* container)
 	// Check for valid dimensions
 	if (container_width <= 0 || container_height <= 0) {
 
-		printf("[E] power_monitor: Invalid container dimensions: %dx%d\n", container_width, container_height);
+		LOG_E(TAG, "Invalid container dimensions: %dx%d", container_width, container_height);
 		return;
 	}
 
@@ -809,7 +815,7 @@ static void power_monitor_create_detail_gauges(lv_obj_t* container)
 	int gauge_padding = 12; // Padding between gauges
 	lv_coord_t gauge_width = container_width;  // Full width
 	lv_coord_t gauge_height = (container_height - (gauge_padding * 6)) / 6;
-	printf("[D] power_monitor: Gauge width: %d, Gauge height: %d\n", gauge_width, gauge_height);
+	LOG_D(TAG, "Gauge width: %d, Gauge height: %d", gauge_width, gauge_height);
 
 	// Get gauge initial configuration values from device state
 	// Voltage gauges
@@ -858,7 +864,7 @@ static void power_monitor_create_detail_gauges(lv_obj_t* container)
 		// Calculate Y position for this gauge
 		int y_pos = i * (gauge_height + gauge_padding);
 
-		printf("[D] power_monitor: Creating gauge %d at position (%d, %d) size %dx%d\n",
+		LOG_D(TAG, "Creating gauge %d at position (%d, %d) size %dx%d",
 			i, 0, y_pos, gauge_width, gauge_height);
 
 		// Initialize gauge with manual positioning
@@ -907,9 +913,7 @@ static void power_monitor_apply_current_view_alert_flashing(void)
 	int solar_hi = device_state_get_int("power_monitor.solar_alert_high_voltage_v");
 
 	// Blink timing - asymmetric: 1 second on, 0.5 seconds off (1.5 second total cycle)
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	int tick_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	int tick_ms = time_source_ms();
 	bool blink_on = (tick_ms % 1500) < 1000;
 
 	// Apply alert flashing to the currently active view (works for both home and detail screen)
@@ -937,7 +941,7 @@ static void power_monitor_apply_current_view_alert_flashing(void)
 	} else if (current_view >= POWER_MONITOR_VIEW_NUMERICAL && current_view < POWER_MONITOR_VIEW_COUNT) {
 		// Single-value views - alert flashing is handled by the generic single value view component
 	} else {
-		printf("[W] power_monitor: Unknown view type: %d, skipping alert flashing\n", current_view);
+		LOG_W(TAG, "Unknown view type: %d, skipping alert flashing", current_view);
 	}
 }
 
@@ -1278,10 +1282,10 @@ void power_monitor_init(void)
 	extern int module_screen_view_get_view_index(const char *module_name);
 	int current_index = module_screen_view_get_view_index("power-monitor");
 	if (current_index < 0 || current_index >= POWER_MONITOR_VIEW_COUNT) {
-		printf("[I] power_monitor: Setting initial view index to 0 (voltage grid view)\n");
+		LOG_I(TAG, "Setting initial view index to 0 (voltage grid view)");
 		power_monitor_set_view_index(0);
 	} else {
-		printf("[I] power_monitor: Using existing view index %d\n", current_index);
+		LOG_I(TAG, "Using existing view index %d", current_index);
 	}
 
 	// Navigation callbacks removed - using direct function calls
@@ -1318,7 +1322,7 @@ void power_monitor_init(void)
  */
 static void power_monitor_create_in_container(lv_obj_t* container)
 {
-	printf("[I] power_monitor: Creating module UI in container\n");
+	LOG_I(TAG, "Creating module UI in container");
 	if (!container) return;
 
 	// Render the current view directly into the container
@@ -1333,7 +1337,7 @@ static void power_monitor_create_in_container(lv_obj_t* container)
  */
 static void power_monitor_destroy_ui(void)
 {
-	printf("[I] power_monitor: Destroying module UI\n");
+	LOG_I(TAG, "Destroying module UI");
 
 	// Modal handling is now done by individual toggle functions
 
@@ -1396,7 +1400,7 @@ void power_monitor_show_in_container(lv_obj_t *container)
 {
 
 	if (!container) {
-		printf("[E] power_monitor: Container is NULL\n");
+		LOG_E(TAG, "Container is NULL");
 		return;
 	}
 
@@ -1472,7 +1476,7 @@ void power_monitor_cleanup_internal(void)
 	memset(&detail_house_current_gauge, 0, sizeof(bar_graph_gauge_t));
 	memset(&detail_solar_voltage_gauge, 0, sizeof(bar_graph_gauge_t));
 	memset(&detail_solar_current_gauge, 0, sizeof(bar_graph_gauge_t));
-	printf("[I] power_monitor: Detail gauge variables reset\n");
+	LOG_I(TAG, "Detail gauge variables reset");
 }
 
 // Update timeline for a specific gauge instance
@@ -1480,7 +1484,7 @@ void power_monitor_update_gauge_timeline_duration(power_monitor_gauge_type_t gau
 {
 	// Validate gauge type
 	if (gauge_type >= POWER_MONITOR_GAUGE_COUNT) {
-		printf("[E] power_monitor: Invalid gauge type %d\n", gauge_type);
+		LOG_E(TAG, "Invalid gauge type %d", gauge_type);
 		return;
 	}
 
@@ -1617,13 +1621,13 @@ static detail_button_config_t power_monitor_buttons[] = {
 // Callback functions for detail screen
 static void power_monitor_on_current_view_created(lv_obj_t* container)
 {
-	printf("[I] power_monitor: Current view container created callback\n");
+	LOG_I(TAG, "Current view container created callback");
 	power_monitor_create_current_view_content(container);
 }
 
 static void power_monitor_on_gauges_created(lv_obj_t* container)
 {
-	printf("[I] power_monitor: Gauges container created callback\n");
+	LOG_I(TAG, "Gauges container created callback");
 	power_monitor_create_detail_gauges(container);
 	// Force layout so gauges have correct widths
 	if (container && lv_obj_is_valid(container)) {
@@ -1636,27 +1640,33 @@ static void power_monitor_on_gauges_created(lv_obj_t* container)
 
 static void power_monitor_on_sensor_data_created(lv_obj_t* container)
 {
-	printf("[I] power_monitor: Sensor data container created callback\n");
+	LOG_I(TAG, "Sensor data container created callback");
 	power_monitor_create_sensor_labels_in_detail_screen(container);
 }
 
 static void power_monitor_on_view_clicked(void)
 {
-	printf("[I] power_monitor: *** VIEW CLICKED CALLBACK CALLED ***\n");
-	printf("[I] power_monitor: View clicked callback - cycling current view\n");
+	LOG_I(TAG, "*** VIEW CLICKED CALLBACK CALLED ***");
+	LOG_I(TAG, "View clicked callback - cycling current view");
 	power_monitor_cycle_current_view();
-	printf("[I] power_monitor: View cycling call completed\n");
+	LOG_I(TAG, "View cycling call completed");
 }
 
 // Power monitor specific sensor label creation function
 void power_monitor_create_sensor_labels_in_detail_screen(lv_obj_t* container)
 {
 	if (!container) {
-		printf("[E] power_monitor: Container is NULL for sensor labels\n");
+		LOG_E(TAG, "Container is NULL for sensor labels");
 		return;
 	}
 
-	printf("[I] power_monitor: Creating sensor data labels in detail screen\n");
+	LOG_I(TAG, "Creating sensor data labels in detail screen");
+
+	// Values are drawn in noplato_24
+	static const app_font_glyphs_t sensor_glyphs[] = {
+		{ &lv_font_noplato_24, APP_FONT_GLYPHS_NUMBER },
+	};
+	app_fonts_prefetch(sensor_glyphs, 1);
 
 	// Create sensor data labels with horizontal layout (label: value on same line)
 	lv_color_t labelColor = PALETTE_GRAY;
@@ -1723,7 +1733,7 @@ void power_monitor_create_sensor_labels_in_detail_screen(lv_obj_t* container)
 		}
 	}
 
-	printf("[I] power_monitor: Sensor data labels created successfully\n");
+	LOG_I(TAG, "Sensor data labels created successfully");
 }
 
 // Power monitor specific sensor label update function
@@ -1819,10 +1829,10 @@ void power_monitor_update_sensor_labels_in_detail_screen(lv_obj_t* sensor_sectio
 // Detail screen management
 void power_monitor_create_detail_screen(void)
 {
-	printf("[I] power_monitor: === CREATING DETAIL SCREEN (V2) ===\n");
+	LOG_I(TAG, "=== CREATING DETAIL SCREEN (V2) ===");
 
 	if (detail_screen) {
-		printf("[W] power_monitor: Detail screen already exists\n");
+		LOG_W(TAG, "Detail screen already exists");
 		return;
 	}
 
@@ -1846,16 +1856,16 @@ void power_monitor_create_detail_screen(void)
 
 	detail_screen = detail_screen_create(&config);
 	if (detail_screen) {
-		printf("[I] power_monitor: Detail screen created successfully\n");
+		LOG_I(TAG, "Detail screen created successfully");
 		// Content creation is now handled by callbacks
 	} else {
-		printf("[E] power_monitor: Failed to create detail screen\n");
+		LOG_E(TAG, "Failed to create detail screen");
 	}
 }
 
 void power_monitor_show_detail_screen(void)
 {
-	printf("[I] power_monitor: === SHOW DETAIL SCREEN (V2) ===\n");
+	LOG_I(TAG, "=== SHOW DETAIL SCREEN (V2) ===");
 
 	// Always recreate to ensure fresh layout and seeding from device state
 	if (detail_screen) {
@@ -1865,22 +1875,22 @@ void power_monitor_show_detail_screen(void)
 
 	if (detail_screen) {
 		detail_screen_show(detail_screen);
-		printf("[I] power_monitor: Detail screen shown\n");
+		LOG_I(TAG, "Detail screen shown");
 
 		// Debug: Log container size after initial content is added
 		if (detail_screen->current_view_container) {
-			printf("[I] power_monitor: Current view container size after initial content: %dx%d\n",
+			LOG_I(TAG, "Current view container size after initial content: %dx%d",
 				lv_obj_get_width(detail_screen->current_view_container),
 				lv_obj_get_height(detail_screen->current_view_container));
 		}
 	} else {
-		printf("[E] power_monitor: Detail screen unavailable\n");
+		LOG_E(TAG, "Detail screen unavailable");
 	}
 }
 
 void power_monitor_destroy_detail_screen(void)
 {
-	printf("[I] power_monitor: === DESTROY DETAIL SCREEN ===\n");
+	LOG_I(TAG, "=== DESTROY DETAIL SCREEN ===");
 
 	// Clear sensor label references
 	power_monitor_data_t* data = power_monitor_get_data();
@@ -1895,10 +1905,16 @@ void power_monitor_destroy_detail_screen(void)
 	}
 }
 
+// Build job of the detail screen's views, for the screen transition to wait on
+struct ui_build_job* power_monitor_detail_build_job(void)
+{
+	return detail_screen ? &detail_screen->build : NULL;
+}
+
 // Touch event handler for detail screen
 void power_monitor_handle_detail_touch(void)
 {
-		printf("[I] power_monitor: === HANDLE DETAIL TOUCH (V2) ===\n");
+		LOG_I(TAG, "=== HANDLE DETAIL TOUCH (V2) ===");
 	power_monitor_cycle_view();
 }
 
@@ -1917,11 +1933,11 @@ void power_monitor_set_current_view_type(power_monitor_view_type_t view_type)
 		if (available_views[i] == view_type) {
 			// Note: We can't directly set the index in the shared manager
 			// This would require adding a set_index function to the shared manager
-			printf("[I] power_monitor: View type %d found at index %d (setting not implemented)\n", view_type, i);
+			LOG_I(TAG, "View type %d found at index %d (setting not implemented)", view_type, i);
 			return;
 		}
 	}
-	printf("[W] power_monitor: View type %d not found in available views, keeping current\n", view_type);
+	LOG_W(TAG, "View type %d not found in available views, keeping current", view_type);
 }
 
 // System reset function to clear corrupted state
@@ -1931,12 +1947,14 @@ void power_monitor_set_current_view_type(power_monitor_view_type_t view_type)
 // Handle back button - return to home screen
 void power_monitor_handle_back_button(void)
 {
-	printf("[I] power_monitor: === BACK BUTTON CLICKED ===\n");
+	LOG_I(TAG, "=== BACK BUTTON CLICKED ===");
 
-	// Clean up modals before destroying detail screen
-	extern void detail_screen_reset_modal_tracking(void);
+	// Hide modals before destroying detail screen
 	detail_screen_reset_modal_tracking();
 
+	// The detail screen is torn down before home is requested: capture it while it is intact
+	screen_transition_capture();
+
 	// Reset all static variables
 	s_ui_state.rendering_in_progress = false;
 
@@ -1949,22 +1967,15 @@ void power_monitor_handle_back_button(void)
 
 }
 
-// Modal toggle functions using generic detail_screen system
+// Modal toggle functions using generic detail_screen system (pooled modals)
 static void power_monitor_toggle_timeline_modal(void)
 {
-	printf("[I] power_monitor: Toggling timeline modal\n");
-	extern void detail_screen_toggle_modal(const char* modal_name,
-		void* (*create_func)(void* config, void (*on_close)(void)),
-		void (*destroy_func)(void* modal),
-		void (*show_func)(void* modal),
-		bool (*is_visible_func)(void* modal),
-		void* config,
-		void (*on_close_callback)(void));
-
+	LOG_I(TAG, "Toggling timeline modal");
 	detail_screen_toggle_modal("timeline",
 		(void*(*)(void*, void(*)(void)))timeline_modal_create,
 		(void(*)(void*))timeline_modal_destroy,
 		(void(*)(void*))timeline_modal_show,
+		(void(*)(void*))timeline_modal_hide,
 		(bool(*)(void*))timeline_modal_is_visible,
 		(void*)&power_monitor_timeline_modal_config,
 		NULL
@@ -1973,29 +1984,44 @@ static void power_monitor_toggle_timeline_modal(void)
 
 static void power_monitor_toggle_alerts_modal(void)
 {
-	printf("[I] power_monitor: Toggling alerts modal\n");
-	extern void detail_screen_toggle_modal(const char* modal_name,
-		void* (*create_func)(void* config, void (*on_close)(void)),
-		void (*destroy_func)(void* modal),
-		void (*show_func)(void* modal),
-		bool (*is_visible_func)(void* modal),
-		void* config,
-		void (*on_close_callback)(void));
-
+	LOG_I(TAG, "Toggling alerts modal");
 	detail_screen_toggle_modal("alerts",
 		(void*(*)(void*, void(*)(void)))alerts_modal_create,
 		(void(*)(void*))alerts_modal_destroy,
 		(void(*)(void*))alerts_modal_show,
+		(void(*)(void*))alerts_modal_hide,
 		(bool(*)(void*))alerts_modal_is_visible,
 		(void*)&battery_alerts_config,
 		NULL
 	);
 }
 
+// Builds both modals (and the shared numberpad and time input) after boot, so
+// opening them later is a rebind and an unhide
+static void power_monitor_prebuild_modals(void)
+{
+	detail_screen_prebuild_modal("alerts",
+		(void*(*)(void*, void(*)(void)))alerts_modal_create,
+		(void(*)(void*))alerts_modal_destroy,
+		(void(*)(void*))alerts_modal_show,
+		(void(*)(void*))alerts_modal_hide,
+		(bool(*)(void*))alerts_modal_is_visible,
+		(void*)&battery_alerts_config
+	);
+	detail_screen_prebuild_modal("timeline",
+		(void*(*)(void*, void(*)(void)))timeline_modal_create,
+		(void(*)(void*))timeline_modal_destroy,
+		(void(*)(void*))timeline_modal_show,
+		(void(*)(void*))timeline_modal_hide,
+		(bool(*)(void*))timeline_modal_is_visible,
+		(void*)&power_monitor_timeline_modal_config
+	);
+}
+
 // Handle alerts button - simple toggle
 void power_monitor_handle_alerts_button(void)
 {
-	printf("[I] power_monitor: === ALERTS BUTTON CLICKED ===\n");
+	LOG_I(TAG, "=== ALERTS BUTTON CLICKED ===");
 	power_monitor_toggle_alerts_modal();
 }
 
@@ -2004,25 +2030,26 @@ void power_monitor_handle_alerts_button(void)
 // Handle timeline button - simple toggle
 void power_monitor_handle_timeline_button(void)
 {
-	printf("[I] power_monitor: === TIMELINE BUTTON CLICKED ===\n");
+	LOG_I(TAG, "=== TIMELINE BUTTON CLICKED ===");
 	power_monitor_toggle_timeline_modal();
 }
 
 // Simple current view rendering - reuse existing view containers
 void power_monitor_render_current_view(lv_obj_t* container)
 {
-	printf("[I] power_monitor: === RENDER CURRENT VIEW START ===\n");
+	LOG_I(TAG, "=== RENDER CURRENT VIEW START ===");
 
 	// Prevent recursive rendering
 	if (s_ui_state.rendering_in_progress) {
-		printf("[I] power_monitor: Rendering already in progress, skipping\n");
+		LOG_I(TAG, "Rendering already in progress, skipping");
 		return;
 	}
 	s_ui_state.rendering_in_progress = true;
+	TRACE_SCOPE("render_view");
 
-	printf("[I] power_monitor: Rendering flag set, proceeding with view creation\n");
+	LOG_I(TAG, "Rendering flag set, proceeding with view creation");
 
-	printf("[I] power_monitor: === RENDER CURRENT VIEW: About to create view containers ===\n");
+	LOG_I(TAG, "=== RENDER CURRENT VIEW: About to create view containers ===");
 
 	// Make container clickable for touch navigation
 	lv_obj_add_flag(container, LV_OBJ_FLAG_CLICKABLE);
@@ -2031,7 +2058,7 @@ void power_monitor_render_current_view(lv_obj_t* container)
 
 	// Get current view type from shared manager
 	power_monitor_view_type_t current_type = get_current_view_type();
-		printf("[I] power_monitor: Showing view type: %d (index: %d)\n", current_type, current_view_manager_get_index());
+		LOG_I(TAG, "Showing view type: %d (index: %d)", current_type, current_view_manager_get_index());
 
 	// Always render the current view fresh - no complex cleanup logic
 	if (current_type == POWER_MONITOR_VIEW_BAR_GRAPH) {
@@ -2076,17 +2103,17 @@ void power_monitor_render_current_view(lv_obj_t* container)
 
 	// Check if content was actually created
 	int child_count = lv_obj_get_child_cnt(container);
-	printf("[I] power_monitor: After rendering, container has %d children\n", child_count);
+	LOG_I(TAG, "After rendering, container has %d children", child_count);
 
 	// Reset rendering flag
 	s_ui_state.rendering_in_progress = false;
 
 	// CRITICAL: Ensure view state is consistent after rendering
-	printf("[I] power_monitor: === RENDER CURRENT VIEW: Final state check ===\n");
-	printf("[I] power_monitor: Current view type: %d, index: %d\n", current_type, current_view_manager_get_index());
+	LOG_I(TAG, "=== RENDER CURRENT VIEW: Final state check ===");
+	LOG_I(TAG, "Current view type: %d, index: %d", current_type, current_view_manager_get_index());
 	// Global containers removed - no need to check them
 
-	printf("[I] power_monitor: === RENDER CURRENT VIEW COMPLETE ===\n");
+	LOG_I(TAG, "=== RENDER CURRENT VIEW COMPLETE ===");
 }
 
 
@@ -2094,24 +2121,24 @@ void power_monitor_render_current_view(lv_obj_t* container)
 static void power_monitor_home_current_view_touch_cb(lv_event_t * e)
 {
 	lv_event_code_t code = lv_event_get_code(e);
-	printf("[I] power_monitor: *** HOME TOUCH EVENT: code=%d (CLICKED=%d) ***\n", code, LV_EVENT_CLICKED);
+	LOG_I(TAG, "*** HOME TOUCH EVENT: code=%d (CLICKED=%d) ***", code, LV_EVENT_CLICKED);
 
 	if (code != LV_EVENT_CLICKED) {
-		printf("[I] power_monitor: Not a click event, ignoring\n");
+		LOG_I(TAG, "Not a click event, ignoring");
 		return;
 	}
 
 	static int touch_count = 0;
 	touch_count++;
-	printf("[I] power_monitor: *** HOME TOUCH CALLBACK CALLED #%d ***\n", touch_count);
+	LOG_I(TAG, "*** HOME TOUCH CALLBACK CALLED #%d ***", touch_count);
 
 	// Prevent recursive calls
 	if (s_ui_state.reset_in_progress) {
-		printf("[W] power_monitor: Home touch callback ignored - navigation in progress\n");
+		LOG_W(TAG, "Home touch callback ignored - navigation in progress");
 		return;
 	}
 
-	printf("[I] power_monitor: Home current view touched - navigating to detail screen\n");
+	LOG_I(TAG, "Home current view touched - navigating to detail screen");
 
 	// Update detail container with current view before navigating
 	// Detail screen is handled by the detail screen template
@@ -2126,31 +2153,31 @@ static void power_monitor_detail_current_view_touch_cb(lv_event_t * e)
 {
 	static int touch_count = 0;
 	touch_count++;
-	printf("[I] power_monitor: *** DETAIL TOUCH CALLBACK CALLED #%d ***\n", touch_count);
+	LOG_I(TAG, "*** DETAIL TOUCH CALLBACK CALLED #%d ***", touch_count);
 
 	// Debug: Check event details
 	if (e) {
-		printf("[I] power_monitor: Event type: %d, target: %p, current target: %p\n",
+		LOG_I(TAG, "Event type: %d, target: %p, current target: %p",
 			lv_event_get_code(e), lv_event_get_target(e), lv_event_get_current_target(e));
 	}
 
 	// Check if we're actually on the detail screen
 	extern screen_type_t screen_navigation_get_current_screen(void);
 	screen_type_t current_screen = screen_navigation_get_current_screen();
-		printf("[I] power_monitor: Current screen: %d (detail=%d)\n", current_screen, SCREEN_DETAIL_VIEW);
+		LOG_I(TAG, "Current screen: %d (detail=%d)", current_screen, SCREEN_DETAIL_VIEW);
 
 	if (current_screen != SCREEN_DETAIL_VIEW) {
-		printf("[W] power_monitor: Detail touch callback called but not on detail screen, ignoring\n");
+		LOG_W(TAG, "Detail touch callback called but not on detail screen, ignoring");
 		return;
 	}
 
 	// Prevent recursive calls
 	if (s_ui_state.reset_in_progress) {
-		printf("[W] power_monitor: Detail touch callback ignored - navigation in progress\n");
+		LOG_W(TAG, "Detail touch callback ignored - navigation in progress");
 		return;
 	}
 
-	printf("[I] power_monitor: Detail current view touched - cycling views\n");
+	LOG_I(TAG, "Detail current view touched - cycling views");
 	power_monitor_cycle_current_view();
 }
 
@@ -2169,7 +2196,7 @@ static int power_monitor_get_view_index(void)
 
 	// Validate and clamp the index
 	if (index < 0 || index >= POWER_MONITOR_VIEW_COUNT) {
-		printf("[W] power_monitor: Invalid view index %d from device state, using 0\n", index);
+		LOG_W(TAG, "Invalid view index %d from device state, using 0", index);
 		index = 0;
 	}
 
@@ -2183,7 +2210,7 @@ static void power_monitor_set_view_index(int index)
 {
 	// Validate and clamp the index
 	if (index < 0 || index >= POWER_MONITOR_VIEW_COUNT) {
-		printf("[W] power_monitor: Invalid view index %d, clamping to valid range\n", index);
+		LOG_W(TAG, "Invalid view index %d, clamping to valid range", index);
 		index = (index < 0) ? 0 : (POWER_MONITOR_VIEW_COUNT - 1);
 	}
 
@@ -2207,16 +2234,16 @@ static void power_monitor_set_view_index(int index)
 static void power_monitor_destroy_current_view(int old_view_index)
 {
 	if (s_ui_state.view_destroy_in_progress) {
-		printf("[W] power_monitor: View destroy in progress, skipping\n");
+		LOG_W(TAG, "View destroy in progress, skipping");
 		return;
 	}
 	s_ui_state.view_destroy_in_progress = true;
 	int view_index = old_view_index; // Use the old view index that's being destroyed
-	printf("[I] power_monitor: Destroying current view objects for index %d\n", view_index);
+	LOG_I(TAG, "Destroying current view objects for index %d", view_index);
 
 	// CRITICAL: Cleanup gauge canvas buffers BEFORE destroying LVGL objects
 	// This prevents memory leaks from malloc'd canvas buffers
-	printf("[I] power_monitor: Cleaning up gauge canvas buffers before LVGL object destruction\n");
+	LOG_I(TAG, "Cleaning up gauge canvas buffers before LVGL object destruction");
 
 	// Call the appropriate reset function based on current view
 	switch(view_index) {
@@ -2281,14 +2308,14 @@ static void power_monitor_destroy_current_view(int old_view_index)
 			break;
 		}
 		default:
-			printf("[W] power_monitor: Unknown view index %d, no reset function\n", view_index);
+			LOG_W(TAG, "Unknown view index %d, no reset function", view_index);
 			break;
 	}
 
 	// Get the detail screen container to clean
 	extern detail_screen_t* detail_screen;
 	if (detail_screen && detail_screen->current_view_container) {
-		printf("[I] power_monitor: Cleaning current view container\n");
+		LOG_I(TAG, "Cleaning current view container");
 		lv_obj_clean(detail_screen->current_view_container);
 
 		// Re-apply container styling after clean (clean removes styling)
@@ -2298,10 +2325,10 @@ static void power_monitor_destroy_current_view(int old_view_index)
 		lv_obj_set_style_radius(detail_screen->current_view_container, 4, 0);
 		lv_obj_clear_flag(detail_screen->current_view_container, LV_OBJ_FLAG_SCROLLABLE);
 	} else {
-		printf("[W] power_monitor: No detail screen container to clean\n");
+		LOG_W(TAG, "No detail screen container to clean");
 	}
 
-	printf("[I] power_monitor: Current view objects destroyed for index %d\n", view_index);
+	LOG_I(TAG, "Current view objects destroyed for index %d", view_index);
 	s_ui_state.view_destroy_in_progress = false;
 }
 
@@ -2314,7 +2341,7 @@ static void power_monitor_destroy_current_view(int old_view_index)
  */
 static void power_monitor_module_init(void)
 {
-	printf("[I] power_monitor: Power monitor module initializing via standardized interface\n");
+	LOG_I(TAG, "Power monitor module initializing via standardized interface");
 	power_monitor_init();
 }
 
@@ -2353,7 +2380,7 @@ static void power_monitor_module_update(void)
 
 			if( detail_screen && detail_screen->current_view_container ){
 
-				printf("[I] power_monitor: Performing delayed re-render of detail view after cycle\n");
+				LOG_I(TAG, "Performing delayed re-render of detail view after cycle");
 
 				// DESTROY: Properly destroy the current view object
 				// The view index has already been incremented by current_view_manager_cycle_to_next()
@@ -2361,13 +2388,13 @@ static void power_monitor_module_update(void)
 				int current_index = power_monitor_get_view_index();
 				// Calculate previous index (decrement with wrap-around)
 				int old_view_index = (current_index - 1 + POWER_MONITOR_VIEW_COUNT) % POWER_MONITOR_VIEW_COUNT;
-				printf("[I] power_monitor: Switching from view %d to view %d\n", old_view_index, current_index);
+				LOG_I(TAG, "Switching from view %d to view %d", old_view_index, current_index);
 				power_monitor_destroy_current_view(old_view_index);
 
 				// Ensure layout is calculated on parent container before creating new view
 				// Use detail screen's reusable layout preparation function for consistency
 				if (!detail_screen_prepare_current_view_layout(detail_screen)) {
-					printf("[E] power_monitor: Failed to prepare current view layout during cycling\n");
+					LOG_E(TAG, "Failed to prepare current view layout during cycling");
 					s_ui_state.detail_view_needs_refresh = false;
 					return;
 				}
@@ -2391,12 +2418,23 @@ static void power_monitor_module_update(void)
 	}
 }
 
+/**
+ * @brief Standardized module prebuild function
+ *
+ * Called once after boot: builds the UI this module reuses.
+ */
+static void power_monitor_module_prebuild(void)
+{
+	power_monitor_prebuild_modals();
+}
+
 /**
  * @brief Standardized module cleanup function
  */
 static void power_monitor_module_cleanup(void)
 {
-	printf("[I] power_monitor: Power monitor module cleaning up via standardized interface\n");
+	LOG_I(TAG, "Power monitor module cleaning up via standardized interface");
+	detail_screen_destroy_modals();
 	power_monitor_cleanup();
 }
 
@@ -2410,5 +2448,6 @@ const display_module_t power_monitor_module = {
 	.name = "power-monitor",
 	.init = power_monitor_module_init,
 	.update = power_monitor_module_update,
+	.prebuild = power_monitor_module_prebuild,
 	.cleanup = power_monitor_module_cleanup
 };
\ No newline at end of file
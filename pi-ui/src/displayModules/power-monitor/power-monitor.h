@@ -11,6 +11,7 @@
 // Forward declarations
 struct detail_screen_t;
 struct display_module_base_s;
+struct ui_build_job;
 
 // Structure to store sensor value label references
 typedef struct {
@@ -81,6 +82,7 @@ power_monitor_data_t* power_monitor_get_data(void);
 void power_monitor_cleanup(void);
 void power_monitor_show_detail_screen(void);
 void power_monitor_destroy_detail_screen(void);
+struct ui_build_job* power_monitor_detail_build_job(void);  // NULL without a detail screen
 
 // New standardized lifecycle
 void power_monitor_create(void);   // once: initialize UI elements and data
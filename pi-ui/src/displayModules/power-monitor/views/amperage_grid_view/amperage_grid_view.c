@@ -13,13 +13,20 @@
 #include "../../../shared/utils/warning_icon/warning_icon.h"
 
 #include "../../../shared/palette.h"
+#include "../../../../fonts/app_fonts.h"
 #include "../../../../fonts/lv_font_noplato_24.h"
 
 // Device state for JSON-backed history
 #include "../../../../state/device_state.h"
+#include "../../../../utils/log.h"
 
 static const char *TAG = "amperage_grid_view";
 
+// Glyphs drawn in the app fonts: the value labels
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_24, APP_FONT_GLYPHS_NUMBER },
+};
+
 // View initialization flag
 static bool s_view_initialized = false;
 
@@ -176,7 +183,9 @@ static int s_current_editing_gauge = -1; // -1 = none, 0 = starter, 1 = house, 2
 
 void power_monitor_amperage_grid_view_render(lv_obj_t *container)
 {
-	printf("[D] amperage_grid_view: power_monitor_amperage_grid_view_render called\n");
+	LOG_D(TAG, "power_monitor_amperage_grid_view_render called");
+
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
 
 	// Reset view state
 	s_view_initialized = false;
@@ -208,10 +217,10 @@ void power_monitor_amperage_grid_view_render(lv_obj_t *container)
 	lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
 
 	// Use the corrected container dimensions
-	printf("[I] amperage_grid_view: Amperage grid container dimensions: %dx%d\n", container_width, container_height);
+	LOG_I(TAG, "Amperage grid container dimensions: %dx%d", container_width, container_height);
 
 	// Use the container as-is - don't resize it!
-	printf("[I] amperage_grid_view: Using container dimensions as-is: %dx%d\n", container_width, container_height);
+	LOG_I(TAG, "Using container dimensions as-is: %dx%d", container_width, container_height);
 
 	// Set up flexbox for the main container (vertical stack)
 	lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
@@ -222,7 +231,7 @@ void power_monitor_amperage_grid_view_render(lv_obj_t *container)
 	// Calculate gauge dimensions using configuration (match power_grid_view)
 	int gauge_height = (container_height - CONTAINER_PADDING_PX * 2) / 3;
 
-	printf("[D] amperage_grid_view: Container dimensions: %dx%d, gauge_height=%d\n", container_width, container_height, gauge_height);
+	LOG_D(TAG, "Container dimensions: %dx%d, gauge_height=%d", container_width, container_height, gauge_height);
 
 	// Read actual gauge configuration values from device state
 	float starter_baseline = device_state_get_float("power_monitor.starter_baseline_current_a");
@@ -480,7 +489,7 @@ void power_monitor_amperage_grid_view_update_configuration(void)
 {
 	if (!s_view_initialized) return;
 
-	printf("[I] voltage_grid_view: Updating power grid view gauge configuration...\n");
+	LOG_I(TAG, "Updating power grid view gauge configuration...");
 
 	// Read actual gauge configuration values from device state
 	float starter_baseline = device_state_get_float("power_monitor.starter_baseline_current_a");
@@ -14,6 +14,7 @@
 #include "../../../../data/lerp_data/lerp_data.h"
 #include "../../../../state/device_state.h"
 #include "../../../shared/utils/number_formatting/number_formatting.h"
+#include "../../../../utils/log.h"
 
 static const char *TAG = "house_power_view";
 
@@ -60,13 +61,13 @@ static void compute_house_power_bounds(float* min_power, float* baseline_power,
 	*baseline_power = voltage_baseline * current_baseline;
 	*max_power = voltage_max * current_max;
 
-	printf("[D] house_power_view: Computed power bounds: min=%.1fW, baseline=%.1fW, max=%.1fW\n",
+	LOG_D(TAG, "Computed power bounds: min=%.1fW, baseline=%.1fW, max=%.1fW",
 		*min_power, *baseline_power, *max_power);
 }
 
 void power_monitor_house_power_view_render(lv_obj_t *container)
 {
-	printf("[D] house_power_view_render: Starting\n");
+	LOG_D(TAG, "Starting");
 	if (!container || !lv_obj_is_valid(container)) {
 		return;
 	}
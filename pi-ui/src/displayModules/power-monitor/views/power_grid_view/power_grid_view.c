@@ -5,6 +5,7 @@
 #include "power_grid_view.h"
 
 #include "../../../../state/device_state.h"
+#include "../../../../utils/log.h"
 #include "../../../../data/lerp_data/lerp_data.h"
 #include "../../../../app_data_store.h"
 
@@ -13,6 +14,7 @@
 #include "../../../shared/utils/warning_icon/warning_icon.h"
 
 #include "../../../shared/palette.h"
+#include "../../../../fonts/app_fonts.h"
 #include "../../../../fonts/lv_font_noplato_24.h"
 
 // Device state for JSON-backed history
@@ -20,6 +22,11 @@
 
 static const char *TAG = "power_grid_view";
 
+// Glyphs drawn in the app fonts: the value labels
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_24, APP_FONT_GLYPHS_NUMBER },
+};
+
 // View initialization flag
 static bool s_view_initialized = false;
 
@@ -78,11 +85,11 @@ static void compute_power_bounds(const char* base_name, float* min_power, float*
 	*baseline_power = voltage_baseline * current_baseline;
 	*max_power = voltage_max * current_max;
 
-	printf("[D] power_grid_view: Computed power bounds for %s: min=%.1fW, baseline=%.1fW, max=%.1fW\n",
+	LOG_D(TAG, "Computed power bounds for %s: min=%.1fW, baseline=%.1fW, max=%.1fW",
 		base_name, *min_power, *baseline_power, *max_power);
-	printf("[D] power_grid_view: Voltage bounds: min=%.1fV, baseline=%.1fV, max=%.1fV\n",
+	LOG_D(TAG, "Voltage bounds: min=%.1fV, baseline=%.1fV, max=%.1fV",
 		voltage_min, voltage_baseline, voltage_max);
-	printf("[D] power_grid_view: Current bounds: min=%.1fA, baseline=%.1fA, max=%.1fA\n",
+	LOG_D(TAG, "Current bounds: min=%.1fA, baseline=%.1fA, max=%.1fA",
 		current_min, current_baseline, current_max);
 }
 
@@ -235,7 +242,9 @@ static void format_wattage_display(float watts, char* buffer, size_t buffer_size
 
 void power_monitor_power_grid_view_render(lv_obj_t *container)
 {
-	printf("[D] power_grid_view: power_monitor_power_grid_view_render called\n");
+	LOG_D(TAG, "power_monitor_power_grid_view_render called");
+
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
 
 	// Reset view state
 	s_view_initialized = false;
@@ -267,10 +276,10 @@ void power_monitor_power_grid_view_render(lv_obj_t *container)
 	lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
 
 	// Use the corrected container dimensions
-	printf("[I] power_grid_view: Power grid container dimensions: %dx%d\n", container_width, container_height);
+	LOG_I(TAG, "Power grid container dimensions: %dx%d", container_width, container_height);
 
 	// Use the container as-is - don't resize it!
-	printf("[I] power_grid_view: Using container dimensions as-is: %dx%d\n", container_width, container_height);
+	LOG_I(TAG, "Using container dimensions as-is: %dx%d", container_width, container_height);
 
 	// Set up flexbox for the main container (vertical stack)
 	lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
@@ -281,7 +290,7 @@ void power_monitor_power_grid_view_render(lv_obj_t *container)
 	// Calculate gauge dimensions using configuration
 	int gauge_height = (container_height - CONTAINER_PADDING_PX* 2) / 3;
 
-	printf("[D] power_grid_view: Container dimensions: %dx%d, gauge_height=%d\n", container_width, container_height, gauge_height);
+	LOG_D(TAG, "Container dimensions: %dx%d, gauge_height=%d", container_width, container_height, gauge_height);
 
 	// Compute power bounds from voltage and current sensor values
 	float starter_min, starter_baseline, starter_max;
@@ -508,7 +517,7 @@ void power_monitor_power_grid_view_update_configuration(void)
 {
 	if (!s_view_initialized) return;
 
-	printf("[I] power_grid_view: Updating power grid view gauge configuration...\n");
+	LOG_I(TAG, "Updating power grid view gauge configuration...");
 
 	// Compute power bounds from voltage and current sensor values
 	float starter_min, starter_baseline, starter_max;
@@ -14,6 +14,7 @@
 #include "../../../../data/lerp_data/lerp_data.h"
 #include "../../../../state/device_state.h"
 #include "../../../shared/utils/number_formatting/number_formatting.h"
+#include "../../../../utils/log.h"
 
 static const char *TAG = "solar_voltage_view";
 
@@ -22,7 +23,7 @@ single_value_bar_graph_view_state_t* single_view_solar_voltage = NULL;
 
 void power_monitor_solar_voltage_view_render(lv_obj_t *container)
 {
-	printf("[D] solar_voltage_view_render: Starting\n");
+	LOG_D(TAG, "Starting");
 	if (!container || !lv_obj_is_valid(container)) {
 		return;
 	}
@@ -15,6 +15,7 @@
 #include "../../../../data/lerp_data/lerp_data.h"
 #include "../../../../state/device_state.h"
 #include "../../../shared/utils/number_formatting/number_formatting.h"
+#include "../../../../utils/log.h"
 
 static const char *TAG = "starter_current_view";
 
@@ -23,7 +24,7 @@ single_value_bar_graph_view_state_t* single_view_starter_current = NULL;
 
 void power_monitor_starter_current_view_render(lv_obj_t *container)
 {
-	printf("[D] starter_current_view_render: Starting\n");
+	LOG_D(TAG, "Starting");
 	if (!container || !lv_obj_is_valid(container)) {
 		return;
 	}
@@ -13,6 +13,7 @@
 
 #include "../../../../data/lerp_data/lerp_data.h"
 #include "../../../../state/device_state.h"
+#include "../../../../utils/log.h"
 
 static const char *TAG = "starter_voltage_view";
 
@@ -21,7 +22,7 @@ single_value_bar_graph_view_state_t* single_view_starter_voltage = NULL;
 
 void power_monitor_starter_voltage_view_render(lv_obj_t *container)
 {
-	printf("[D] starter_voltage_view_render: Starting\n");
+	LOG_D(TAG, "Starting");
 	if (!container || !lv_obj_is_valid(container)) {
 		return;
 	}
@@ -4,6 +4,10 @@
 #include "../../../../app_data_store.h"
 #include "../../../../../lvgl/src/misc/lv_text_private.h"
 #include "../../utils/number_formatting/number_formatting.h"
+#include "../../../../utils/mem_region.h"
+#include "../../../../utils/time_source.h"
+#include "../../../../utils/trace.h"
+#include "../../../../utils/log.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -16,6 +20,11 @@ static const char *TAG = "bar_graph_gauge";
 // Forward declarations
 static void bar_graph_gauge_shift_one_px(bar_graph_gauge_t *gauge);
 static void bar_graph_gauge_tick_cb(lv_timer_t *timer);
+static void bar_graph_gauge_update_value_map(bar_graph_gauge_t *gauge);
+static void bar_graph_gauge_mark_scrolled(bar_graph_gauge_t *gauge, int shift_px);
+static void bar_graph_gauge_mark_drawn(bar_graph_gauge_t *gauge, bar_graph_span_t span);
+static void bar_graph_gauge_mark_cleared(bar_graph_gauge_t *gauge);
+static void bar_graph_gauge_invalidate_dirty(bar_graph_gauge_t *gauge);
 
 
 void bar_graph_gauge_init(
@@ -30,13 +39,13 @@ void bar_graph_gauge_init(
 	int bar_gap
 ){
 	if (!gauge || !parent) {
-		printf("[E] bar_graph_gauge: Invalid parameters: gauge=%p, parent=%p\n", gauge, parent);
+		LOG_E(TAG, "Invalid parameters: gauge=%p, parent=%p", gauge, parent);
 		return;
 	}
 
 	// Check if parent is valid
 	if (!lv_obj_is_valid(parent)) {
-		printf("[E] bar_graph_gauge: Parent object is not valid\n");
+		LOG_E(TAG, "Parent object is not valid");
 		return;
 	}
 
@@ -335,12 +344,15 @@ void bar_graph_gauge_configure_advanced(
 	gauge->cached_draw_width = canvas_width - 4;
 	gauge->cached_draw_height = gauge->show_border ? canvas_height - 4 : canvas_height;
 
+	// Precompute value -> pixel mapping for the new range and canvas height
+	bar_graph_gauge_update_value_map(gauge);
+
 	lv_obj_set_size(gauge->canvas, canvas_width, gauge->cached_draw_height);
 	lv_obj_align_to(gauge->canvas, gauge->canvas_container, LV_ALIGN_LEFT_MID, 0, 0);
 	lv_obj_update_layout(gauge->canvas);
 
-	// Now set up the canvas buffer with the correct size
-	gauge->canvas_buffer = malloc(gauge->cached_draw_width * gauge->cached_draw_height * sizeof(lv_color_t));
+	// Now set up the canvas buffer with the correct size, in the region of the screen being built
+	gauge->canvas_buffer = mem_region_alloc_current(gauge->cached_draw_width * gauge->cached_draw_height * sizeof(lv_color_t));
 	lv_canvas_set_buffer(
 		gauge->canvas, gauge->canvas_buffer,
 		gauge->cached_draw_width, gauge->cached_draw_height,
@@ -466,6 +478,91 @@ void bar_graph_gauge_configure_advanced(
 }
 
 
+// Rebuild the cached value -> pixel mapping from the current range and canvas height.
+// Called whenever configure_advanced sets (or resets) the range, so the draw paths never
+// recompute scales per column.
+static void bar_graph_gauge_update_value_map(bar_graph_gauge_t *gauge)
+{
+	int top_y = 2;
+	int bottom_y = gauge->cached_draw_height - 5;
+	int h = bottom_y - top_y + 1;
+
+	bar_graph_kernel_map_release(&gauge->value_map);
+	bar_graph_kernel_map_init(
+		&gauge->value_map, gauge->mode == BAR_GRAPH_MODE_BIPOLAR,
+		gauge->baseline_value, gauge->init_min_value, gauge->init_max_value,
+		top_y, h
+	);
+
+	// Out-of-cap ranges keep the float path
+	bar_graph_kernel_map_build_lut(&gauge->value_map);
+}
+
+static bar_graph_span_t bar_graph_gauge_span_union(bar_graph_span_t a, bar_graph_span_t b)
+{
+	if (a.y_start >= a.y_end) return b;
+	if (b.y_start >= b.y_end) return a;
+	if (b.y_start < a.y_start) a.y_start = b.y_start;
+	if (b.y_end > a.y_end) a.y_end = b.y_end;
+	return a;
+}
+
+// Canvas content moved left: every row that can hold bar pixels has to be redrawn
+static void bar_graph_gauge_mark_scrolled(bar_graph_gauge_t *gauge, int shift_px)
+{
+	bar_graph_span_t ink = bar_graph_gauge_span_union(gauge->ink_prev, gauge->ink_cur);
+	gauge->dirty_rows = bar_graph_gauge_span_union(gauge->dirty_rows, ink);
+
+	if (shift_px >= gauge->cached_draw_width) {
+
+		// Whole canvas scrolled out
+		gauge->ink_prev = gauge->ink_cur = (bar_graph_span_t){ 0, 0 };
+		gauge->ink_scrolled_px = 0;
+		return;
+	}
+
+	gauge->ink_scrolled_px += shift_px;
+	if (gauge->ink_scrolled_px >= gauge->cached_draw_width) {
+
+		// Everything drawn before the previous window has scrolled off the canvas
+		gauge->ink_prev = gauge->ink_cur;
+		gauge->ink_cur = (bar_graph_span_t){ 0, 0 };
+		gauge->ink_scrolled_px = 0;
+	}
+}
+
+static void bar_graph_gauge_mark_drawn(bar_graph_gauge_t *gauge, bar_graph_span_t span)
+{
+	gauge->ink_cur = bar_graph_gauge_span_union(gauge->ink_cur, span);
+	gauge->dirty_rows = bar_graph_gauge_span_union(gauge->dirty_rows, span);
+}
+
+static void bar_graph_gauge_mark_cleared(bar_graph_gauge_t *gauge)
+{
+	bar_graph_span_t ink = bar_graph_gauge_span_union(gauge->ink_prev, gauge->ink_cur);
+	gauge->dirty_rows = bar_graph_gauge_span_union(gauge->dirty_rows, ink);
+	gauge->ink_prev = gauge->ink_cur = (bar_graph_span_t){ 0, 0 };
+	gauge->ink_scrolled_px = 0;
+}
+
+// Invalidate only the canvas rows touched since the last call (full drawn width), instead of
+// leaving LVGL to repaint the whole gauge or screen
+static void bar_graph_gauge_invalidate_dirty(bar_graph_gauge_t *gauge)
+{
+	bar_graph_span_t rows = gauge->dirty_rows;
+	gauge->dirty_rows = (bar_graph_span_t){ 0, 0 };
+
+	if (rows.y_start >= rows.y_end) return;
+	if (!gauge->canvas || !lv_obj_is_valid(gauge->canvas)) return;
+
+	lv_area_t area;
+	lv_obj_get_coords(gauge->canvas, &area);
+	area.x2 = area.x1 + gauge->cached_draw_width - 1;
+	area.y2 = area.y1 + rows.y_end - 1;
+	area.y1 = area.y1 + rows.y_start;
+	lv_obj_invalidate_area(gauge->canvas, &area);
+}
+
 // Force complete current animation by fast-forwarding to end state
 void bar_graph_gauge_force_complete_animation(bar_graph_gauge_t *gauge)
 {
@@ -496,30 +593,22 @@ void bar_graph_gauge_force_complete_animation(bar_graph_gauge_t *gauge)
 			gauge->last_rendered_head = gauge_data_history->head;
 		}
 	}
+
+	bar_graph_gauge_invalidate_dirty(gauge);
 }
 
 static void bar_graph_gauge_shift_one_px(bar_graph_gauge_t *gauge)
 {
+	TRACE_SCOPE("gauge_shift_px");
 	int canvas_width = gauge->cached_draw_width;
 	int top_y = 2;
 	int bottom_y = gauge->cached_draw_height - 5;
 	int h = bottom_y - top_y + 1;
 	int bar_area_width = canvas_width;
 
-	// shift left by 1 pixel across visible rows
-	for (int row = 0; row < h; row++) {
-		int actual_row = top_y + row;
-		memmove(
-			&gauge->canvas_buffer[actual_row * canvas_width],
-			&gauge->canvas_buffer[actual_row * canvas_width + 1],
-			(bar_area_width - 1) * sizeof(lv_color_t)
-		);
-		// Clear rightmost pixel
-		gauge->canvas_buffer[actual_row * canvas_width + (bar_area_width - 1)] = PALETTE_BLACK;
-	}
-
-	// Debug: show current scroll state before drawing
-	// logging removed
+	// shift left by 1 pixel across visible rows, clearing the rightmost column
+	bar_graph_kernel_shift_rows(gauge->canvas_buffer, canvas_width, top_y, top_y + h, 1, PALETTE_BLACK);
+	bar_graph_gauge_mark_scrolled(gauge, 1);
 
 	// Draw rightmost column using time-based easing per bar: constant height for all columns in this bar
 	int x = bar_area_width - 1; // rightmost column index
@@ -536,58 +625,12 @@ static void bar_graph_gauge_shift_one_px(bar_graph_gauge_t *gauge)
 			if (v > gauge->init_max_value) v = gauge->init_max_value;
 			gauge->bar_draw_value = v;
 			gauge->bar_draw_value_valid = true;
-			// logging removed
-		}
-
-		float val = gauge->bar_draw_value;
-
-		// Clamp to visible range
-		if (val < gauge->init_min_value) val = gauge->init_min_value;
-		if (val > gauge->init_max_value) val = gauge->init_max_value;
-
-		int baseline_y;
-		float scale = 1.0f;
-		float scale_min = 1.0f, scale_max = 1.0f;
-		if (gauge->mode == BAR_GRAPH_MODE_BIPOLAR) {
-			float dist_min = gauge->baseline_value - gauge->init_min_value;
-			float dist_max = gauge->init_max_value - gauge->baseline_value;
-			scale_min = (dist_min > 0) ? (float)(h - 2) / (2.0f * dist_min) : 1.0f;
-			scale_max = (dist_max > 0) ? (float)(h - 2) / (2.0f * dist_max) : 1.0f;
-			baseline_y = h / 2;
-		} else {
-			float range = gauge->init_max_value - gauge->init_min_value;
-			scale = (float)(h - 2) / (range > 0 ? range : 1.0f);
-			baseline_y = h - 1;
-		}
-
-		int y1, y2;
-		if (gauge->mode == BAR_GRAPH_MODE_POSITIVE_ONLY) {
-			int bar_height = (int)((val - gauge->init_min_value) * scale);
-			y1 = h - bar_height;
-			y2 = h;
-		} else {
-			if (val >= gauge->baseline_value) {
-				int bar_height = (int)((val - gauge->baseline_value) * scale_max);
-				y1 = baseline_y - bar_height;
-				y2 = baseline_y;
-			} else {
-				int bar_height = (int)((gauge->baseline_value - val) * scale_min);
-				y1 = baseline_y;
-				y2 = baseline_y + bar_height;
-			}
 		}
 
-		// Detailed diagnostics for skewed height investigation
-		// logging removed
+		bar_graph_span_t span = bar_graph_kernel_map_value(&gauge->value_map, gauge->bar_draw_value);
+		bar_graph_kernel_fill_span(gauge->canvas_buffer, canvas_width, x, span.y_start, span.y_end, gauge->bar_color);
+		bar_graph_gauge_mark_drawn(gauge, span);
 
-		int y_start = top_y + y1;
-		int y_end = top_y + y2;
-		if (y_start < top_y) y_start = top_y;
-		if (y_end > top_y + h) y_end = top_y + h;
-		// logging removed
-		for (int yy = y_start; yy < y_end; yy++) {
-			gauge->canvas_buffer[yy * canvas_width + x] = gauge->bar_color;
-		}
 		// If we just drew the last column of the bar span, clear cache for next bar
 		if (gauge->scroll_offset_px + 1 >= bar_end) {
 			gauge->bar_draw_value_valid = false;
@@ -616,9 +659,7 @@ static void bar_graph_gauge_tick_cb(lv_timer_t *timer)
 	}
 
 	// Discrete animation mode: advance proportional to elapsed time in this animation
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t now_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t now_ms = time_source_ms();
 	uint32_t elapsed_ms = (gauge->last_tick_ms == 0) ? 0 : (now_ms - gauge->last_tick_ms);
 	gauge->last_tick_ms = now_ms;
 
@@ -658,6 +699,8 @@ static void bar_graph_gauge_tick_cb(lv_timer_t *timer)
 		gauge->anim_pixels_moved++;
 	}
 
+	bar_graph_gauge_invalidate_dirty(gauge);
+
 	if (gauge->scroll_offset_px >= bar_spacing) {
 		gauge->animating = false;
 		gauge->has_pending_sample = false;
@@ -687,7 +730,7 @@ void bar_graph_gauge_add_data_point(bar_graph_gauge_t *gauge, void* gauge_data_h
 
 	// Safety check: don't access null history
 	if (!gauge_data_history_ptr) {
-		printf("[W] bar_graph_gauge: add_data_point called with null history\n");
+		LOG_W(TAG, "add_data_point called with null history");
 		return;
 	}
 
@@ -731,9 +774,7 @@ void bar_graph_gauge_add_data_point(bar_graph_gauge_t *gauge, void* gauge_data_h
 		gauge->next_value = latest_value;
 
 		// Check if we should use cutover jump (immediate shift) or smooth animation
-		struct timespec ts;
-		clock_gettime(CLOCK_MONOTONIC, &ts);
-		uint32_t now_ms = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+		uint32_t now_ms = time_source_ms();
 		uint32_t since_last_ms = (gauge->last_update_ms == 0) ? 0 : (now_ms - gauge->last_update_ms);
 		gauge->last_update_ms = now_ms;
 
@@ -742,6 +783,7 @@ void bar_graph_gauge_add_data_point(bar_graph_gauge_t *gauge, void* gauge_data_h
 		if (per_sample_cutover || gauge->animation_duration_ms == 0) {
 
 			// Immediate shift - no animation
+			TRACE_SCOPE("gauge_shift");
 			int bar_spacing = gauge->bar_width + gauge->bar_gap;
 			int canvas_width = gauge->cached_draw_width;
 			int top_y = 2;
@@ -749,40 +791,26 @@ void bar_graph_gauge_add_data_point(bar_graph_gauge_t *gauge, void* gauge_data_h
 			int h = bottom_y - top_y + 1;
 			int shift_amount = bar_spacing * new_samples;
 
-			// Shift canvas left
-			for (int row = 0; row < h; row++) {
-
-				int actual_row = top_y + row;
-
-				if (shift_amount < canvas_width) {
+			// Shift canvas left and clear the exposed columns
+			bar_graph_kernel_shift_rows(gauge->canvas_buffer, canvas_width, top_y, top_y + h, shift_amount, PALETTE_BLACK);
+			bar_graph_gauge_mark_scrolled(gauge, shift_amount);
 
-					memmove(
-						&gauge->canvas_buffer[actual_row * canvas_width],
-						&gauge->canvas_buffer[actual_row * canvas_width + shift_amount],
-						(canvas_width - shift_amount) * sizeof(lv_color_t)
-					);
+			// Map all new samples in one batch (newest first, drawn from the right edge)
+			float values[MAX_GAUGE_HISTORY];
+			bar_graph_span_t spans[MAX_GAUGE_HISTORY];
+			int bars = new_samples < MAX_GAUGE_HISTORY ? new_samples : MAX_GAUGE_HISTORY;
 
-					// Clear the rightmost area
-					memset(
-						&gauge->canvas_buffer[actual_row * canvas_width + (canvas_width - shift_amount)],
-						0,
-						shift_amount * sizeof(lv_color_t)
-					);
-				} else {
+			for (int i = 0; i < bars; i++) {
 
-					// Shift amount >= canvas width, just clear entire row
-					memset(&gauge->canvas_buffer[actual_row * canvas_width], 0, canvas_width * sizeof(lv_color_t));
-				}
+				int offset = new_samples - 1 - i;
+				int hist_index = (gauge_data_history->head - offset + gauge_data_history->max_count) % gauge_data_history->max_count;
+				values[i] = gauge_data_history->values[hist_index];
 			}
 
-			// Draw the new bars on the right
-			for (int i = 0; i < new_samples; i++) {
+			bar_graph_kernel_map_values(&gauge->value_map, values, bars, spans);
 
-				int offset = new_samples - 1 - i;
-				int hist_index = (gauge_data_history->head - offset + gauge_data_history->max_count) % gauge_data_history->max_count;
-				float val = gauge_data_history->values[hist_index];
-				if (val < gauge->init_min_value) val = gauge->init_min_value;
-				if (val > gauge->init_max_value) val = gauge->init_max_value;
+			// Draw the new bars on the right
+			for (int i = 0; i < bars; i++) {
 
 				// Calculate bar position (from right edge)
 				int x_start = canvas_width - gauge->bar_width - (i * bar_spacing);
@@ -790,67 +818,17 @@ void bar_graph_gauge_add_data_point(bar_graph_gauge_t *gauge, void* gauge_data_h
 				if (x_start < 0 || x_start >= canvas_width) continue;
 				if (x_end > canvas_width) x_end = canvas_width;
 
-				// Calculate bar height
-				int baseline_y, y1, y2;
-				float scale, scale_min = 1.0f, scale_max = 1.0f;
-
-				if (gauge->mode == BAR_GRAPH_MODE_BIPOLAR) {
-
-					float dist_min = gauge->baseline_value - gauge->init_min_value;
-					float dist_max = gauge->init_max_value - gauge->baseline_value;
-					scale_min = (dist_min > 0) ? (float)(h - 2) / (2.0f * dist_min) : 1.0f;
-					scale_max = (dist_max > 0) ? (float)(h - 2) / (2.0f * dist_max) : 1.0f;
-					baseline_y = h / 2;
-				} else {
-
-					float range = gauge->init_max_value - gauge->init_min_value;
-					scale = (float)(h - 2) / (range > 0 ? range : 1.0f);
-					baseline_y = h - 1;
-				}
-
-				if (gauge->mode == BAR_GRAPH_MODE_POSITIVE_ONLY) {
-
-					int bar_height = (int)((val - gauge->init_min_value) * scale);
-					y1 = h - bar_height;
-					y2 = h;
-				} else {
-
-					if (val >= gauge->baseline_value) {
-
-						int bar_height = (int)((val - gauge->baseline_value) * scale_max);
-						y1 = baseline_y - bar_height;
-						y2 = baseline_y;
-					} else {
-
-						int bar_height = (int)((gauge->baseline_value - val) * scale_min);
-						y1 = baseline_y;
-						y2 = baseline_y + bar_height;
-					}
-				}
-
-				// Draw the bar
-				int y_start = top_y + y1;
-				int y_end = top_y + y2;
-				if (y_start < top_y) y_start = top_y;
-				if (y_end > top_y + h) y_end = top_y + h;
-				if (y_end > y_start) {
-
-					lv_color_t color = gauge->bar_color;
-
-					for (int yy = y_start; yy < y_end; yy++) {
-
-						lv_color_t *row_ptr = &gauge->canvas_buffer[yy * canvas_width];
-
-						for (int xx = x_start; xx < x_end; xx++) {
-
-							row_ptr[xx] = color;
-						}
-					}
-				}
+				bar_graph_kernel_fill_rect(
+					gauge->canvas_buffer, canvas_width,
+					x_start, x_end, spans[i].y_start, spans[i].y_end,
+					gauge->bar_color
+				);
+				bar_graph_gauge_mark_drawn(gauge, spans[i]);
 			}
 
 			gauge->last_rendered_head = gauge_data_history->head;
 			gauge->data_added = true;
+			bar_graph_gauge_invalidate_dirty(gauge);
 		} else {
 
 			// Start smooth animation
@@ -956,45 +934,25 @@ void bar_graph_gauge_draw_all_data_snapshot(bar_graph_gauge_t *gauge, int head_s
 {
 	if (!gauge || !gauge->initialized || !gauge->canvas_buffer) return;
 
-	// Use the provided history
-	persistent_gauge_history_t* gauge_data_history = NULL;
-	if (gauge_data_history_ptr) {
-		gauge_data_history = (persistent_gauge_history_t*)gauge_data_history_ptr;
-	}
-
-	// If no persistent history available or no real data, nothing to draw
-	if (!gauge_data_history) {
-		// Clear canvas
-		int canvas_width = gauge->cached_draw_width;
-		int top_y = 2;
-		int bottom_y = gauge->cached_draw_height - 5;
-		int h = bottom_y - top_y + 1;
-		for (int row = 0; row < h; row++) {
-			int actual_row = top_y + row;
-			memset(&gauge->canvas_buffer[actual_row * canvas_width], 0, canvas_width * sizeof(lv_color_t));
-		}
-		return;
-	}
-
-	if (!gauge_data_history->has_real_data) {
-		// Clear canvas
-		int canvas_width = gauge->cached_draw_width;
-		int top_y = 2;
-		int bottom_y = gauge->cached_draw_height - 5;
-		int h = bottom_y - top_y + 1;
-		for (int row = 0; row < h; row++) {
-			int actual_row = top_y + row;
-			memset(&gauge->canvas_buffer[actual_row * canvas_width], 0, canvas_width * sizeof(lv_color_t));
-		}
-		return;
-	}
-
 	// Use the actual canvas width for buffer operations
 	int canvas_width = gauge->cached_draw_width;
 	// Adjust drawing area to match L shape boundaries
 	int top_y = 2; // Match L shape top line
 	int bottom_y = gauge->cached_draw_height - 5; // Match L shape bottom line
 	int h = bottom_y - top_y + 1; // Effective drawing height between L shape lines
+
+	// Clear the entire canvas first
+	bar_graph_kernel_fill_rect(gauge->canvas_buffer, canvas_width, 0, canvas_width, top_y, top_y + h, PALETTE_BLACK);
+	bar_graph_gauge_mark_cleared(gauge);
+
+	// If no persistent history available or no real data, nothing to draw
+	persistent_gauge_history_t* gauge_data_history = (persistent_gauge_history_t*)gauge_data_history_ptr;
+	if (!gauge_data_history || !gauge_data_history->has_real_data) {
+
+		bar_graph_gauge_invalidate_dirty(gauge);
+		return;
+	}
+
 	int bar_spacing = (gauge->bar_width + gauge->bar_gap);
 
 	// Calculate how many bars actually fit in the canvas width
@@ -1008,33 +966,23 @@ void bar_graph_gauge_draw_all_data_snapshot(bar_graph_gauge_t *gauge, int head_s
 	}
 	// Only draw as many bars as we have real data for
 	int actual_bars_to_draw = (real_data_count < max_bars_that_fit) ? real_data_count : max_bars_that_fit;
+	if (actual_bars_to_draw > MAX_GAUGE_HISTORY) actual_bars_to_draw = MAX_GAUGE_HISTORY;
 
-	// Clear the entire canvas first
-	for (int row = 0; row < h; row++) {
-		int actual_row = top_y + row;
-		memset(&gauge->canvas_buffer[actual_row * canvas_width], 0, canvas_width * sizeof(lv_color_t));
-	}
-
-	// Draw all bars from left to right (most recent data on the right)
-	// printf("[D] bar_graph_gauge: Drawing %d bars, head_snapshot=%d\n", actual_bars_to_draw, head_snapshot);
+	// Gather values right-to-left (bar 0 is the most recent, at the right edge)
+	// Walk backwards from SNAPSHOT head to get the most recent N bars
+	float values[MAX_GAUGE_HISTORY];
+	bar_graph_span_t spans[MAX_GAUGE_HISTORY];
 	for (int bar_index = 0; bar_index < actual_bars_to_draw; bar_index++) {
-		// Calculate which history entry to use from ring buffer
-		// Walk backwards from SNAPSHOT head to get the most recent N bars
+
 		int offset = actual_bars_to_draw - 1 - bar_index;
 		int hist_index = (head_snapshot - offset + gauge_data_history->max_count) % gauge_data_history->max_count;
-		float val = gauge_data_history->values[hist_index];
+		values[bar_index] = gauge_data_history->values[hist_index];
+	}
 
-		// printf("[D] bar_graph_gauge: bar %d: hist_index=%d, val=%.2f\n", bar_index, hist_index, val);
+	// Map the whole history in one batch; NaN (empty) slots come back as empty spans
+	bar_graph_kernel_map_values(&gauge->value_map, values, actual_bars_to_draw, spans);
 
-		// Skip drawing if value is NaN (empty/uninitialized)
-		if (isnan(val)) {
-			// printf("[D] bar_graph_gauge: Skipping bar %d - NaN value\n", bar_index);
-			continue;
-		}
-
-		// Clamp value to the visible range
-		if (val < gauge->init_min_value) val = gauge->init_min_value;
-		if (val > gauge->init_max_value) val = gauge->init_max_value;
+	for (int bar_index = 0; bar_index < actual_bars_to_draw; bar_index++) {
 
 		// Calculate bar position (from right edge)
 		int x_start = canvas_width - gauge->bar_width - (bar_index * bar_spacing);
@@ -1042,57 +990,15 @@ void bar_graph_gauge_draw_all_data_snapshot(bar_graph_gauge_t *gauge, int head_s
 		if (x_start >= canvas_width) break; // Don't draw beyond canvas
 		if (x_end > canvas_width) x_end = canvas_width;
 
-
-		// Calculate bar height based on mode
-	int baseline_y;
-	float scale;
-	float scale_min = 1.0f;
-	float scale_max = 1.0f;
-
-	if (gauge->mode == BAR_GRAPH_MODE_BIPOLAR) {
-		float dist_min = gauge->baseline_value - gauge->init_min_value;
-		float dist_max = gauge->init_max_value - gauge->baseline_value;
-		scale_min = (dist_min > 0) ? (float)(h - 2) / (2.0f * dist_min) : 1.0f;
-		scale_max = (dist_max > 0) ? (float)(h - 2) / (2.0f * dist_max) : 1.0f;
-			baseline_y = h / 2;
-	} else {
-		float range = gauge->init_max_value - gauge->init_min_value;
-			scale = (float)(h - 2) / (range > 0 ? range : 1.0f);
-		baseline_y = h - 1;
-	}
-
-	int y1, y2;
-	if (gauge->mode == BAR_GRAPH_MODE_POSITIVE_ONLY) {
-		int bar_height = (int)((val - gauge->init_min_value) * scale);
-		y1 = h - bar_height;
-		y2 = h;
-	} else {
-		if (val >= gauge->baseline_value) {
-			int bar_height = (int)((val - gauge->baseline_value) * scale_max);
-			y1 = baseline_y - bar_height;
-			y2 = baseline_y;
-		} else {
-			int bar_height = (int)((gauge->baseline_value - val) * scale_min);
-			y1 = baseline_y;
-			y2 = baseline_y + bar_height;
-		}
+		bar_graph_kernel_fill_rect(
+			gauge->canvas_buffer, canvas_width,
+			x_start, x_end, spans[bar_index].y_start, spans[bar_index].y_end,
+			gauge->bar_color
+		);
+		bar_graph_gauge_mark_drawn(gauge, spans[bar_index]);
 	}
 
-		// Draw the bar
-	int y_start = top_y + y1;
-		int y_end = top_y + y2;
-	if (y_start < top_y) y_start = top_y;
-	if (y_end > top_y + h) y_end = top_y + h;
-	if (y_end > y_start) {
-		lv_color_t color = gauge->bar_color;
-		for (int yy = y_start; yy < y_end; yy++) {
-			lv_color_t *row_ptr = &gauge->canvas_buffer[yy * canvas_width];
-			for (int xx = x_start; xx < x_end; xx++) {
-				row_ptr[xx] = color;
-			}
-		}
-	}
-	}
+	bar_graph_gauge_invalidate_dirty(gauge);
 }
 
 // Draw all historical data
@@ -1128,10 +1034,12 @@ void bar_graph_gauge_cleanup(bar_graph_gauge_t *gauge)
 		gauge->smooth_timer = NULL;
 	}
 
+	bar_graph_kernel_map_release(&gauge->value_map);
+
 	// Free canvas buffer if it exists
 	if (gauge->canvas_buffer) {
 
-		free(gauge->canvas_buffer);
+		mem_region_free(gauge->canvas_buffer);
 		gauge->canvas_buffer = NULL;
 	}
 
@@ -4,6 +4,7 @@
 #include <lvgl.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "bar_graph_kernels.h"
 
 // Use void* to avoid circular dependency
 
@@ -83,6 +84,14 @@ typedef struct {
 	int cached_draw_height;
 	// Cached range for performance (constant for non-auto-scaling)
 	float cached_range;
+	// Value -> pixel mapping (scales, baseline row, lookup table); rebuilt when the range changes
+	bar_graph_kernel_map_t value_map;
+	// Dirty tracking (canvas rows): rows that can hold bar pixels, split into the current and
+	// previous scroll window so rows empty for a full canvas width drop out, and rows to invalidate
+	bar_graph_span_t ink_prev;
+	bar_graph_span_t ink_cur;
+	int ink_scrolled_px;
+	bar_graph_span_t dirty_rows;
 	uint32_t last_invalidate_time; // Last time widget was invalidated (for rate limiting)
 
 	// Data averaging during interval periods
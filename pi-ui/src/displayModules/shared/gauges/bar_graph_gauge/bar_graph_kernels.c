@@ -0,0 +1,392 @@
+#include "bar_graph_kernels.h"
+#include "../../../../utils/mem_region.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__GNUC__)
+	#define KERNEL_INLINE static inline __attribute__((always_inline))
+#else
+	#define KERNEL_INLINE static inline
+#endif
+
+void bar_graph_kernel_map_init(
+
+	bar_graph_kernel_map_t *map,
+	bool bipolar,
+	float baseline_value,
+	float min_value,
+	float max_value,
+	int top_y,
+	int h
+){
+	if (!map) return;
+
+	map->bipolar = bipolar;
+	map->top_y = top_y;
+	map->h = h;
+	map->min_value = min_value;
+	map->max_value = max_value;
+	map->baseline_value = baseline_value;
+	map->scale = 1.0f;
+	map->scale_min = 1.0f;
+	map->scale_max = 1.0f;
+	map->lut = NULL;
+	map->lut_count = 0;
+	map->lut_inv_step = 0.0f;
+
+	if (bipolar) {
+
+		float dist_min = baseline_value - min_value;
+		float dist_max = max_value - baseline_value;
+		map->scale_min = (dist_min > 0) ? (float)(h - 2) / (2.0f * dist_min) : 1.0f;
+		map->scale_max = (dist_max > 0) ? (float)(h - 2) / (2.0f * dist_max) : 1.0f;
+		map->baseline_y = h / 2;
+	} else {
+
+		float range = max_value - min_value;
+		map->scale = (float)(h - 2) / (range > 0 ? range : 1.0f);
+		map->baseline_y = h - 1;
+	}
+}
+
+/* =========================
+   VALUE -> SPAN (SCALAR)
+   ========================= */
+
+// `bipolar` is a literal at every call site so each mode compiles to its own branch-free loop
+KERNEL_INLINE bar_graph_span_t map_one(const bar_graph_kernel_map_t *map, float val, const bool bipolar)
+{
+	bar_graph_span_t span;
+	int top_y = map->top_y;
+	int bottom_y = map->top_y + map->h;
+
+	if (isnan(val)) {
+
+		span.y_start = (int16_t)top_y;
+		span.y_end = (int16_t)top_y;
+		return span;
+	}
+
+	if (val < map->min_value) val = map->min_value;
+	if (val > map->max_value) val = map->max_value;
+
+	int y1, y2;
+	if (!bipolar) {
+
+		int bar_height = (int)((val - map->min_value) * map->scale);
+		y1 = map->h - bar_height;
+		y2 = map->h;
+	} else if (val >= map->baseline_value) {
+
+		int bar_height = (int)((val - map->baseline_value) * map->scale_max);
+		y1 = map->baseline_y - bar_height;
+		y2 = map->baseline_y;
+	} else {
+
+		int bar_height = (int)((map->baseline_value - val) * map->scale_min);
+		y1 = map->baseline_y;
+		y2 = map->baseline_y + bar_height;
+	}
+
+	int y_start = top_y + y1;
+	int y_end = top_y + y2;
+
+	// Clamp both ends into the drawable band so degenerate ranges stay empty
+	if (y_start < top_y) y_start = top_y;
+	if (y_start > bottom_y) y_start = bottom_y;
+	if (y_end < top_y) y_end = top_y;
+	if (y_end > bottom_y) y_end = bottom_y;
+
+	span.y_start = (int16_t)y_start;
+	span.y_end = (int16_t)y_end;
+	return span;
+}
+
+void bar_graph_kernel_map_values_scalar(const bar_graph_kernel_map_t *map, const float *values, int count, bar_graph_span_t *spans)
+{
+	if (map->bipolar) {
+
+		for (int i = 0; i < count; i++) spans[i] = map_one(map, values[i], true);
+	} else {
+
+		for (int i = 0; i < count; i++) spans[i] = map_one(map, values[i], false);
+	}
+}
+
+/* =========================
+   VALUE -> SPAN (LOOKUP)
+   ========================= */
+
+KERNEL_INLINE int lut_index(const bar_graph_kernel_map_t *map, float clamped)
+{
+	int idx = (int)((clamped - map->min_value) * map->lut_inv_step);
+	if (idx < 0) idx = 0;
+	if (idx >= map->lut_count) idx = map->lut_count - 1;
+	return idx;
+}
+
+// One multiply, one table lookup, one compare
+KERNEL_INLINE bar_graph_span_t map_lut(const bar_graph_kernel_map_t *map, float val)
+{
+	if (isnan(val)) {
+
+		bar_graph_span_t empty = { (int16_t)map->top_y, (int16_t)map->top_y };
+		return empty;
+	}
+
+	if (val < map->min_value) val = map->min_value;
+	if (val > map->max_value) val = map->max_value;
+
+	const bar_graph_lut_entry_t *entry = &map->lut[lut_index(map, val)];
+	return (val < entry->threshold) ? entry->lo : entry->hi;
+}
+
+// Floats mapped to unsigned keys with the same ordering, so the table builder can bisect
+// over every representable value between two floats
+static uint32_t float_to_key(float f)
+{
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+	return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+}
+
+static float key_to_float(uint32_t key)
+{
+	uint32_t u = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+	float f;
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+static bool span_equal(bar_graph_span_t a, bar_graph_span_t b)
+{
+	return a.y_start == b.y_start && a.y_end == b.y_end;
+}
+
+static bar_graph_span_t span_at_key(const bar_graph_kernel_map_t *map, uint32_t key)
+{
+	return map->bipolar ? map_one(map, key_to_float(key), true) : map_one(map, key_to_float(key), false);
+}
+
+// First key in [lo, hi) whose bucket index is >= bucket (hi if none)
+static uint32_t first_key_in_bucket(const bar_graph_kernel_map_t *map, uint32_t lo, uint32_t hi, int bucket)
+{
+	while (lo < hi) {
+
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (lut_index(map, key_to_float(mid)) >= bucket) hi = mid; else lo = mid + 1;
+	}
+	return lo;
+}
+
+// First key in [lo, hi) whose span differs from `base` (hi if none); spans never revert
+static uint32_t first_key_changed(const bar_graph_kernel_map_t *map, uint32_t lo, uint32_t hi, bar_graph_span_t base)
+{
+	while (lo < hi) {
+
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (!span_equal(span_at_key(map, mid), base)) hi = mid; else lo = mid + 1;
+	}
+	return lo;
+}
+
+static bool build_lut_entries(bar_graph_kernel_map_t *map, bar_graph_lut_entry_t *entries)
+{
+	uint32_t key_min = float_to_key(map->min_value);
+	uint32_t key_end = float_to_key(map->max_value) + 1;
+	uint32_t start = key_min;
+
+	for (int bucket = 0; bucket < map->lut_count; bucket++) {
+
+		uint32_t next = (bucket + 1 < map->lut_count) ? first_key_in_bucket(map, start, key_end, bucket + 1) : key_end;
+		bar_graph_lut_entry_t *entry = &entries[bucket];
+
+		entry->lo = span_at_key(map, start);
+		entry->hi = entry->lo;
+		entry->threshold = INFINITY;
+
+		if (next > start) {
+
+			uint32_t change = first_key_changed(map, start, next, entry->lo);
+			if (change < next) {
+
+				entry->threshold = key_to_float(change);
+				entry->hi = span_at_key(map, change);
+
+				// A second change inside the bucket needs a finer table
+				if (!span_equal(span_at_key(map, next - 1), entry->hi)) return false;
+			}
+		}
+
+		start = next;
+	}
+	return true;
+}
+
+bool bar_graph_kernel_map_build_lut(bar_graph_kernel_map_t *map)
+{
+	if (!map) return false;
+
+	bar_graph_kernel_map_release(map);
+
+	float range = map->max_value - map->min_value;
+	float px_per_unit = map->bipolar ? fmaxf(map->scale_min, map->scale_max) : map->scale;
+	if (!(range > 0.0f) || !isfinite(range) || !(px_per_unit > 0.0f)) return false;
+
+	// Start at two buckets per pixel and refine if a bucket straddles two span changes
+	for (int buckets_per_px = 2; buckets_per_px <= 8; buckets_per_px *= 2) {
+
+		float inv_step = px_per_unit * (float)buckets_per_px;
+		float count_f = range * inv_step + 1.0f;
+		if (!(count_f <= (float)BAR_GRAPH_LUT_MAX_ENTRIES)) return false;
+
+		// Lives as long as the gauge: in the region of the screen being built, like its canvas
+		bar_graph_lut_entry_t *entries = mem_region_alloc_current((size_t)count_f * sizeof(bar_graph_lut_entry_t));
+		if (!entries) return false;
+
+		map->lut_inv_step = inv_step;
+		map->lut_count = (int)count_f;
+
+		if (build_lut_entries(map, entries)) {
+
+			map->lut = entries;
+			return true;
+		}
+
+		mem_region_free(entries);
+	}
+
+	map->lut_count = 0;
+	map->lut_inv_step = 0.0f;
+	return false;
+}
+
+void bar_graph_kernel_map_release(bar_graph_kernel_map_t *map)
+{
+	if (!map) return;
+
+	mem_region_free(map->lut);
+	map->lut = NULL;
+	map->lut_count = 0;
+	map->lut_inv_step = 0.0f;
+}
+
+bar_graph_span_t bar_graph_kernel_map_value(const bar_graph_kernel_map_t *map, float value)
+{
+	if (map->lut) return map_lut(map, value);
+
+	return map->bipolar ? map_one(map, value, true) : map_one(map, value, false);
+}
+
+void bar_graph_kernel_map_values(const bar_graph_kernel_map_t *map, const float *values, int count, bar_graph_span_t *spans)
+{
+	if (!map || !values || !spans || count <= 0) return;
+
+	if (map->lut) {
+
+		for (int i = 0; i < count; i++) spans[i] = map_lut(map, values[i]);
+	} else {
+
+		bar_graph_kernel_map_values_scalar(map, values, count, spans);
+	}
+}
+
+/* =========================
+   PIXEL FILLS
+   ========================= */
+
+KERNEL_INLINE bool color_is_gray(lv_color_t color)
+{
+	return color.red == color.green && color.green == color.blue;
+}
+
+// Fill n consecutive pixels
+static void fill_row(lv_color_t *dst, int n, lv_color_t color)
+{
+	if (n <= 0) return;
+
+	// Bar-width and scroll-step strips: plain stores beat a memset call
+	if (n < 8) {
+
+		for (int i = 0; i < n; i++) dst[i] = color;
+		return;
+	}
+
+	// Black and white (the common canvas colors) are a plain byte fill
+	if (color_is_gray(color)) {
+
+		memset(dst, color.red, (size_t)n * sizeof(lv_color_t));
+		return;
+	}
+
+	for (int i = 0; i < n; i++) dst[i] = color;
+}
+
+void bar_graph_kernel_fill_span(lv_color_t *buf, int stride, int x, int y_start, int y_end, lv_color_t color)
+{
+	if (!buf || y_end <= y_start) return;
+
+	// Column writes are strided, so there is nothing to vectorize; unroll to cut loop overhead
+	lv_color_t *p = &buf[y_start * stride + x];
+	int n = y_end - y_start;
+	for (; n >= 4; n -= 4) {
+
+		p[0] = color;
+		p[stride] = color;
+		p[2 * stride] = color;
+		p[3 * stride] = color;
+		p += 4 * stride;
+	}
+	for (; n > 0; n--, p += stride) *p = color;
+}
+
+void bar_graph_kernel_fill_rect(lv_color_t *buf, int stride, int x_start, int x_end, int y_start, int y_end, lv_color_t color)
+{
+	if (!buf || x_end <= x_start || y_end <= y_start) return;
+
+	int w = x_end - x_start;
+	for (int y = y_start; y < y_end; y++) {
+
+		fill_row(&buf[y * stride + x_start], w, color);
+	}
+}
+
+void bar_graph_kernel_fill_rect_scalar(lv_color_t *buf, int stride, int x_start, int x_end, int y_start, int y_end, lv_color_t color)
+{
+	if (!buf) return;
+
+	for (int yy = y_start; yy < y_end; yy++) {
+
+		lv_color_t *row_ptr = &buf[yy * stride];
+		for (int xx = x_start; xx < x_end; xx++) {
+
+			row_ptr[xx] = color;
+		}
+	}
+}
+
+/* =========================
+   ROW SHIFT
+   ========================= */
+
+void bar_graph_kernel_shift_rows(lv_color_t *buf, int stride, int y_start, int y_end, int shift_px, lv_color_t fill)
+{
+	if (!buf || y_end <= y_start || shift_px <= 0) return;
+
+	if (shift_px >= stride) {
+
+		fill_row(&buf[y_start * stride], (y_end - y_start) * stride, fill);
+		return;
+	}
+
+	// One memmove per row: moving the whole band in one call measured no faster on the
+	// detail-sized canvases (and slower on some)
+	for (int row = y_start; row < y_end; row++) {
+
+		lv_color_t *row_ptr = &buf[row * stride];
+		memmove(row_ptr, row_ptr + shift_px, (size_t)(stride - shift_px) * sizeof(lv_color_t));
+		fill_row(row_ptr + (stride - shift_px), shift_px, fill);
+	}
+}
@@ -1,7 +1,10 @@
 #include "modal_buttons.h"
 #include "../palette.h"
+#include "../../../utils/log.h"
 #include <stdio.h>
 
+static const char *TAG = "modal_buttons";
+
 modal_button_container_t modal_buttons_create(
 	lv_obj_t* parent,
 	lv_coord_t width,
@@ -50,7 +53,7 @@ modal_button_container_t modal_buttons_create(
 	lv_obj_set_style_text_color(close_label, PALETTE_WHITE, 0);
 	lv_obj_center(close_label);
 
-	printf("[I] modal_buttons: Standardized button container created\n");
+	LOG_I(TAG, "Standardized button container created");
 	return container;
 }
 
@@ -66,5 +69,5 @@ void modal_buttons_destroy(modal_button_container_t* container) {
 	container->cancel_button = NULL;
 	container->close_button = NULL;
 
-	printf("[I] modal_buttons: Button container destroyed\n");
+	LOG_I(TAG, "Button container destroyed");
 }
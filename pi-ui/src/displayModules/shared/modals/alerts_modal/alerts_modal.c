@@ -1,10 +1,13 @@
 #include <stdio.h>
 #include "alerts_modal.h"
 
+#include "../../../../fonts/app_fonts.h"
 #include "../../../../fonts/lv_font_noplato_24.h"
 #include "../../numberpad/numberpad.h"
 #include "../../palette.h"
+#include "../../../../utils/ui_build.h"
 #include "../../../../state/device_state.h"
+#include "../../../../utils/log.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -12,6 +15,11 @@
 
 static const char *TAG = "alerts_modal";
 
+// Glyphs drawn in the app fonts: the threshold values
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_24, APP_FONT_GLYPHS_NUMBER },
+};
+
 // Deferred destruction support (like timeline_modal)
 static lv_timer_t* s_alerts_destroy_timer = NULL;
 static bool s_alerts_destroy_pending = false;
@@ -95,11 +103,18 @@ static bool s_alerts_destroy_pending = false;
 #define HAS_CHANGED_TEXT_COLOR PALETTE_WHITE
 #define HAS_CHANGED_BACKGROUND_COLOR PALETTE_BLACK
 
+// #### Scrolling List ####
+
+#define CONTENT_HEIGHT 740          // Scroll viewport: 800 - 60 (button height)
+#define GAUGE_SECTION_HEIGHT 200
+#define GAUGE_SECTION_PITCH 240     // Gauge section spacing in the scroll content
+#define GAUGE_SECTION_MARGIN 1      // Sections kept bound beyond each edge of the viewport
+
 
 // Field validation ranges are now provided by configuration
 
 // Warning system for out-of-range values
-typedef struct {
+typedef struct alerts_modal_warning {
 	lv_obj_t* text_label;  // Label for "OVER"/"UNDER"/"MAX"/"MIN" text
 	lv_obj_t* value_label; // Label for the numeric value (for max/min warnings)
 	lv_obj_t* container;   // Container for max/min warnings (matches value field style)
@@ -112,23 +127,16 @@ typedef struct {
 	bool is_baseline_warning;  // Whether this is a baseline warning
 } warning_data_t;
 
-// Warning data is now allocated per modal instance
+// Warning data is allocated per modal instance (modal->warnings)
 // Gauge names, field names, and group names are now provided by configuration
 
-// Global warning data array for all fields - dynamically allocated
-static warning_data_t* g_warning_data = NULL;
-static int g_warning_data_size = 0;
-
-// Macro to safely access warning data
-#define WARNING_DATA(field_id) get_warning_data(field_id)
-
 // Forward declarations
 static void close_button_cb(lv_event_t *e);
 static void cancel_button_cb(lv_event_t *e);
 static void field_click_handler(lv_event_t *e);
-static void init_warning_data(int total_field_count);
-static void cleanup_warning_data(void);
-static warning_data_t* get_warning_data(int field_id);
+static void init_warning_data(alerts_modal_t* modal);
+static void cleanup_warning_data(alerts_modal_t* modal);
+static warning_data_t* get_warning_data(alerts_modal_t* modal, int field_id);
 static void on_pressing(lv_event_t *e);
 static void scroll_handler(lv_event_t *e);
 static void initialize_field_data(field_data_t* field_data, int gauge, int field_type, const alerts_modal_config_t* config);
@@ -138,7 +146,8 @@ static void update_current_field_border(alerts_modal_t* modal);
 static int find_field_by_button(alerts_modal_t* modal, lv_obj_t* button);
 static void close_current_field(alerts_modal_t* modal);
 static void highlight_field_for_warning(alerts_modal_t* modal, int field_id);
-static void create_gauge_section(alerts_modal_t* modal, int gauge, lv_obj_t* parent, int y_offset);
+static void create_gauge_section(alerts_modal_t* modal, alerts_modal_row_t* row);
+static bool virtualize_rows(alerts_modal_t* modal);
 static void numberpad_value_changed(const char* value, void* user_data);
 static void numberpad_clear(void* user_data);
 static void numberpad_enter(const char* value, void* user_data);
@@ -227,7 +236,7 @@ static float clamp_field_value(alerts_modal_t* modal, int field_id, float value)
 
 	// Bounds checking to prevent crashes
 	if (gauge_index < 0 || gauge_index >= modal->config.gauge_count) {
-		printf("[E] alerts_modal: Invalid gauge_index %d in clamp function\n", gauge_index);
+		LOG_E(TAG, "Invalid gauge_index %d in clamp function", gauge_index);
 		return value;
 	}
 
@@ -343,9 +352,11 @@ static void update_all_field_borders(alerts_modal_t* modal)
 	container_info_t container_cache[modal->config.gauge_count * 3]; // 3 containers per gauge (section, alerts, gauge)
 	int cache_index = 0;
 
-	// Populate cache with all containers
+	// Populate cache with the containers of the gauges bound to a row
 	for (int gauge = 0; gauge < modal->config.gauge_count; gauge++) {
 
+		if (!modal->gauge_sections[gauge]) continue;
+
 		// Gauge section container
 		container_cache[cache_index].container = modal->gauge_sections[gauge];
 		container_cache[cache_index].title_label = modal->gauge_titles[gauge];
@@ -403,7 +414,7 @@ static void update_all_field_borders(alerts_modal_t* modal)
 			data->title_background_color = DEFAULT_FIELD_VALUE_TITLE_BACKGROUND_COLOR;
 		} else if( data->is_warning_highlighted ){ // Warning highlighted field (yellow highlighting) - HIGH PRIORITY
 
-			printf("[I] alerts_modal: Applying warning highlight to field %d\n", field_id);
+			LOG_I(TAG, "Applying warning highlight to field %d", field_id);
 			data->border_color = UPDATED_WARNING_BORDER_COLOR;
 			data->title_background_color = UPDATED_WARNING_TITLE_BACKGROUND_COLOR;
 			data->title_color = UPDATED_WARNING_TITLE_BORDER_COLOR;
@@ -454,7 +465,7 @@ static void update_all_field_borders(alerts_modal_t* modal)
 		if (data->is_being_edited) {
 
 			// Mark gauge section as having active field
-			for (int i = 0; i < modal->config.gauge_count * 3; i++) {
+			for (int i = 0; i < cache_index; i++) {
 
 				if (container_cache[i].gauge_index == gauge_index && container_cache[i].group_type == -1) {
 
@@ -463,7 +474,7 @@ static void update_all_field_borders(alerts_modal_t* modal)
 			}
 
 			// Mark appropriate group as having active field
-			for (int i = 0; i < modal->config.gauge_count * 3; i++) {
+			for (int i = 0; i < cache_index; i++) {
 
 				if (container_cache[i].gauge_index == gauge_index && container_cache[i].group_type == data->group_type) {
 
@@ -475,7 +486,7 @@ static void update_all_field_borders(alerts_modal_t* modal)
 	}
 
 	// Step 3: Style the cached containers based on whether they contain active fields
-	for (int i = 0; i < modal->config.gauge_count * 3; i++) {
+	for (int i = 0; i < cache_index; i++) {
 
 		lv_obj_t* container = container_cache[ i ].container;
 		lv_obj_t* title_label = container_cache[ i ].title_label;
@@ -634,11 +645,18 @@ static void highlight_field_for_warning(alerts_modal_t* modal, int field_id)
 // Find field by button
 static int find_field_by_button(alerts_modal_t* modal, lv_obj_t* button)
 {
-	if (!modal || !button) return -1;
+	if (!modal || !button || !modal->rows) return -1;
+
+	// Only bound rows have buttons
+	for (int r = 0; r < modal->row_count; r++) {
+
+		alerts_modal_row_t* row = &modal->rows[r];
+		if (row->gauge < 0) continue;
 
-		for (int i = 0; i < modal->total_field_count; i++) {
-		if (modal->field_ui[i].button == button) {
-			return i;
+		for (int field_type = 0; field_type < 5; field_type++) {
+			if (row->fields[field_type].button == button) {
+				return row->gauge * 5 + field_type;
+			}
 		}
 	}
 	return -1;
@@ -661,7 +679,7 @@ static void close_current_field(alerts_modal_t* modal)
 	// Save this field's value to device state (in-memory only, no disk write)
 	set_device_state_value(modal, data->gauge_index, data->field_index, data->current_value);
 
-	printf("[I] alerts_modal: Updated field[%d,%d] value: %.1f (in-memory)\n",
+	LOG_I(TAG, "Updated field[%d,%d] value: %.1f (in-memory)",
 		data->gauge_index, data->field_index, data->current_value);
 
 	// Check if this is a GAUGE LOW or HIGH field change that might affect baseline
@@ -681,6 +699,25 @@ static void close_current_field(alerts_modal_t* modal)
 	}
 }
 
+// Claims the shared numberpad for this modal (built by the first caller)
+static void bind_numberpad(alerts_modal_t* modal)
+{
+	numberpad_config_t numpad_config = NUMBERPAD_DEFAULT_CONFIG;
+	numpad_config.max_digits = 5; // Allow 3 digits + decimal + 1 decimal place = 5 characters total
+	numpad_config.decimal_places = 1;
+	numpad_config.auto_decimal = true;
+	modal->numberpad = numberpad_get_shared(&numpad_config);
+
+	numberpad_set_callbacks(
+		modal->numberpad,
+		numberpad_value_changed,
+		numberpad_clear,
+		numberpad_enter,
+		numberpad_cancel,
+		modal
+	);
+}
+
 // Field click handler
 static void field_click_handler(lv_event_t *e)
 {
@@ -688,6 +725,7 @@ static void field_click_handler(lv_event_t *e)
 	lv_obj_t* target = lv_event_get_target(e);
 
 	if (!modal || !target) return;
+	ui_build_complete(&modal->build);
 
 	// Find which field was clicked first
 	int field_id = find_field_by_button(modal, target);
@@ -712,7 +750,7 @@ static void field_click_handler(lv_event_t *e)
 		// Check if the click is on the current field (toggle behavior)
 		if (field_id == modal->current_field_id) {
 
-			printf("[I] alerts_modal: Click is on current field %d, closing numberpad\n", field_id);
+			LOG_I(TAG, "Click is on current field %d, closing numberpad", field_id);
 			close_current_field(modal);
 			return;
 		}
@@ -752,34 +790,14 @@ static void field_click_handler(lv_event_t *e)
 	// Log complete field state
 	char field_info[256];
 	get_field_info(data, field_info, sizeof(field_info));
-	printf("[I] alerts_modal: Field clicked: %s\n", field_info);
+	LOG_I(TAG, "Field clicked: %s", field_info);
 
 	// Open this field
 	modal->current_field_id = field_id;
 	data->is_being_edited = true;
 
 	// Show numberpad
-	if( !modal->numberpad ){
-
-		numberpad_config_t numpad_config = NUMBERPAD_DEFAULT_CONFIG;
-		numpad_config.max_digits = 5; // Allow 3 digits + decimal + 1 decimal place = 5 characters total
-		numpad_config.decimal_places = 1;
-		numpad_config.auto_decimal = true;
-		modal->numberpad = numberpad_create(&numpad_config, modal->background);
-
-		// todo: probably dont need the conditional
-		if( modal->numberpad ){
-
-			numberpad_set_callbacks(
-				modal->numberpad,
-				numberpad_value_changed,
-				numberpad_clear,
-				numberpad_enter,
-				numberpad_cancel,
-				modal
-			);
-			}
-	}
+	bind_numberpad(modal);
 
 	if (modal->numberpad) {
 
@@ -863,7 +881,16 @@ static void scroll_handler(lv_event_t *e)
 {
 	alerts_modal_t* modal = (alerts_modal_t*)lv_event_get_user_data(e);
 
-	if (!modal || !modal->numberpad) return;
+	if (!modal) return;
+
+	// Recycle sections that left the viewport for the ones entering it; while the
+	// build runs it binds the first sections itself
+	if (!ui_build_is_active(&modal->build) && virtualize_rows(modal)) {
+
+		update_all_field_borders(modal);
+	}
+
+	if (!modal->numberpad) return;
 
 	// Only reposition if numberpad is currently visible
 	if (!numberpad_is_visible(modal->numberpad)) return;
@@ -871,12 +898,13 @@ static void scroll_handler(lv_event_t *e)
 	// Only reposition if we have a current field
 	if (modal->current_field_id < 0) return;
 
-	printf("[I] alerts_modal: Container scrolling, repositioning numberpad\n");
+	LOG_I(TAG, "Container scrolling, repositioning numberpad");
 
 	// Get the current field's target and gauge container
 	field_data_t* data = &modal->field_data[modal->current_field_id];
 	lv_obj_t* target = modal->field_ui[modal->current_field_id].button;
 	lv_obj_t* gauge_container = modal->gauge_sections[data->gauge_index];
+	if (!target || !gauge_container) return;
 
 	// Reposition the numberpad to stay aligned with the field
 	numberpad_show_outside_container(modal->numberpad, target, gauge_container);
@@ -885,13 +913,14 @@ static void scroll_handler(lv_event_t *e)
 // Close button callback
 static void close_button_cb(lv_event_t *e)
 {
-	printf("[I] alerts_modal: Close button clicked\n");
+	LOG_I(TAG, "Close button clicked");
 	alerts_modal_t* modal = (alerts_modal_t*)lv_event_get_user_data(e);
 
 	if (!modal) {
-		printf("[E] alerts_modal: Close button - modal is NULL\n");
+		LOG_E(TAG, "Close button - modal is NULL");
 		return;
 	}
+	ui_build_complete(&modal->build);
 
 	close_current_field(modal);
 
@@ -907,13 +936,14 @@ static void close_button_cb(lv_event_t *e)
 // Cancel button callback - reverts all changes and closes modal
 static void cancel_button_cb(lv_event_t *e)
 {
-	printf("[I] alerts_modal: Cancel button clicked\n");
+	LOG_I(TAG, "Cancel button clicked");
 	alerts_modal_t* modal = (alerts_modal_t*)lv_event_get_user_data(e);
 
 	if (!modal) {
-		printf("[E] alerts_modal: Cancel button - modal is NULL\n");
+		LOG_E(TAG, "Cancel button - modal is NULL");
 		return;
 	}
+	ui_build_complete(&modal->build);
 
 	// Revert all field values to their original values (in-memory only)
 	for (int field_id = 0; field_id < modal->total_field_count; field_id++) {
@@ -924,7 +954,7 @@ static void cancel_button_cb(lv_event_t *e)
 		set_device_state_value(modal, data->gauge_index, data->field_index, data->current_value);
 	}
 
-	printf("[I] alerts_modal: Cancel button pressed - reverted all changes (in-memory)\n");
+	LOG_I(TAG, "Cancel button pressed - reverted all changes (in-memory)");
 
 	// Close the modal immediately
 	if (modal->on_close) {
@@ -966,7 +996,7 @@ static void check_and_update_baseline(alerts_modal_t* modal, int gauge_index)
 		// Show "UPDATED" warning for baseline
 		show_out_of_range_warning(modal, baseline_field_id, new_midpoint);
 
-		printf("[I] alerts_modal: Baseline updated to %.1f (was %.1f, new range: %.1f-%.1f)\n",
+		LOG_I(TAG, "Baseline updated to %.1f (was %.1f, new range: %.1f-%.1f)",
 			new_midpoint, current_baseline, current_low, current_high);
 	}
 }
@@ -986,7 +1016,7 @@ static void numberpad_value_changed(const char* value, void* user_data)
 	if (modal->field_data[modal->current_field_id].is_out_of_range) {
 		hide_out_of_range_warning(modal, modal->current_field_id);
 		modal->field_data[modal->current_field_id].is_out_of_range = false;
-		printf("[I] alerts_modal: Cleared existing warning for field %d - user is entering new value\n", modal->current_field_id);
+		LOG_I(TAG, "Cleared existing warning for field %d - user is entering new value", modal->current_field_id);
 	}
 
 	// For baseline fields, check against current LOW and HIGH values instead of min/max
@@ -1005,14 +1035,14 @@ static void numberpad_value_changed(const char* value, void* user_data)
 		bool is_out_of_range = (new_value < current_low_value) || (new_value > current_high_value);
 
 		if (is_out_of_range) {
-			printf("[I] alerts_modal: Baseline value %.1f is out of range (LOW: %.1f, HIGH: %.1f), showing warning\n",
+			LOG_I(TAG, "Baseline value %.1f is out of range (LOW: %.1f, HIGH: %.1f), showing warning",
 				new_value, current_low_value, current_high_value);
 
 			// Show warning for out-of-range value
 			show_out_of_range_warning(modal, modal->current_field_id, new_value);
 			data->is_out_of_range = true;
 		} else {
-			printf("[I] alerts_modal: Baseline value %.1f is within range (LOW: %.1f, HIGH: %.1f), hiding warning\n",
+			LOG_I(TAG, "Baseline value %.1f is within range (LOW: %.1f, HIGH: %.1f), hiding warning",
 				new_value, current_low_value, current_high_value);
 
 			// Hide any existing warning
@@ -1027,7 +1057,7 @@ static void numberpad_value_changed(const char* value, void* user_data)
 
 		// Bounds checking to prevent crashes
 		if (gauge_index < 0 || gauge_index >= modal->config.gauge_count) {
-			printf("[E] alerts_modal: Invalid gauge_index %d in range checking\n", gauge_index);
+			LOG_E(TAG, "Invalid gauge_index %d in range checking", gauge_index);
 			return;
 		}
 
@@ -1149,7 +1179,7 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 	if (!modal || field_id < 0 || field_id >= modal->total_field_count) return;
 
 	// Get warning data with bounds checking
-	warning_data_t* warning_data = get_warning_data(field_id);
+	warning_data_t* warning_data = get_warning_data(modal, field_id);
 	if (!warning_data) return;
 
 	field_ui_t* ui = &modal->field_ui[field_id];
@@ -1171,7 +1201,7 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 
 	// Bounds checking to prevent crashes
 	if (gauge_index < 0 || gauge_index >= modal->config.gauge_count) {
-		printf("[E] alerts_modal: Invalid gauge_index %d in warning system\n", gauge_index);
+		LOG_E(TAG, "Invalid gauge_index %d in warning system", gauge_index);
 		return;
 	}
 
@@ -1185,7 +1215,7 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 			current_low_value = modal->field_data[low_field_id].current_value;
 			current_high_value = modal->field_data[high_field_id].current_value;
 		} else {
-			printf("[E] alerts_modal: Invalid field IDs in warning system (low=%d, high=%d)\n", low_field_id, high_field_id);
+			LOG_E(TAG, "Invalid field IDs in warning system (low=%d, high=%d)", low_field_id, high_field_id);
 			return;
 		}
 	} else {
@@ -1198,7 +1228,7 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 			current_low_value = modal->field_data[low_field_id].current_value;
 			current_high_value = modal->field_data[high_field_id].current_value;
 		} else {
-			printf("[E] alerts_modal: Invalid field IDs in warning system (low=%d, high=%d)\n", low_field_id, high_field_id);
+			LOG_E(TAG, "Invalid field IDs in warning system (low=%d, high=%d)", low_field_id, high_field_id);
 			return;
 		}
 	}
@@ -1213,24 +1243,24 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 	modal->field_data[field_id].current_value = out_of_range_value;
 
 	// Create warning text label (for "OVER"/"UNDER"/"MAX"/"MIN")
-	g_warning_data[field_id].text_label = lv_label_create(modal->background);
-	lv_label_set_text(g_warning_data[field_id].text_label, ""); // Initialize with empty text
-	lv_obj_set_style_text_color(g_warning_data[field_id].text_label, PALETTE_YELLOW, 0); // Warm yellow
-	lv_obj_set_style_text_font(g_warning_data[field_id].text_label, &lv_font_montserrat_20, 0); // Modal font, bigger
-	lv_obj_set_style_text_align(g_warning_data[field_id].text_label, LV_TEXT_ALIGN_CENTER, 0); // Center align
-	lv_obj_set_style_bg_color(g_warning_data[field_id].text_label, PALETTE_BLACK, 0);
-	lv_obj_set_style_bg_opa(g_warning_data[field_id].text_label, LV_OPA_COVER, 0);
-	lv_obj_set_style_pad_all(g_warning_data[field_id].text_label, 4, 0);
-	lv_obj_clear_flag(g_warning_data[field_id].text_label, LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_set_style_radius(g_warning_data[field_id].text_label, 8, 0); // Match field container radius
-	lv_obj_set_style_border_color(g_warning_data[field_id].text_label, DEFAULT_WARNING_BORDER_COLOR, 0); // Yellow border
-	lv_obj_set_style_border_width(g_warning_data[field_id].text_label, 3, 0); // Match highlighted field border width
+	warning_data->text_label = lv_label_create(modal->background);
+	lv_label_set_text(warning_data->text_label, ""); // Initialize with empty text
+	lv_obj_set_style_text_color(warning_data->text_label, PALETTE_YELLOW, 0); // Warm yellow
+	lv_obj_set_style_text_font(warning_data->text_label, &lv_font_montserrat_20, 0); // Modal font, bigger
+	lv_obj_set_style_text_align(warning_data->text_label, LV_TEXT_ALIGN_CENTER, 0); // Center align
+	lv_obj_set_style_bg_color(warning_data->text_label, PALETTE_BLACK, 0);
+	lv_obj_set_style_bg_opa(warning_data->text_label, LV_OPA_COVER, 0);
+	lv_obj_set_style_pad_all(warning_data->text_label, 4, 0);
+	lv_obj_clear_flag(warning_data->text_label, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_set_style_radius(warning_data->text_label, 8, 0); // Match field container radius
+	lv_obj_set_style_border_color(warning_data->text_label, DEFAULT_WARNING_BORDER_COLOR, 0); // Yellow border
+	lv_obj_set_style_border_width(warning_data->text_label, 3, 0); // Match highlighted field border width
 	// Hide the label initially until it has proper text
-	lv_obj_add_flag(g_warning_data[field_id].text_label, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_add_flag(warning_data->text_label, LV_OBJ_FLAG_HIDDEN);
 
 	// Create warning value label and container (for numeric values in max/min warnings)
-	g_warning_data[field_id].value_label = NULL; // Will be created only for max/min warnings
-	g_warning_data[field_id].container = NULL; // Will be created only for max/min warnings
+	warning_data->value_label = NULL; // Will be created only for max/min warnings
+	warning_data->container = NULL; // Will be created only for max/min warnings
 
 	// Determine if value is above max or below min using field-specific constraints
 	bool is_above_max = false;
@@ -1356,13 +1386,13 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 		// For baseline values that are out of range, clamp to midpoint between current LOW and HIGH values
 		if (out_of_range_value > current_high_value || out_of_range_value < current_low_value) {
 			clamped_value = (current_low_value + current_high_value) / 2.0f; // Midpoint of current LOW and HIGH values
-			printf("[I] alerts_modal: Clamping baseline value %.1f to midpoint %.1f (current LOW: %.1f, HIGH: %.1f)\n",
+			LOG_I(TAG, "Clamping baseline value %.1f to midpoint %.1f (current LOW: %.1f, HIGH: %.1f)",
 				out_of_range_value, clamped_value, current_low_value, current_high_value);
 		}
 	}
 
 	// Store the clamped value to revert to when warning expires
-	g_warning_data[field_id].clamped_value = clamped_value;
+	warning_data->clamped_value = clamped_value;
 
 
 	// Set warning text based on warning type
@@ -1373,49 +1403,49 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 
 		if (is_automatic_update) {
 			// This is an automatic baseline update
-			lv_label_set_text(g_warning_data[field_id].text_label, "UPDATED");
+			lv_label_set_text(warning_data->text_label, "UPDATED");
 		} else if (is_above_max) {
 			// User input above range
-			lv_label_set_text(g_warning_data[field_id].text_label, "OVER");
+			lv_label_set_text(warning_data->text_label, "OVER");
 		} else if (is_below_min) {
 			// User input below range
-			lv_label_set_text(g_warning_data[field_id].text_label, "UNDER");
+			lv_label_set_text(warning_data->text_label, "UNDER");
 		} else {
 			// Fallback - shouldn't happen
-			lv_label_set_text(g_warning_data[field_id].text_label, "RANGE");
+			lv_label_set_text(warning_data->text_label, "RANGE");
 		}
 
 		// Show the label now that it has text
-		lv_obj_clear_flag(g_warning_data[field_id].text_label, LV_OBJ_FLAG_HIDDEN);
+		lv_obj_clear_flag(warning_data->text_label, LV_OBJ_FLAG_HIDDEN);
 	} else {
 
 		// Regular max/min warnings: show "MAX" or "MIN" text + value in single container
 		if (is_above_max)
 		{
 			// Create container that encompasses both text and value
-			g_warning_data[field_id].container = lv_obj_create(modal->background);
-			lv_obj_set_size(g_warning_data[field_id].container, 63, 80); // Larger to fit both text and value, 3px wider for negative values
-			lv_obj_set_style_bg_color(g_warning_data[field_id].container, PALETTE_BLACK, 0); // Black background
-			lv_obj_set_style_bg_opa(g_warning_data[field_id].container, LV_OPA_COVER, 0);
-			lv_obj_set_style_border_color(g_warning_data[field_id].container, PALETTE_YELLOW, 0); // Yellow border
-			lv_obj_set_style_border_width(g_warning_data[field_id].container, 2, 0);
-			lv_obj_set_style_radius(g_warning_data[field_id].container, 8, 0);
-			lv_obj_clear_flag(g_warning_data[field_id].container, LV_OBJ_FLAG_SCROLLABLE);
+			warning_data->container = lv_obj_create(modal->background);
+			lv_obj_set_size(warning_data->container, 63, 80); // Larger to fit both text and value, 3px wider for negative values
+			lv_obj_set_style_bg_color(warning_data->container, PALETTE_BLACK, 0); // Black background
+			lv_obj_set_style_bg_opa(warning_data->container, LV_OPA_COVER, 0);
+			lv_obj_set_style_border_color(warning_data->container, PALETTE_YELLOW, 0); // Yellow border
+			lv_obj_set_style_border_width(warning_data->container, 2, 0);
+			lv_obj_set_style_radius(warning_data->container, 8, 0);
+			lv_obj_clear_flag(warning_data->container, LV_OBJ_FLAG_SCROLLABLE);
 
 			// Create text label inside container
-			g_warning_data[field_id].text_label = lv_label_create(g_warning_data[field_id].container);
-			lv_obj_set_style_text_color(g_warning_data[field_id].text_label, PALETTE_YELLOW, 0);
-			lv_obj_set_style_text_font(g_warning_data[field_id].text_label, &lv_font_montserrat_20, 0);
-			lv_obj_set_style_text_align(g_warning_data[field_id].text_label, LV_TEXT_ALIGN_CENTER, 0);
-			lv_label_set_text(g_warning_data[field_id].text_label, "MAX");
-			lv_obj_align(g_warning_data[field_id].text_label, LV_ALIGN_TOP_MID, 0, 22);
+			warning_data->text_label = lv_label_create(warning_data->container);
+			lv_obj_set_style_text_color(warning_data->text_label, PALETTE_YELLOW, 0);
+			lv_obj_set_style_text_font(warning_data->text_label, &lv_font_montserrat_20, 0);
+			lv_obj_set_style_text_align(warning_data->text_label, LV_TEXT_ALIGN_CENTER, 0);
+			lv_label_set_text(warning_data->text_label, "MAX");
+			lv_obj_align(warning_data->text_label, LV_ALIGN_TOP_MID, 0, 22);
 
 			// Create value label inside container
-			g_warning_data[field_id].value_label = lv_label_create(g_warning_data[field_id].container);
-			lv_obj_set_style_text_color(g_warning_data[field_id].value_label, PALETTE_YELLOW, 0);
-			lv_obj_set_style_text_font(g_warning_data[field_id].value_label, &lv_font_noplato_24, 0);
-			lv_obj_set_style_text_align(g_warning_data[field_id].value_label, LV_TEXT_ALIGN_CENTER, 0);
-			lv_obj_align(g_warning_data[field_id].value_label, LV_ALIGN_BOTTOM_MID, 0, -22);
+			warning_data->value_label = lv_label_create(warning_data->container);
+			lv_obj_set_style_text_color(warning_data->value_label, PALETTE_YELLOW, 0);
+			lv_obj_set_style_text_font(warning_data->value_label, &lv_font_noplato_24, 0);
+			lv_obj_set_style_text_align(warning_data->value_label, LV_TEXT_ALIGN_CENTER, 0);
+			lv_obj_align(warning_data->value_label, LV_ALIGN_BOTTOM_MID, 0, -22);
 
 			char value_text[16];
 			// For MAX warning, show the actual constraint value being used
@@ -1433,32 +1463,32 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 				// For other fields, use config max
 				snprintf(value_text, sizeof(value_text), "%.0f", data->max_value);
 			}
-			lv_label_set_text(g_warning_data[field_id].value_label, value_text);
+			lv_label_set_text(warning_data->value_label, value_text);
 		} else if (is_below_min) {
 			// Create container that encompasses both text and value
-			g_warning_data[field_id].container = lv_obj_create(modal->background);
-			lv_obj_set_size(g_warning_data[field_id].container, 63, 80); // Larger to fit both text and value, 3px wider for negative values
-			lv_obj_set_style_bg_color(g_warning_data[field_id].container, PALETTE_BLACK, 0); // Black background
-			lv_obj_set_style_bg_opa(g_warning_data[field_id].container, LV_OPA_COVER, 0);
-			lv_obj_set_style_border_color(g_warning_data[field_id].container, PALETTE_YELLOW, 0); // Yellow border
-			lv_obj_set_style_border_width(g_warning_data[field_id].container, 2, 0);
-			lv_obj_set_style_radius(g_warning_data[field_id].container, 8, 0);
-			lv_obj_clear_flag(g_warning_data[field_id].container, LV_OBJ_FLAG_SCROLLABLE);
+			warning_data->container = lv_obj_create(modal->background);
+			lv_obj_set_size(warning_data->container, 63, 80); // Larger to fit both text and value, 3px wider for negative values
+			lv_obj_set_style_bg_color(warning_data->container, PALETTE_BLACK, 0); // Black background
+			lv_obj_set_style_bg_opa(warning_data->container, LV_OPA_COVER, 0);
+			lv_obj_set_style_border_color(warning_data->container, PALETTE_YELLOW, 0); // Yellow border
+			lv_obj_set_style_border_width(warning_data->container, 2, 0);
+			lv_obj_set_style_radius(warning_data->container, 8, 0);
+			lv_obj_clear_flag(warning_data->container, LV_OBJ_FLAG_SCROLLABLE);
 
 			// Create text label inside container
-			g_warning_data[field_id].text_label = lv_label_create(g_warning_data[field_id].container);
-			lv_obj_set_style_text_color(g_warning_data[field_id].text_label, PALETTE_YELLOW, 0);
-			lv_obj_set_style_text_font(g_warning_data[field_id].text_label, &lv_font_montserrat_20, 0);
-			lv_obj_set_style_text_align(g_warning_data[field_id].text_label, LV_TEXT_ALIGN_CENTER, 0);
-			lv_label_set_text(g_warning_data[field_id].text_label, "MIN");
-			lv_obj_align(g_warning_data[field_id].text_label, LV_ALIGN_TOP_MID, 0, 22);
+			warning_data->text_label = lv_label_create(warning_data->container);
+			lv_obj_set_style_text_color(warning_data->text_label, PALETTE_YELLOW, 0);
+			lv_obj_set_style_text_font(warning_data->text_label, &lv_font_montserrat_20, 0);
+			lv_obj_set_style_text_align(warning_data->text_label, LV_TEXT_ALIGN_CENTER, 0);
+			lv_label_set_text(warning_data->text_label, "MIN");
+			lv_obj_align(warning_data->text_label, LV_ALIGN_TOP_MID, 0, 22);
 
 			// Create value label inside container
-			g_warning_data[field_id].value_label = lv_label_create(g_warning_data[field_id].container);
-			lv_obj_set_style_text_color(g_warning_data[field_id].value_label, PALETTE_YELLOW, 0);
-			lv_obj_set_style_text_font(g_warning_data[field_id].value_label, &lv_font_noplato_24, 0);
-			lv_obj_set_style_text_align(g_warning_data[field_id].value_label, LV_TEXT_ALIGN_CENTER, 0);
-			lv_obj_align(g_warning_data[field_id].value_label, LV_ALIGN_BOTTOM_MID, 0, -22);
+			warning_data->value_label = lv_label_create(warning_data->container);
+			lv_obj_set_style_text_color(warning_data->value_label, PALETTE_YELLOW, 0);
+			lv_obj_set_style_text_font(warning_data->value_label, &lv_font_noplato_24, 0);
+			lv_obj_set_style_text_align(warning_data->value_label, LV_TEXT_ALIGN_CENTER, 0);
+			lv_obj_align(warning_data->value_label, LV_ALIGN_BOTTOM_MID, 0, -22);
 
 			char value_text[16];
 			// For MIN warning, show the actual constraint value being used
@@ -1476,11 +1506,11 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 				// For other fields, use config min
 				snprintf(value_text, sizeof(value_text), "%.0f", data->min_value);
 			}
-			lv_label_set_text(g_warning_data[field_id].value_label, value_text);
+			lv_label_set_text(warning_data->value_label, value_text);
 		} else {
 
 			// Fallback - shouldn't happen
-			lv_label_set_text(g_warning_data[field_id].text_label, "ERROR");
+			lv_label_set_text(warning_data->text_label, "ERROR");
 		}
 	}
 
@@ -1493,31 +1523,31 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 		if (is_baseline_warning) {
 			// Baseline warnings: show text label above field
 			lv_obj_align_to(
-				g_warning_data[field_id].text_label, ui->label, LV_ALIGN_OUT_TOP_MID,
+				warning_data->text_label, ui->label, LV_ALIGN_OUT_TOP_MID,
 				0, -offset_distance
 			);
 		} else {
 			// Max warnings: show container above field
 			lv_obj_align_to(
-				g_warning_data[field_id].container, ui->label, LV_ALIGN_OUT_TOP_MID,
+				warning_data->container, ui->label, LV_ALIGN_OUT_TOP_MID,
 				0, -offset_distance
 			);
 		}
-		printf("[I] alerts_modal: Positioned %s warning above field\n",
+		LOG_I(TAG, "Positioned %s warning above field",
 			is_baseline_warning ? "baseline" : "max");
 	} else {
 		// Min warnings: show container below field
 		lv_obj_align_to(
-			g_warning_data[field_id].container, ui->label, LV_ALIGN_OUT_BOTTOM_MID,
+			warning_data->container, ui->label, LV_ALIGN_OUT_BOTTOM_MID,
 			0, offset_distance
 		);
-		printf("[I] alerts_modal: Positioned min warning below field\n");
+		LOG_I(TAG, "Positioned min warning below field");
 	}
 
 	// Store warning data
-	g_warning_data[field_id].modal = modal;
-	g_warning_data[field_id].highlighted_field_id = highlighted_field_id;
-	g_warning_data[field_id].is_baseline_warning = is_baseline_warning;
+	warning_data->modal = modal;
+	warning_data->highlighted_field_id = highlighted_field_id;
+	warning_data->is_baseline_warning = is_baseline_warning;
 
 	// Highlight the corresponding field for baseline warnings
 	if (is_baseline_warning && highlighted_field_id >= 0) {
@@ -1529,9 +1559,9 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 	}
 
 	// Create timer to hide warning after 2 seconds
-	g_warning_data[field_id].timer = lv_timer_create(warning_timer_callback, 5000, &g_warning_data[field_id]);
-	lv_timer_set_repeat_count(g_warning_data[field_id].timer, 1); // Run only once
-	g_warning_data[field_id].field_id = field_id;
+	warning_data->timer = lv_timer_create(warning_timer_callback, 5000, &modal->warnings[field_id]);
+	lv_timer_set_repeat_count(warning_data->timer, 1); // Run only once
+	warning_data->field_id = field_id;
 
 	// Don't reset the numberpad input to allow continuous typing for all fields
 	// Only reset when the warning timer expires
@@ -1539,41 +1569,38 @@ static void show_out_of_range_warning(alerts_modal_t* modal, int field_id, float
 	// Update field display to show the out-of-range value
 	update_field_display(modal, field_id);
 
-	printf("[I] alerts_modal: Showing warning for out-of-range value: %.1f (timer created)\n", out_of_range_value);
+	LOG_I(TAG, "Showing warning for out-of-range value: %.1f (timer created)", out_of_range_value);
 }
 
 // Initialize warning data array
-static void init_warning_data(int total_field_count)
+static void init_warning_data(alerts_modal_t* modal)
 {
-	if (g_warning_data) {
-		cleanup_warning_data();
+	if (modal->warnings) {
+		cleanup_warning_data(modal);
 	}
 
-	g_warning_data_size = total_field_count;
-	g_warning_data = calloc(total_field_count, sizeof(warning_data_t));
-	if (!g_warning_data) {
-		printf("[E] alerts_modal: Failed to allocate warning data array\n");
-		g_warning_data_size = 0;
+	modal->warnings = calloc(modal->total_field_count, sizeof(warning_data_t));
+	if (!modal->warnings) {
+		LOG_E(TAG, "Failed to allocate warning data array");
 	}
 }
 
 // Cleanup warning data array
-static void cleanup_warning_data(void)
+static void cleanup_warning_data(alerts_modal_t* modal)
 {
-	if (g_warning_data) {
-		free(g_warning_data);
-		g_warning_data = NULL;
-		g_warning_data_size = 0;
+	if (modal->warnings) {
+		free(modal->warnings);
+		modal->warnings = NULL;
 	}
 }
 
 // Get warning data with bounds checking
-static warning_data_t* get_warning_data(int field_id)
+static warning_data_t* get_warning_data(alerts_modal_t* modal, int field_id)
 {
-	if (!g_warning_data || field_id < 0 || field_id >= g_warning_data_size) {
+	if (!modal->warnings || field_id < 0 || field_id >= modal->total_field_count) {
 		return NULL;
 	}
-	return &g_warning_data[field_id];
+	return &modal->warnings[field_id];
 }
 
 static void hide_out_of_range_warning(alerts_modal_t* modal, int field_id)
@@ -1584,7 +1611,7 @@ static void hide_out_of_range_warning(alerts_modal_t* modal, int field_id)
 	modal->field_data[field_id].is_out_of_range = false;
 
 	// Get warning data with bounds checking
-	warning_data_t* warning_data = get_warning_data(field_id);
+	warning_data_t* warning_data = get_warning_data(modal, field_id);
 	if (!warning_data) return;
 
 	// Hide warning UI elements
@@ -1631,11 +1658,11 @@ static void warning_timer_callback(lv_timer_t* timer)
 	warning_data_t* data = (warning_data_t*)lv_timer_get_user_data(timer);
 	if (!data || !data->modal) return;
 
-	printf("[I] alerts_modal: Warning timer callback called for field %d\n", data->field_id);
+	LOG_I(TAG, "Warning timer callback called for field %d", data->field_id);
 
 	// Revert the field value to the clamped value (midpoint between min and max)
 	field_data_t* field_data = &data->modal->field_data[data->field_id];
-	printf("[I] alerts_modal: Timer callback - field %d, stored clamped value: %.1f\n", data->field_id, data->clamped_value);
+	LOG_I(TAG, "Timer callback - field %d, stored clamped value: %.1f", data->field_id, data->clamped_value);
 	field_data->current_value = data->clamped_value;
 	field_data->is_out_of_range = false;
 
@@ -1663,137 +1690,366 @@ static void warning_timer_callback(lv_timer_t* timer)
 	update_field_display(data->modal, data->field_id);
 	update_all_field_borders(data->modal);
 
-	printf("[I] alerts_modal: Warning timer expired, reverted to clamped value %.1f\n", data->clamped_value);
+	LOG_I(TAG, "Warning timer expired, reverted to clamped value %.1f", data->clamped_value);
 }
 
-// Create gauge section (maintains original visual design)
-static void create_gauge_section(alerts_modal_t* modal, int gauge, lv_obj_t* parent, int y_offset)
+// Create a gauge section row (maintains original visual design); bind_row() places it
+// and sets the gauge title
+static void create_gauge_section(alerts_modal_t* modal, alerts_modal_row_t* row)
 {
-	if (!modal || gauge >= modal->config.gauge_count) return;
+	if (!modal || !row) return;
 
 	// Gauge section container
-	modal->gauge_sections[gauge] = lv_obj_create(parent);
-	lv_obj_set_size(modal->gauge_sections[gauge], LV_PCT(100), 200);  // Increased from 160 to 200
-	lv_obj_set_pos(modal->gauge_sections[gauge], 0, y_offset);
-	lv_obj_set_style_bg_opa(modal->gauge_sections[gauge], LV_OPA_TRANSP, 0);
-	lv_obj_set_style_border_width(modal->gauge_sections[gauge], 2, 0);
-	lv_obj_set_style_border_color(modal->gauge_sections[gauge], PALETTE_WHITE, 0);
-	lv_obj_set_style_pad_all(modal->gauge_sections[gauge], 1, 0);  // Minimal padding for maximum space
-	lv_obj_clear_flag(modal->gauge_sections[gauge], LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_add_flag(modal->gauge_sections[gauge], LV_OBJ_FLAG_EVENT_BUBBLE);
+	row->section = lv_obj_create(modal->content_container);
+	lv_obj_set_size(row->section, LV_PCT(100), GAUGE_SECTION_HEIGHT);  // Increased from 160 to 200
+	lv_obj_set_style_bg_opa(row->section, LV_OPA_TRANSP, 0);
+	lv_obj_set_style_border_width(row->section, 2, 0);
+	lv_obj_set_style_border_color(row->section, PALETTE_WHITE, 0);
+	lv_obj_set_style_pad_all(row->section, 1, 0);  // Minimal padding for maximum space
+	lv_obj_clear_flag(row->section, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_add_flag(row->section, LV_OBJ_FLAG_EVENT_BUBBLE);
 
 	// Gauge Title - positioned inline with border like detail_screen
 	// Create as child of root modal container so it's not clipped by gauge_sections
-	modal->gauge_titles[gauge] = lv_label_create(modal->content_container);
-	lv_label_set_text(modal->gauge_titles[gauge], modal->config.gauges[gauge].name);
-	lv_obj_set_style_text_color(modal->gauge_titles[gauge], DEFAULT_GAUGE_TITLE_TEXT_COLOR, 0);
-	lv_obj_set_style_text_font(modal->gauge_titles[gauge], &lv_font_montserrat_16, 0);
-	lv_obj_set_style_bg_color(modal->gauge_titles[gauge], DEFAULT_GAUGE_TITLE_BACKGROUND_COLOR, 0); // Blue background to obscure border
-	lv_obj_set_style_bg_opa(modal->gauge_titles[gauge], LV_OPA_COVER, 0);
-	lv_obj_set_style_pad_left(modal->gauge_titles[gauge], 8, 0);
-	lv_obj_set_style_pad_right(modal->gauge_titles[gauge], 8, 0);
-	lv_obj_set_style_pad_top(modal->gauge_titles[gauge], 2, 0);
-	lv_obj_set_style_pad_bottom(modal->gauge_titles[gauge], 2, 0);
-	lv_obj_set_style_radius(modal->gauge_titles[gauge], 5, 0);
-	lv_obj_align_to(modal->gauge_titles[gauge], modal->gauge_sections[gauge], LV_ALIGN_OUT_TOP_RIGHT, -10, 10);
+	row->gauge_title = lv_label_create(modal->content_container);
+	lv_obj_set_style_text_color(row->gauge_title, DEFAULT_GAUGE_TITLE_TEXT_COLOR, 0);
+	lv_obj_set_style_text_font(row->gauge_title, &lv_font_montserrat_16, 0);
+	lv_obj_set_style_bg_color(row->gauge_title, DEFAULT_GAUGE_TITLE_BACKGROUND_COLOR, 0); // Blue background to obscure border
+	lv_obj_set_style_bg_opa(row->gauge_title, LV_OPA_COVER, 0);
+	lv_obj_set_style_pad_left(row->gauge_title, 8, 0);
+	lv_obj_set_style_pad_right(row->gauge_title, 8, 0);
+	lv_obj_set_style_pad_top(row->gauge_title, 2, 0);
+	lv_obj_set_style_pad_bottom(row->gauge_title, 2, 0);
+	lv_obj_set_style_radius(row->gauge_title, 5, 0);
 
 	// Create ALERTS group - 2 units wide using flexbox, balanced margins
-	modal->alert_groups[gauge] = lv_obj_create(modal->gauge_sections[gauge]);
+	row->alert_group = lv_obj_create(row->section);
 
 	// Layout
-	lv_obj_set_size(modal->alert_groups[gauge], LV_PCT(38), 140);  // Reduced width to make room for GAUGE
-	lv_obj_set_pos(modal->alert_groups[gauge], 8, 32);  // 8px left margin (A), reduced y by 3px
+	lv_obj_set_size(row->alert_group, LV_PCT(38), 140);  // Reduced width to make room for GAUGE
+	lv_obj_set_pos(row->alert_group, 8, 32);  // 8px left margin (A), reduced y by 3px
 
-	lv_obj_set_layout(modal->alert_groups[gauge], LV_LAYOUT_FLEX);
-	lv_obj_set_flex_flow(modal->alert_groups[gauge], LV_FLEX_FLOW_ROW);
-	lv_obj_set_flex_align(modal->alert_groups[gauge], LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+	lv_obj_set_layout(row->alert_group, LV_LAYOUT_FLEX);
+	lv_obj_set_flex_flow(row->alert_group, LV_FLEX_FLOW_ROW);
+	lv_obj_set_flex_align(row->alert_group, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
 	// Style
-	lv_obj_set_style_bg_opa(modal->alert_groups[gauge], LV_OPA_TRANSP, 0);
-	lv_obj_set_style_border_width(modal->alert_groups[gauge], 2, 0);
-	lv_obj_set_style_border_color(modal->alert_groups[gauge], PALETTE_WHITE, 0);
-	lv_obj_set_style_radius(modal->alert_groups[gauge], 5, 0);
-	lv_obj_set_style_pad_all(modal->alert_groups[gauge], 0, 0);  // No internal padding for maximum space
+	lv_obj_set_style_bg_opa(row->alert_group, LV_OPA_TRANSP, 0);
+	lv_obj_set_style_border_width(row->alert_group, 2, 0);
+	lv_obj_set_style_border_color(row->alert_group, PALETTE_WHITE, 0);
+	lv_obj_set_style_radius(row->alert_group, 5, 0);
+	lv_obj_set_style_pad_all(row->alert_group, 0, 0);  // No internal padding for maximum space
 
 	// Properties
-	lv_obj_clear_flag(modal->alert_groups[gauge], LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_add_flag(modal->alert_groups[gauge], LV_OBJ_FLAG_EVENT_BUBBLE);
+	lv_obj_clear_flag(row->alert_group, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_add_flag(row->alert_group, LV_OBJ_FLAG_EVENT_BUBBLE);
 
 
 	// ALERTS group title - positioned inline with border like detail_screen // do not style here
-	modal->alert_titles[gauge] = lv_label_create(modal->gauge_sections[gauge]);
-	lv_label_set_text(modal->alert_titles[gauge], "ALERTS");
-	lv_obj_set_style_text_color(modal->alert_titles[gauge], DEFAULT_FIELD_ALERT_GROUP_TITLE_TEXT_COLOR, 0);
-	lv_obj_set_style_text_font(modal->alert_titles[gauge], &lv_font_montserrat_12, 0);
-	lv_obj_set_style_bg_color(modal->alert_titles[gauge], PALETTE_RED, 0); // Black background to obscure border
-	lv_obj_set_style_bg_opa(modal->alert_titles[gauge], LV_OPA_COVER, 0);
-	lv_obj_set_style_pad_left(modal->alert_titles[gauge], 8, 0);
-	lv_obj_set_style_pad_right(modal->alert_titles[gauge], 8, 0);
-	lv_obj_set_style_pad_top(modal->alert_titles[gauge], 2, 0);
-	lv_obj_set_style_pad_bottom(modal->alert_titles[gauge], 2, 0);
-	// lv_obj_set_style_border_width(modal->alert_titles[gauge], 0, 0);
-	lv_obj_set_style_radius(modal->alert_titles[gauge], 3, 0);
-
-
-	lv_obj_align_to(modal->alert_titles[gauge], modal->alert_groups[gauge], LV_ALIGN_OUT_TOP_LEFT, 10, 10);
+	row->alert_title = lv_label_create(row->section);
+	lv_label_set_text(row->alert_title, "ALERTS");
+	lv_obj_set_style_text_color(row->alert_title, DEFAULT_FIELD_ALERT_GROUP_TITLE_TEXT_COLOR, 0);
+	lv_obj_set_style_text_font(row->alert_title, &lv_font_montserrat_12, 0);
+	lv_obj_set_style_bg_color(row->alert_title, PALETTE_RED, 0); // Black background to obscure border
+	lv_obj_set_style_bg_opa(row->alert_title, LV_OPA_COVER, 0);
+	lv_obj_set_style_pad_left(row->alert_title, 8, 0);
+	lv_obj_set_style_pad_right(row->alert_title, 8, 0);
+	lv_obj_set_style_pad_top(row->alert_title, 2, 0);
+	lv_obj_set_style_pad_bottom(row->alert_title, 2, 0);
+	// lv_obj_set_style_border_width(row->alert_title, 0, 0);
+	lv_obj_set_style_radius(row->alert_title, 3, 0);
+
+
+	lv_obj_align_to(row->alert_title, row->alert_group, LV_ALIGN_OUT_TOP_LEFT, 10, 10);
 
 	// Create GAUGE group - 3 units wide using flexbox, positioned to the right of ALERTS
-	modal->gauge_groups[gauge] = lv_obj_create(modal->gauge_sections[gauge]);
+	row->gauge_group = lv_obj_create(row->section);
 
 	// Layout
-	lv_obj_set_size(modal->gauge_groups[gauge], LV_PCT(57), 140);  // Increased width to fill remaining space
-	lv_obj_align_to(modal->gauge_groups[gauge], modal->alert_groups[gauge], LV_ALIGN_OUT_RIGHT_MID, 8, 0); // Position to the right of ALERTS group with 8px gap
-	lv_obj_set_layout(modal->gauge_groups[gauge], LV_LAYOUT_FLEX);
-	lv_obj_set_flex_flow(modal->gauge_groups[gauge], LV_FLEX_FLOW_ROW);
-	lv_obj_set_flex_align(modal->gauge_groups[gauge], LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+	lv_obj_set_size(row->gauge_group, LV_PCT(57), 140);  // Increased width to fill remaining space
+	lv_obj_align_to(row->gauge_group, row->alert_group, LV_ALIGN_OUT_RIGHT_MID, 8, 0); // Position to the right of ALERTS group with 8px gap
+	lv_obj_set_layout(row->gauge_group, LV_LAYOUT_FLEX);
+	lv_obj_set_flex_flow(row->gauge_group, LV_FLEX_FLOW_ROW);
+	lv_obj_set_flex_align(row->gauge_group, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
 	// Style
-	lv_obj_set_style_bg_opa(modal->gauge_groups[gauge], LV_OPA_TRANSP, 0);
-	lv_obj_set_style_border_width(modal->gauge_groups[gauge], 2, 0);
-	lv_obj_set_style_border_color(modal->gauge_groups[gauge], PALETTE_WHITE, 0);
-	lv_obj_set_style_radius(modal->gauge_groups[gauge], 5, 0);
-	lv_obj_set_style_pad_all(modal->gauge_groups[gauge], 0, 0);  // No internal padding for maximum space
+	lv_obj_set_style_bg_opa(row->gauge_group, LV_OPA_TRANSP, 0);
+	lv_obj_set_style_border_width(row->gauge_group, 2, 0);
+	lv_obj_set_style_border_color(row->gauge_group, PALETTE_WHITE, 0);
+	lv_obj_set_style_radius(row->gauge_group, 5, 0);
+	lv_obj_set_style_pad_all(row->gauge_group, 0, 0);  // No internal padding for maximum space
 
 	// Properties
-	lv_obj_clear_flag(modal->gauge_groups[gauge], LV_OBJ_FLAG_SCROLLABLE);
-	lv_obj_add_flag(modal->gauge_groups[gauge], LV_OBJ_FLAG_EVENT_BUBBLE);
+	lv_obj_clear_flag(row->gauge_group, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_add_flag(row->gauge_group, LV_OBJ_FLAG_EVENT_BUBBLE);
 
 
 	// GAUGE group title - positioned inline with border like detail_screen
-	modal->gauge_group_title[gauge] = lv_label_create(modal->gauge_sections[gauge]);
-	lv_label_set_text(modal->gauge_group_title[gauge], "GAUGE");
-	lv_obj_set_style_text_color(modal->gauge_group_title[gauge], DEFAULT_FIELD_GAUGE_GROUP_TITLE_TEXT_COLOR, 0);
-	lv_obj_set_style_text_font(modal->gauge_group_title[gauge], &lv_font_montserrat_12, 0);
-	lv_obj_set_style_bg_color(modal->gauge_group_title[gauge], lv_color_hex(0x8F4700), 0); // Black background to obscure border
-	lv_obj_set_style_bg_opa(modal->gauge_group_title[gauge], LV_OPA_COVER, 0);
-	lv_obj_set_style_pad_left(modal->gauge_group_title[gauge], 8, 0);
-	lv_obj_set_style_pad_right(modal->gauge_group_title[gauge], 8, 0);
-	lv_obj_set_style_pad_top(modal->gauge_group_title[gauge], 2, 0);
-	lv_obj_set_style_pad_bottom(modal->gauge_group_title[gauge], 2, 0);
-	lv_obj_set_style_radius(modal->gauge_group_title[gauge], 3, 0);
-	lv_obj_align_to(modal->gauge_group_title[gauge], modal->gauge_groups[gauge], LV_ALIGN_OUT_TOP_LEFT, 10, 10);
+	row->gauge_group_title = lv_label_create(row->section);
+	lv_label_set_text(row->gauge_group_title, "GAUGE");
+	lv_obj_set_style_text_color(row->gauge_group_title, DEFAULT_FIELD_GAUGE_GROUP_TITLE_TEXT_COLOR, 0);
+	lv_obj_set_style_text_font(row->gauge_group_title, &lv_font_montserrat_12, 0);
+	lv_obj_set_style_bg_color(row->gauge_group_title, lv_color_hex(0x8F4700), 0); // Black background to obscure border
+	lv_obj_set_style_bg_opa(row->gauge_group_title, LV_OPA_COVER, 0);
+	lv_obj_set_style_pad_left(row->gauge_group_title, 8, 0);
+	lv_obj_set_style_pad_right(row->gauge_group_title, 8, 0);
+	lv_obj_set_style_pad_top(row->gauge_group_title, 2, 0);
+	lv_obj_set_style_pad_bottom(row->gauge_group_title, 2, 0);
+	lv_obj_set_style_radius(row->gauge_group_title, 3, 0);
+	lv_obj_align_to(row->gauge_group_title, row->gauge_group, LV_ALIGN_OUT_TOP_LEFT, 10, 10);
+}
+
+
+
+/* ===== Virtualized list ===== */
+// The scroll content holds a few gauge section rows, enough for the viewport plus
+// GAUGE_SECTION_MARGIN on each side, and a spacer that keeps the scroll range of the
+// whole list. Scrolling rebinds rows that left the window to the gauges entering it:
+// a rebind only moves the row and sets its texts and values, the row's widgets and
+// static styling are kept. Field state lives in field_data, so unbound gauges keep it.
+
+// The row of the field being edited and rows showing a warning stay bound
+static bool gauge_is_pinned(alerts_modal_t* modal, int gauge)
+{
+	if (modal->current_field_id >= 0 && modal->field_data[modal->current_field_id].gauge_index == gauge) {
+
+		return true;
+	}
+	for (int field_type = 0; field_type < 5; field_type++) {
+
+		warning_data_t* warning_data = get_warning_data(modal, gauge * 5 + field_type);
+		if (warning_data && (warning_data->text_label || warning_data->container)) return true;
+	}
+	return false;
+}
+
+// Publishes a field of a bound row in field_ui and shows its value
+static void bind_field(alerts_modal_t* modal, alerts_modal_row_t* row, int field_type)
+{
+	field_ui_t* ui = &row->fields[field_type];
+	if (row->gauge < 0 || !ui->button) return;
+
+	int field_id = row->gauge * 5 + field_type;
+	lv_label_set_text(ui->title, modal->config.gauges[row->gauge].fields[field_type].name);
+	modal->field_ui[field_id] = *ui;
+	update_field_display(modal, field_id);
+}
+
+static void bind_row(alerts_modal_t* modal, alerts_modal_row_t* row, int gauge)
+{
+	row->gauge = gauge;
+
+	lv_obj_set_pos(row->section, 0, gauge * GAUGE_SECTION_PITCH);
+	lv_obj_remove_flag(row->section, LV_OBJ_FLAG_HIDDEN);
+	lv_label_set_text(row->gauge_title, modal->config.gauges[gauge].name);
+	lv_obj_remove_flag(row->gauge_title, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_align_to(row->gauge_title, row->section, LV_ALIGN_OUT_TOP_RIGHT, -10, 10);
+
+	modal->gauge_sections[gauge] = row->section;
+	modal->alert_groups[gauge] = row->alert_group;
+	modal->gauge_groups[gauge] = row->gauge_group;
+	modal->gauge_titles[gauge] = row->gauge_title;
+	modal->alert_titles[gauge] = row->alert_title;
+	modal->gauge_group_title[gauge] = row->gauge_group_title;
+
+	for (int field_type = 0; field_type < 5; field_type++) {
+		bind_field(modal, row, field_type);
+	}
+}
+
+static void unbind_row(alerts_modal_t* modal, alerts_modal_row_t* row)
+{
+	int gauge = row->gauge;
+	if (gauge < 0) return;
+
+	modal->gauge_sections[gauge] = NULL;
+	modal->alert_groups[gauge] = NULL;
+	modal->gauge_groups[gauge] = NULL;
+	modal->gauge_titles[gauge] = NULL;
+	modal->alert_titles[gauge] = NULL;
+	modal->gauge_group_title[gauge] = NULL;
+	memset(&modal->field_ui[gauge * 5], 0, 5 * sizeof(field_ui_t));
+
+	// Hidden until rebound, in case no gauge needs it right away
+	lv_obj_add_flag(row->section, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_add_flag(row->gauge_title, LV_OBJ_FLAG_HIDDEN);
+	row->gauge = -1;
+}
+
+// Binds the gauges within the viewport (plus margin) to rows; true if any row was
+// (re)bound, which then needs update_all_field_borders()
+static bool virtualize_rows(alerts_modal_t* modal)
+{
+	if (!modal || !modal->rows) return false;
+
+	int scroll_y = lv_obj_get_scroll_y(modal->content_container);
+	if (scroll_y < 0) scroll_y = 0;
+
+	int first = scroll_y / GAUGE_SECTION_PITCH - GAUGE_SECTION_MARGIN;
+	int last = (scroll_y + CONTENT_HEIGHT) / GAUGE_SECTION_PITCH + GAUGE_SECTION_MARGIN;
+	if (first < 0) first = 0;
+	if (last >= modal->config.gauge_count) last = modal->config.gauge_count - 1;
+
+	// Free the rows that left the window
+	for (int r = 0; r < modal->row_count; r++) {
+
+		alerts_modal_row_t* row = &modal->rows[r];
+		if (row->gauge < 0 || (row->gauge >= first && row->gauge <= last)) continue;
+		if (gauge_is_pinned(modal, row->gauge)) continue;
+
+		unbind_row(modal, row);
+	}
+
+	// Bind the gauges that entered it
+	bool rebound = false;
+	int free_row = 0;
+	for (int gauge = first; gauge <= last; gauge++) {
+
+		if (modal->gauge_sections[gauge]) continue;
+
+		while (free_row < modal->row_count && modal->rows[free_row].gauge >= 0) free_row++;
+		if (free_row >= modal->row_count) {
+
+			LOG_W(TAG, "No free row for gauge %d", gauge);
+			break;
+		}
+		bind_row(modal, &modal->rows[free_row], gauge);
+		modal->rows_rebound++;
+		rebound = true;
+	}
+	return rebound;
+}
+
+/* ===== Incremental construction ===== */
+// alerts_modal_create() builds the skeleton (background, scroll container, CANCEL and
+// DONE), which shows right away; the rows and their fields follow one per step, as many
+// steps per frame as the ui_build budget allows. Handlers that need every field finish
+// the build first.
+
+static void create_field(alerts_modal_t* modal, alerts_modal_row_t* row, int field_type)
+{
+	// Create the field container for this field
+	lv_obj_t* field_container = NULL;
+	if (field_type == FIELD_ALERT_LOW || field_type == FIELD_ALERT_HIGH) {
+
+		field_container = lv_obj_create(row->alert_group);
+	} else {
+
+		field_container = lv_obj_create(row->gauge_group);
+	}
+
+	lv_obj_clear_flag(field_container, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_add_flag(field_container, LV_OBJ_FLAG_EVENT_BUBBLE);
+
+	// Field Container ( Button and Title)
+	lv_obj_set_size(field_container, 63, 82); // 3px wider for negative values
+
+	// Layout
+	lv_obj_set_layout(field_container, LV_LAYOUT_FLEX);
+	lv_obj_set_flex_flow(field_container, LV_FLEX_FLOW_COLUMN);
+	lv_obj_set_flex_align(field_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+	// Style
+	lv_obj_set_style_bg_opa(field_container, LV_OPA_TRANSP, 0);
+	lv_obj_set_style_border_width(field_container, 0, 0);
+	lv_obj_set_style_border_color(field_container, PALETTE_WHITE, 0);
+	lv_obj_set_style_radius(field_container, 0, 0);
+	lv_obj_set_style_pad_all(field_container, 1, 1);  // Add padding to accommodate child border
+
+	// Field Value (Button)
+	lv_obj_t* field_value_container = lv_obj_create( field_container );
+	lv_obj_set_size(field_value_container, 63, 60); // 3px wider for negative values
+	lv_obj_set_style_border_color(field_value_container, PALETTE_WHITE, 0);
+	lv_obj_set_style_border_width(field_value_container, 2, 0);
+	lv_obj_set_style_border_opa(field_value_container, LV_OPA_COVER, 0);
+	lv_obj_set_style_radius(field_value_container, 8, 0);
+
+	lv_obj_clear_flag(field_value_container, LV_OBJ_FLAG_SCROLLABLE);
+	lv_obj_add_flag(field_value_container, LV_OBJ_FLAG_EVENT_BUBBLE);
+
+	// Numeric Value (Button)
+	lv_obj_t* number_label = lv_label_create(field_value_container);
+	lv_obj_set_style_text_color(number_label, lv_color_hex(0xfffff), 0);
+	lv_obj_set_style_bg_color(number_label, PALETTE_RED, 0);
+	lv_obj_set_style_bg_opa(field_value_container, LV_OPA_COVER, 0);
+	lv_obj_set_style_bg_color(field_value_container, PALETTE_RED, 0);
+	lv_obj_set_style_text_font(number_label, &lv_font_noplato_24, 0);
+	lv_obj_set_style_pad_bottom(number_label, 0, 0);
+	lv_obj_center(number_label);
+
+	// Title
+	lv_obj_t*title_label = lv_label_create( field_container );
+
+	lv_obj_set_style_text_color(title_label, PALETTE_WHITE, 0);
+	lv_obj_set_style_text_font(title_label, &lv_font_montserrat_12, 0);
+	lv_obj_set_style_bg_color(title_label, PALETTE_BLACK, 0);
+	lv_obj_set_style_bg_opa(title_label, LV_OPA_COVER, 0);
+	lv_obj_set_style_pad_left(title_label, 4, 0);
+	lv_obj_set_style_pad_right(title_label, 4, 0);
+	lv_obj_set_style_pad_top(title_label, 0, 0);
+	lv_obj_set_style_pad_bottom(title_label, 2, 0);
+	lv_obj_set_style_margin_top(title_label, -8, 0);
+	lv_obj_set_style_radius(title_label, 3, 0);
+
+	// map field UI values
+	row->fields[field_type].button = field_value_container;
+	row->fields[field_type].label = number_label;
+	row->fields[field_type].title = title_label;
+
+	// Borders of all fields are applied by the last build step
+	bind_field(modal, row, field_type);
 }
 
+static ui_build_status_t alerts_modal_build_step(void* ctx, int step)
+{
+	alerts_modal_t* modal = (alerts_modal_t*)ctx;
 
+	// Top to bottom: each row, bound to the gauge at its index, then its 5 fields
+	int row_index = step / 6;
+	if (row_index < modal->row_count) {
+
+		alerts_modal_row_t* row = &modal->rows[row_index];
+		int part = step % 6;
+		if (part == 0) {
+
+			create_gauge_section(modal, row);
+			bind_row(modal, row, row_index);
+		} else {
+
+			create_field(modal, row, part - 1);
+		}
+		return UI_BUILD_CONTINUE;
+	}
+
+	// Catch up with any scrolling during the build, then apply all border styling
+	virtualize_rows(modal);
+	update_all_field_borders(modal);
+
+	// Shared numberpad: built here if this is its first user
+	bind_numberpad(modal);
+	return UI_BUILD_DONE;
+}
 
 // Public API functions
 alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*on_close_callback)(void))
 {
-	printf("[I] alerts_modal: Creating generic alerts modal\n");
+	LOG_I(TAG, "Creating generic alerts modal");
 
 	if (!config) {
-		printf("[E] alerts_modal: Configuration is required\n");
+		LOG_E(TAG, "Configuration is required");
 		return NULL;
 	}
 
 	if (config->gauge_count <= 0 || !config->gauges) {
-		printf("[E] alerts_modal: Invalid gauge configuration\n");
+		LOG_E(TAG, "Invalid gauge configuration");
 		return NULL;
 	}
 
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
+
 	alerts_modal_t* modal = malloc(sizeof(alerts_modal_t));
 	if (!modal) {
-		printf("[E] alerts_modal: Failed to allocate memory for alerts modal\n");
+		LOG_E(TAG, "Failed to allocate memory for alerts modal");
 		return NULL;
 	}
 
@@ -1804,7 +2060,7 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 	modal->total_field_count = config->gauge_count * 5; // 5 fields per gauge
 
 	// Initialize warning data array
-	init_warning_data(modal->total_field_count);
+	init_warning_data(modal);
 
 	// Allocate dynamic arrays
 	modal->gauge_sections = calloc(config->gauge_count, sizeof(lv_obj_t*));
@@ -1816,10 +2072,17 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 	modal->field_ui = calloc(modal->total_field_count, sizeof(field_ui_t));
 	modal->field_data = calloc(modal->total_field_count, sizeof(field_data_t));
 
+	// Rows for the viewport, the partial sections at both of its edges, the margins and
+	// a pinned row scrolled away
+	int viewport_rows = (CONTENT_HEIGHT + GAUGE_SECTION_PITCH - 1) / GAUGE_SECTION_PITCH + 1;
+	modal->row_count = viewport_rows + 2 * GAUGE_SECTION_MARGIN + 1;
+	if (modal->row_count > config->gauge_count) modal->row_count = config->gauge_count;
+	modal->rows = calloc(modal->row_count, sizeof(alerts_modal_row_t));
+
 	if (!modal->gauge_sections || !modal->alert_groups || !modal->gauge_groups ||
 		!modal->gauge_titles || !modal->alert_titles || !modal->gauge_group_title ||
-		!modal->field_ui || !modal->field_data) {
-		printf("[E] alerts_modal: Failed to allocate memory for dynamic arrays\n");
+		!modal->field_ui || !modal->field_data || !modal->rows) {
+		LOG_E(TAG, "Failed to allocate memory for dynamic arrays");
 		alerts_modal_destroy(modal);
 		return NULL;
 	}
@@ -1838,7 +2101,7 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 
 	// Create scrollable content container - leave space for fixed button container at bottom
 	modal->content_container = lv_obj_create(modal->background);
-	lv_obj_set_size(modal->content_container, LV_PCT(100), 740); // Height = 800 - 60 (button height)
+	lv_obj_set_size(modal->content_container, LV_PCT(100), CONTENT_HEIGHT);
 	lv_obj_set_pos(modal->content_container, 0, 0);
 	lv_obj_set_style_bg_color(modal->content_container, PALETTE_BLACK, 0);
 	lv_obj_set_style_border_color(modal->content_container, PALETTE_BLACK, 0);
@@ -1850,10 +2113,12 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 	lv_obj_set_scroll_dir(modal->content_container, LV_DIR_VER);
 	lv_obj_clear_flag(modal->content_container, LV_OBJ_FLAG_SCROLL_ELASTIC);
 
-	// Create gauge sections with appropriate spacing for 6 gauges
-		for (int i = 0; i < config->gauge_count; i++) {
-		create_gauge_section(modal, i, modal->content_container, i * 240);  // Reduced spacing for 6 gauges
-	}
+	// Scroll range of the whole list: where the last gauge section would be
+	lv_obj_t* scroll_spacer = lv_obj_create(modal->content_container);
+	lv_obj_remove_style_all(scroll_spacer);
+	lv_obj_set_size(scroll_spacer, 1, GAUGE_SECTION_HEIGHT);
+	lv_obj_set_pos(scroll_spacer, 0, (config->gauge_count - 1) * GAUGE_SECTION_PITCH);
+	lv_obj_clear_flag(scroll_spacer, LV_OBJ_FLAG_CLICKABLE);
 
 	// Button Container - fixed at bottom of screen (not scrollable)
 	lv_obj_t* button_container = lv_obj_create(modal->background);
@@ -1908,7 +2173,7 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 	lv_obj_update_layout(modal->content_container);
 
 	// Debug: Log button positions
-	printf("[I] alerts_modal: Button container fixed at bottom of screen (y=740, height=60)\n");
+	LOG_I(TAG, "Button container fixed at bottom of screen (y=740, height=60)");
 
 	// Add field click handler to modal containers to handle all clicks
 	lv_obj_add_event_cb(modal->background, field_click_handler, LV_EVENT_CLICKED, modal);
@@ -1926,122 +2191,65 @@ alerts_modal_t* alerts_modal_create(const alerts_modal_config_t* config, void (*
 		for (int field_type = 0; field_type < 5; field_type++) { // 5 fields per gauge
 			int field_id = gauge * 5 + field_type;
 			initialize_field_data(&modal->field_data[field_id], gauge, field_type, config);
+
+			// Load value from device state; rows show it while bound to the gauge
+			field_data_t* data = &modal->field_data[field_id];
+			data->current_value = get_device_state_value(modal, gauge, field_type);
+			data->original_value = data->current_value;
 		}
 	}
 
-	// Create field containers and populate fields
-	for (int field_id = 0; field_id < modal->total_field_count; field_id++) {
+	for (int r = 0; r < modal->row_count; r++) {
+		modal->rows[r].gauge = -1;
+	}
 
-		field_data_t* data = &modal->field_data[field_id];
+	// Rows and fields follow, a few per frame (alerts_modal_build_step)
+	ui_build_start(&modal->build, "alerts_modal_build", alerts_modal_build_step, modal, NULL);
 
-		// Create the field container for this field
-		lv_obj_t* field_container = NULL;
-		if (data->group_type == GROUP_ALERTS) {
-			// For ALERTS group, create field container
-			if (data->field_index < 2) { // FIELD_ALERT_LOW or FIELD_ALERT_HIGH
+	// Initially hidden
+	lv_obj_add_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
+	modal->is_visible = false;
 
-				field_container = lv_obj_create(modal->alert_groups[data->gauge_index]);
-			}
-		} else if (data->group_type == GROUP_GAUGE) {
-			// For GAUGE group, create field container
-			if (data->field_index >= 2 && data->field_index < 5) { // FIELD_GAUGE_LOW, FIELD_GAUGE_BASELINE, FIELD_GAUGE_HIGH
+	LOG_I(TAG, "Properly refactored alerts modal created");
+	return modal;
+}
 
-				field_container = lv_obj_create(modal->gauge_groups[data->gauge_index]);
-			}
-		}
+// A pooled modal is shown again and again: reread every field from device state (only
+// fields bound to a row are redrawn)
+static void reload_field_values(alerts_modal_t* modal)
+{
+	for (int field_id = 0; field_id < modal->total_field_count; field_id++) {
 
-		lv_obj_clear_flag(field_container, LV_OBJ_FLAG_SCROLLABLE);
-		lv_obj_add_flag(field_container, LV_OBJ_FLAG_EVENT_BUBBLE);
-
-		if (!field_container) continue;
-
-		// Field Container ( Button and Title)
-		lv_obj_set_size(field_container, 63, 82); // 3px wider for negative values
-
-		// Layout
-		lv_obj_set_layout(field_container, LV_LAYOUT_FLEX);
-		lv_obj_set_flex_flow(field_container, LV_FLEX_FLOW_COLUMN);
-		lv_obj_set_flex_align(field_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-
-		// Style
-		lv_obj_set_style_bg_opa(field_container, LV_OPA_TRANSP, 0);
-		lv_obj_set_style_border_width(field_container, 0, 0);
-		lv_obj_set_style_border_color(field_container, PALETTE_WHITE, 0);
-		lv_obj_set_style_radius(field_container, 0, 0);
-		lv_obj_set_style_pad_all(field_container, 1, 1);  // Add padding to accommodate child border
-
-		// Field Value (Button)
-		lv_obj_t* field_value_container = lv_obj_create( field_container );
-		lv_obj_set_size(field_value_container, 63, 60); // 3px wider for negative values
-		lv_obj_set_style_border_color(field_value_container, PALETTE_WHITE, 0);
-		lv_obj_set_style_border_width(field_value_container, 2, 0);
-		lv_obj_set_style_border_opa(field_value_container, LV_OPA_COVER, 0);
-		lv_obj_set_style_radius(field_value_container, 8, 0);
-
-		lv_obj_clear_flag(field_value_container, LV_OBJ_FLAG_SCROLLABLE);
-		lv_obj_add_flag(field_value_container, LV_OBJ_FLAG_EVENT_BUBBLE);
-
-		// Numeric Value (Button)
-		lv_obj_t* number_label = lv_label_create(field_value_container);
-		lv_obj_set_style_text_color(number_label, lv_color_hex(0xfffff), 0);
-		lv_obj_set_style_bg_color(number_label, PALETTE_RED, 0);
-		lv_obj_set_style_bg_opa(field_value_container, LV_OPA_COVER, 0);
-		lv_obj_set_style_bg_color(field_value_container, PALETTE_RED, 0);
-		lv_obj_set_style_text_font(number_label, &lv_font_noplato_24, 0);
-		lv_obj_set_style_pad_bottom(number_label, 0, 0);
-		lv_obj_center(number_label);
-
-		// Title
-		lv_obj_t*title_label = lv_label_create( field_container );
-
-		lv_label_set_text(title_label, config->gauges[data->gauge_index].fields[data->field_index].name);
-		lv_obj_set_style_text_color(title_label, PALETTE_WHITE, 0);
-		lv_obj_set_style_text_font(title_label, &lv_font_montserrat_12, 0);
-		lv_obj_set_style_bg_color(title_label, PALETTE_BLACK, 0);
-		lv_obj_set_style_bg_opa(title_label, LV_OPA_COVER, 0);
-		lv_obj_set_style_pad_left(title_label, 4, 0);
-		lv_obj_set_style_pad_right(title_label, 4, 0);
-		lv_obj_set_style_pad_top(title_label, 0, 0);
-		lv_obj_set_style_pad_bottom(title_label, 2, 0);
-		lv_obj_set_style_margin_top(title_label, -8, 0);
-		lv_obj_set_style_radius(title_label, 3, 0);
-
-		// map field UI values
-		modal->field_ui[field_id].button = field_value_container;
-		modal->field_ui[field_id].label = number_label;
-		modal->field_ui[field_id].title = title_label;
-
-		// Load value from device state
+		field_data_t* data = &modal->field_data[field_id];
 		float loaded_value = get_device_state_value(modal, data->gauge_index, data->field_index);
 		data->current_value = loaded_value;
 		data->original_value = loaded_value;
-
-		// Update display and border
+		data->is_being_edited = false;
+		data->has_changed = false;
+		data->is_out_of_range = false;
 		update_field_display(modal, field_id);
-		update_all_field_borders(modal);
-		// Note: update_all_field_borders will be called at the end of field creation
 	}
+	modal->current_field_id = -1;
 
-	// Apply all border styling after field creation
-	update_all_field_borders(modal);
-
-	// Initially hidden
-	lv_obj_add_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
-	modal->is_visible = false;
+	// Containers may not all exist yet; the last build step styles them then
+	if (!ui_build_is_active(&modal->build)) {
 
-	printf("[I] alerts_modal: Properly refactored alerts modal created\n");
-	return modal;
+		update_all_field_borders(modal);
+	}
 }
 
 void alerts_modal_show(alerts_modal_t* modal)
 {
 	if (!modal) {
-		printf("[W] alerts_modal: Cannot show NULL modal\n");
+		LOG_W(TAG, "Cannot show NULL modal");
 		return;
 	}
 
 	if (!modal->is_visible) {
-		printf("[I] alerts_modal: Showing properly refactored alerts modal\n");
+		LOG_I(TAG, "Showing properly refactored alerts modal");
+		lv_obj_scroll_to_y(modal->content_container, 0, LV_ANIM_OFF); // Rebinds the top rows
+		reload_field_values(modal);
+		lv_obj_move_foreground(modal->background);
 		lv_obj_remove_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
 		modal->is_visible = true;
 	}
@@ -2050,12 +2258,12 @@ void alerts_modal_show(alerts_modal_t* modal)
 void alerts_modal_hide(alerts_modal_t* modal)
 {
 	if (!modal) {
-		printf("[W] alerts_modal: Cannot hide NULL modal\n");
+		LOG_W(TAG, "Cannot hide NULL modal");
 		return;
 	}
 
 	if (modal->is_visible) {
-		printf("[I] alerts_modal: Hiding properly refactored alerts modal\n");
+		LOG_I(TAG, "Hiding properly refactored alerts modal");
 		close_current_field(modal);
 		lv_obj_add_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
 		modal->is_visible = false;
@@ -2066,7 +2274,7 @@ void alerts_modal_hide(alerts_modal_t* modal)
 static void alerts_modal_destroy_timer_cb(lv_timer_t* timer)
 {
 	alerts_modal_t* modal = (alerts_modal_t*)lv_timer_get_user_data(timer);
-	printf("[I] alerts_modal: (timer) Destroying alerts modal\n");
+	LOG_I(TAG, "(timer) Destroying alerts modal");
 
 	if (!modal) {
 		if (timer) lv_timer_del(timer);
@@ -2080,7 +2288,7 @@ static void alerts_modal_destroy_timer_cb(lv_timer_t* timer)
 
 	// Clear all warnings and destroy timers
 	for (int field_id = 0; field_id < modal->total_field_count; field_id++) {
-		warning_data_t* warning_data = get_warning_data(field_id);
+		warning_data_t* warning_data = get_warning_data(modal, field_id);
 		if (warning_data && warning_data->timer) {
 			lv_timer_del(warning_data->timer);
 			warning_data->timer = NULL;
@@ -2097,13 +2305,11 @@ static void alerts_modal_destroy_timer_cb(lv_timer_t* timer)
 	}
 
 	// Cleanup warning data array
-	cleanup_warning_data();
+	cleanup_warning_data(modal);
 
-	// Destroy numberpad subcomponent
-	if (modal->numberpad) {
-		numberpad_hide(modal->numberpad);
-		modal->numberpad = NULL;
-	}
+	// Release the shared numberpad
+	numberpad_unbind(modal->numberpad, modal);
+	modal->numberpad = NULL;
 
 	// Delete the LVGL tree synchronously (like timeline_modal)
 	if (modal->background && lv_obj_is_valid(modal->background)) {
@@ -2140,6 +2346,10 @@ static void alerts_modal_destroy_timer_cb(lv_timer_t* timer)
 		free(modal->field_ui);
 		modal->field_ui = NULL;
 	}
+	if (modal->rows) {
+		free(modal->rows);
+		modal->rows = NULL;
+	}
 	if (modal->field_data) {
 		free(modal->field_data);
 		modal->field_data = NULL;
@@ -2159,10 +2369,11 @@ void alerts_modal_destroy(alerts_modal_t* modal)
 {
 	if (!modal) return;
 
-	printf("[I] alerts_modal: Destroying alerts modal (deferred)\n");
+	LOG_I(TAG, "Destroying alerts modal (deferred)");
+	ui_build_cancel(&modal->build);
 
 	if (s_alerts_destroy_pending) {
-		printf("[W] alerts_modal: Destroy already pending, ignoring duplicate request\n");
+		LOG_W(TAG, "Destroy already pending, ignoring duplicate request");
 		return;
 	}
 	s_alerts_destroy_pending = true;
@@ -2187,15 +2398,15 @@ bool alerts_modal_is_visible(alerts_modal_t* modal)
 
 void alerts_modal_refresh_gauges_and_alerts(alerts_modal_t* modal)
 {
-	printf("[I] alerts_modal: Refreshing gauges and alerts after modal changes\n");
+	LOG_I(TAG, "Refreshing gauges and alerts after modal changes");
 
 	if (!modal || !modal->config.refresh_cb) {
-		printf("[W] alerts_modal: No refresh callback provided\n");
+		LOG_W(TAG, "No refresh callback provided");
 		return;
 	}
 
 	// Call the provided refresh callback
 	modal->config.refresh_cb();
 
-	printf("[I] alerts_modal: Gauge and alert refresh complete\n");
+	LOG_I(TAG, "Gauge and alert refresh complete");
 }
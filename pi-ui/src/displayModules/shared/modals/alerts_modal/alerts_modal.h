@@ -3,7 +3,9 @@
 
 #include <lvgl.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "../../numberpad/numberpad.h"
+#include "../../../../utils/ui_build.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,6 +67,19 @@ typedef struct {
 	lv_obj_t* title;            // The title label
 } field_ui_t;
 
+// One recycled gauge section of the scrolling list; bound to a gauge while it is
+// near the viewport (gauge = -1 when free)
+typedef struct {
+	lv_obj_t* section;
+	lv_obj_t* alert_group;
+	lv_obj_t* gauge_group;
+	lv_obj_t* gauge_title;
+	lv_obj_t* alert_title;
+	lv_obj_t* gauge_group_title;
+	field_ui_t fields[5];
+	int gauge;
+} alerts_modal_row_t;
+
 // Field data structure - complete state management for each field
 typedef struct {
 	// Value data
@@ -109,6 +124,13 @@ typedef struct {
 	lv_obj_t* close_button;         // Close button
 	lv_obj_t* cancel_button;        // Cancel button
 
+	// Virtualized list: only row_count sections exist and are recycled while scrolling.
+	// The per-gauge pointers below and field_ui are set while a gauge is bound to a
+	// row and NULL otherwise.
+	alerts_modal_row_t* rows;
+	int row_count;
+	uint32_t rows_rebound;          // Rows recycled to another gauge by scrolling
+
 	// Dynamic gauge sections (allocated based on config)
 	lv_obj_t** gauge_sections;      // Gauge section containers
 	lv_obj_t** alert_groups;        // Alert group containers
@@ -125,6 +147,9 @@ typedef struct {
 	// Field data - 1D array for data and state management (allocated based on config)
 	field_data_t* field_data;
 
+	// Out-of-range warnings shown on fields (total_field_count entries)
+	struct alerts_modal_warning* warnings;
+
 	// Configuration
 	alerts_modal_config_t config;   // Modal configuration
 	int total_field_count;          // Total number of fields (gauge_count * 5)
@@ -134,6 +159,8 @@ typedef struct {
 	// Shared numberpad component
 	numberpad_t* numberpad;
 
+	ui_build_job_t build;           // Gauge sections and fields, built after the skeleton
+
 	void (*on_close)(void);         // Close callback
 	bool is_visible;                // Visibility state
 	bool numberpad_visible;         // Numberpad visibility state
@@ -10,11 +10,20 @@
 
 // UI Style
 #include "../../palette.h"
+#include "../../../../fonts/app_fonts.h"
 #include "../../../../fonts/lv_font_noplato_10.h"
 #include "../../../../fonts/lv_font_noplato_14.h"
 #include "../../../../fonts/lv_font_noplato_18.h"
 #include "../../../../fonts/lv_font_noplato_24.h"
 #include "../../utils/animation/animation.h"
+#include "../../../../utils/log.h"
+
+static const char *TAG = "timeline_modal";
+
+// Glyphs drawn in the app fonts: the H/M/S duration values
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_24, APP_FONT_GLYPHS_TIME },
+};
 
 
 // #### Default State Colors ####
@@ -124,6 +133,8 @@ static void time_input_enter(int hours, int minutes, int seconds, void* user_dat
 static void time_input_cancel(void* user_data);
 static void load_current_gauge_timeline_settings(timeline_modal_t* modal);
 static void animate_numbers(timeline_modal_t* modal, int gauge, bool is_current_view, float target_duration);
+static void bind_time_input(timeline_modal_t* modal);
+static ui_build_status_t timeline_modal_build_step(void* ctx, int step);
 
 // Create gauge section - simplified structure like alerts modal
 static void create_gauge_section(timeline_modal_t* modal, int gauge, lv_obj_t* parent)
@@ -663,11 +674,11 @@ static void update_gauge_value(timeline_modal_t* modal, int gauge, float value,
 static void update_gauge_ui(timeline_modal_t* modal)
 {
 	if (!modal) {
-		printf("[D] timeline_modal: update_gauge_ui called with NULL modal\n");
+		LOG_D(TAG, "update_gauge_ui called with NULL modal");
 		return;
 	}
 
-	printf("[D] timeline_modal: update_gauge_ui called (selected_gauge=%d, gauge_count=%d)\n", modal->selected_gauge, modal->config.gauge_count);
+	LOG_D(TAG, "update_gauge_ui called (selected_gauge=%d, gauge_count=%d)", modal->selected_gauge, modal->config.gauge_count);
 
 	bool has_selected_gauge = modal->selected_gauge >= 0 && modal->selected_gauge < modal->config.gauge_count;
 
@@ -984,30 +995,30 @@ static void update_gauge_ui(timeline_modal_t* modal)
 static int find_gauge_by_section(timeline_modal_t* modal, lv_obj_t* target)
 {
 	if (!modal || !target) {
-		printf("[D] timeline_modal: find_gauge_by_section early return - modal: %p, target: %p\n", modal, target);
+		LOG_D(TAG, "find_gauge_by_section early return - modal: %p, target: %p", modal, target);
 		return -1;
 	}
 
-	printf("[D] timeline_modal: find_gauge_by_section checking %d gauges\n", modal->config.gauge_count);
+	LOG_D(TAG, "find_gauge_by_section checking %d gauges", modal->config.gauge_count);
 
 	// Direct object comparison - flat data structure, no loops needed
 	for (int i = 0; i < modal->config.gauge_count; i++) {
 		// Check if target is the gauge container (stored reference)
 		if (modal->gauge_ui[i].gauge_container == target) {
-			printf("[D] timeline_modal: Found matching gauge %d (gauge container)\n", i);
+			LOG_D(TAG, "Found matching gauge %d (gauge container)", i);
 			return i;
 		}
 
 		// Check if target is the gauge section itself
 		if (modal->gauge_sections[i] == target) {
-			printf("[D] timeline_modal: Found matching gauge %d (gauge section)\n", i);
+			LOG_D(TAG, "Found matching gauge %d (gauge section)", i);
 			return i;
 		}
 
 		// Check if target is a group container
 		if (modal->gauge_ui[i].current_view_group == target ||
 			modal->gauge_ui[i].detail_view_group == target) {
-			printf("[D] timeline_modal: Found matching gauge %d (group container)\n", i);
+			LOG_D(TAG, "Found matching gauge %d (group container)", i);
 			return i;
 		}
 
@@ -1024,7 +1035,7 @@ static int find_gauge_by_section(timeline_modal_t* modal, lv_obj_t* target)
 			modal->gauge_ui[i].detail_view_minutes_letter == target ||
 			modal->gauge_ui[i].detail_view_seconds_label == target ||
 			modal->gauge_ui[i].detail_view_seconds_letter == target) {
-			printf("[D] timeline_modal: Found matching gauge %d (value label)\n", i);
+			LOG_D(TAG, "Found matching gauge %d (value label)", i);
 			return i;
 		}
 
@@ -1032,12 +1043,12 @@ static int find_gauge_by_section(timeline_modal_t* modal, lv_obj_t* target)
 		if (modal->gauge_titles[i] == target ||
 			modal->gauge_ui[i].current_view_title == target ||
 			modal->gauge_ui[i].detail_view_title == target) {
-			printf("[D] timeline_modal: Found matching gauge %d (title)\n", i);
+			LOG_D(TAG, "Found matching gauge %d (title)", i);
 			return i;
 		}
 	}
 
-	printf("[D] timeline_modal: No matching gauge found\n");
+	LOG_D(TAG, "No matching gauge found");
 	return -1;
 }
 
@@ -1055,13 +1066,15 @@ static void timeline_click_handler(lv_event_t* e)
 	lv_obj_t* target = lv_event_get_target( e );
 	timeline_modal_t* modal = (timeline_modal_t*)lv_event_get_user_data( e );
 
-	printf("[D] timeline_modal: timeline_click_handler called, target: %p, modal: %p\n", target, modal);
+	LOG_D(TAG, "timeline_click_handler called, target: %p, modal: %p", target, modal);
 
 	if( !modal || !target ){
 
-		printf("[D] timeline_modal: Early return - modal: %p, target: %p\n", modal, target);
+		LOG_D(TAG, "Early return - modal: %p, target: %p", modal, target);
 		return;
 	}
+	ui_build_complete(&modal->build);
+	bind_time_input(modal);
 
 	// Check if a gauge section was clicked
 	int gauge_index = find_gauge_by_section( modal, target );
@@ -1084,7 +1097,7 @@ static void timeline_click_handler(lv_event_t* e)
 		bool is_current_group = (target == modal->gauge_ui[gauge_index].current_view_group);
 		bool is_detail_group = (target == modal->gauge_ui[gauge_index].detail_view_group);
 
-		printf("[D] timeline_modal: View detection - current_view: %d, detail_view: %d, current_group: %d, detail_group: %d\n",
+		LOG_D(TAG, "View detection - current_view: %d, detail_view: %d, current_group: %d, detail_group: %d",
 			is_current_view, is_detail_view, is_current_group, is_detail_group);
 
 		if (is_current_view || is_current_group) {
@@ -1097,7 +1110,7 @@ static void timeline_click_handler(lv_event_t* e)
 				modal->gauge_ui[gauge_index].current_view_being_edited = false;
 				modal->selected_gauge = -1;
 				update_gauge_ui(modal);
-				printf("[I] timeline_modal: Current view deactivated\n");
+				LOG_I(TAG, "Current view deactivated");
 			} else {
 				// Current view clicked - activate it
 				// Clear being_edited for previously selected gauge
@@ -1121,7 +1134,7 @@ static void timeline_click_handler(lv_event_t* e)
 				time_input_set_values(modal->time_input, hours, minutes, seconds);
 					time_input_show_outside_container(modal->time_input, modal->gauge_sections[gauge_index], modal->gauge_ui[gauge_index].gauge_container);
 
-					printf("[I] timeline_modal: Gauge %d current view activated, duration: %.2f\n", gauge_index, duration);
+					LOG_I(TAG, "Gauge %d current view activated, duration: %.2f", gauge_index, duration);
 				}
 			}
 		} else if (is_detail_view || is_detail_group) {
@@ -1134,7 +1147,7 @@ static void timeline_click_handler(lv_event_t* e)
 				modal->gauge_ui[gauge_index].detail_view_being_edited = false;
 				modal->selected_gauge = -1;
 				update_gauge_ui(modal);
-				printf("[I] timeline_modal: Detail view deactivated\n");
+				LOG_I(TAG, "Detail view deactivated");
 			} else {
 				// Detail view clicked - activate it
 				// Clear being_edited for previously selected gauge
@@ -1158,7 +1171,7 @@ static void timeline_click_handler(lv_event_t* e)
 					time_input_set_values(modal->time_input, hours, minutes, seconds);
 					time_input_show_outside_container(modal->time_input, modal->gauge_sections[gauge_index], modal->gauge_ui[gauge_index].gauge_container);
 
-					printf("[I] timeline_modal: Gauge %d detail view activated, duration: %.2f\n", gauge_index, duration);
+					LOG_I(TAG, "Gauge %d detail view activated, duration: %.2f", gauge_index, duration);
 				}
 			}
 		} else {
@@ -1170,7 +1183,7 @@ static void timeline_click_handler(lv_event_t* e)
 				}
 				modal->selected_gauge = -1;
 				update_gauge_ui(modal);
-				printf("[I] timeline_modal: Same gauge clicked, hiding time input (toggle off)\n");
+				LOG_I(TAG, "Same gauge clicked, hiding time input (toggle off)");
 			} else {
 				// Different gauge - select it and show time input (default to current view)
 				modal->selected_gauge = gauge_index;
@@ -1188,7 +1201,7 @@ static void timeline_click_handler(lv_event_t* e)
 					time_input_set_values(modal->time_input, hours, minutes, seconds);
 					time_input_show_outside_container(modal->time_input, modal->gauge_sections[gauge_index], modal->gauge_ui[gauge_index].gauge_container);
 
-					printf("[I] timeline_modal: Gauge %d selected, duration: %.2f\n", gauge_index, duration);
+					LOG_I(TAG, "Gauge %d selected, duration: %.2f", gauge_index, duration);
 				}
 			}
 		}
@@ -1229,9 +1242,9 @@ static void timeline_click_handler(lv_event_t* e)
 		}
 		modal->selected_gauge = -1;
 			update_gauge_ui(modal);
-			printf("[I] timeline_modal: Clicked outside gauge container, closed active view\n");
+			LOG_I(TAG, "Clicked outside gauge container, closed active view");
 		} else if (is_gauge_container) {
-			printf("[I] timeline_modal: Clicked on gauge container but gauge not found - this shouldn't happen\n");
+			LOG_I(TAG, "Clicked on gauge container but gauge not found - this shouldn't happen");
 		}
 	}
 }
@@ -1242,7 +1255,8 @@ static void close_button_clicked(lv_event_t* e)
 {
 	timeline_modal_t* modal = (timeline_modal_t*)lv_event_get_user_data(e);
 	if (modal) {
-		printf("[I] timeline_modal: Close button clicked\n");
+		LOG_I(TAG, "Close button clicked");
+		ui_build_complete(&modal->build);
 		timeline_modal_hide(modal);
 	}
 }
@@ -1252,29 +1266,76 @@ static void cancel_button_clicked(lv_event_t* e)
 {
 	timeline_modal_t* modal = (timeline_modal_t*)lv_event_get_user_data(e);
 	if (modal) {
-		printf("[I] timeline_modal: Cancel button clicked\n");
+		LOG_I(TAG, "Cancel button clicked");
+		ui_build_complete(&modal->build);
 		timeline_modal_hide(modal);
 	}
 }
 
+// Claims the shared time input for this modal (built by the first caller)
+static void bind_time_input(timeline_modal_t* modal)
+{
+	time_input_config_t time_config = TIME_INPUT_DEFAULT_CONFIG;
+	modal->time_input = time_input_get_shared( &time_config );
+
+	// Set up callbacks
+	time_input_set_callbacks(
+		modal->time_input,
+		time_input_value_changed,
+		time_input_enter,
+		time_input_cancel,
+		modal
+	);
+}
+
+// Incremental construction: timeline_modal_create() builds the skeleton (background,
+// containers, CANCEL and DONE); each gauge section is then one step, the time input
+// another, and the last step loads the saved durations into the built labels.
+static ui_build_status_t timeline_modal_build_step(void* ctx, int step)
+{
+	timeline_modal_t* modal = (timeline_modal_t*)ctx;
+
+	if (step < modal->config.gauge_count) {
+
+		create_gauge_section(modal, step, modal->gauges_container);
+		return UI_BUILD_CONTINUE;
+	}
+
+	if (step == modal->config.gauge_count) {
+
+		// Shared time input: built here if this is its first user
+		bind_time_input(modal);
+		return UI_BUILD_CONTINUE;
+	}
+
+	// Initialize gauge borders
+	update_gauge_ui(modal);
+
+	// Load current gauge timeline settings from device state
+	load_current_gauge_timeline_settings(modal);
+	return UI_BUILD_DONE;
+}
+
 // Create timeline modal
 timeline_modal_t* timeline_modal_create(const timeline_modal_config_t* config, void (*on_close_callback)(void))
 {
-	printf("[I] timeline_modal: Creating timeline modal\n");
+	LOG_I(TAG, "Creating timeline modal");
 
 	if (!config) {
-		printf("[E] timeline_modal: Configuration is required\n");
+		LOG_E(TAG, "Configuration is required");
 		return NULL;
 	}
 
 	if (config->gauge_count <= 0 || !config->gauges) {
-		printf("[E] timeline_modal: Invalid gauge configuration\n");
+		LOG_E(TAG, "Invalid gauge configuration");
 		return NULL;
 	}
 
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
+
 	timeline_modal_t* modal = malloc(sizeof(timeline_modal_t));
 	if (!modal) {
-		printf("[E] timeline_modal: Failed to allocate memory for timeline modal\n");
+		LOG_E(TAG, "Failed to allocate memory for timeline modal");
 		return NULL;
 	}
 
@@ -1290,7 +1351,7 @@ timeline_modal_t* timeline_modal_create(const timeline_modal_config_t* config, v
 	modal->gauge_ui = calloc(config->gauge_count, sizeof(timeline_ui_t));
 
 	if (!modal->gauge_sections || !modal->gauge_titles || !modal->gauge_ui) {
-		printf("[E] timeline_modal: Failed to allocate memory for UI arrays\n");
+		LOG_E(TAG, "Failed to allocate memory for UI arrays");
 		free(modal);
 		return NULL;
 	}
@@ -1350,42 +1411,21 @@ timeline_modal_t* timeline_modal_create(const timeline_modal_config_t* config, v
 	lv_obj_set_flex_align(modal->content_container, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
 
 	// Gauges Container
-	lv_obj_t* gauges_container = lv_obj_create(modal->content_container);
-	lv_obj_set_size(gauges_container, LV_PCT(100), LV_PCT(91));
-	lv_obj_set_layout(gauges_container, LV_LAYOUT_FLEX);
-	lv_obj_set_flex_flow(gauges_container, LV_FLEX_FLOW_COLUMN);
-	lv_obj_set_flex_align(gauges_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
-	lv_obj_set_style_bg_color(gauges_container, PALETTE_BLACK, 0);
-	lv_obj_set_style_bg_opa(gauges_container, LV_OPA_COVER, 0);
-	lv_obj_set_style_border_width(gauges_container, 0, 0);
-	lv_obj_set_style_pad_all(gauges_container, 5, 0);
-	lv_obj_clear_flag(gauges_container, LV_OBJ_FLAG_SCROLLABLE);
-
-	// Gauge Sections
-	for (int i = 0; i < config->gauge_count; i++) {
-
-		create_gauge_section( modal, i, gauges_container );
-	}
+	modal->gauges_container = lv_obj_create(modal->content_container);
+	lv_obj_set_size(modal->gauges_container, LV_PCT(100), LV_PCT(91));
+	lv_obj_set_layout(modal->gauges_container, LV_LAYOUT_FLEX);
+	lv_obj_set_flex_flow(modal->gauges_container, LV_FLEX_FLOW_COLUMN);
+	lv_obj_set_flex_align(modal->gauges_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
+	lv_obj_set_style_bg_color(modal->gauges_container, PALETTE_BLACK, 0);
+	lv_obj_set_style_bg_opa(modal->gauges_container, LV_OPA_COVER, 0);
+	lv_obj_set_style_border_width(modal->gauges_container, 0, 0);
+	lv_obj_set_style_pad_all(modal->gauges_container, 5, 0);
+	lv_obj_clear_flag(modal->gauges_container, LV_OBJ_FLAG_SCROLLABLE);
 
 	// Initialize selected gauge
 	modal->selected_gauge = -1; // No gauge selected initially
 	modal->selected_is_current_view = true; // Default to current view
 
-	// Create shared time input component
-	time_input_config_t time_config = TIME_INPUT_DEFAULT_CONFIG;
-	modal->time_input = time_input_create( &time_config, modal->background );
-
-	if( modal->time_input ){
-		// Set up callbacks
-		time_input_set_callbacks(
-			modal->time_input,
-			time_input_value_changed,
-			time_input_enter,
-			time_input_cancel,
-			modal
-		);
-	}
-
 	// Button Container
 	lv_obj_t* button_container = lv_obj_create(modal->content_container);
 	lv_obj_set_size(button_container, LV_PCT(100), LV_PCT(9));
@@ -1440,13 +1480,10 @@ timeline_modal_t* timeline_modal_create(const timeline_modal_config_t* config, v
 	// Add single click handler to the modal background for all clicks
 	lv_obj_add_event_cb(modal->background, timeline_click_handler, LV_EVENT_CLICKED, modal);
 
-	// Initialize gauge borders
-	update_gauge_ui(modal);
-
-	// Load current gauge timeline settings from device state
-	load_current_gauge_timeline_settings(modal);
+	// Gauge sections and the time input follow, a few per frame (timeline_modal_build_step)
+	ui_build_start(&modal->build, "timeline_modal_build", timeline_modal_build_step, modal, NULL);
 
-	printf("[I] timeline_modal: Timeline modal created successfully\n");
+	LOG_I(TAG, "Timeline modal created successfully");
 	return modal;
 }
 
@@ -1455,14 +1492,23 @@ void timeline_modal_show(timeline_modal_t* modal)
 {
 	if (!modal) return;
 
-	printf("[I] timeline_modal: Showing timeline modal\n");
+	LOG_I(TAG, "Showing timeline modal");
 
-	// Update all gauge displays to show current duration
-	for (int i = 0; i < modal->config.gauge_count; i++) {
-		update_timeline_display(modal, i, true);  // Current view
-		update_timeline_display(modal, i, false); // Detail view
+	// A pooled modal is shown again and again: reload the durations and clear the
+	// selection (the last build step does it for a modal still being built)
+	if (!ui_build_is_active(&modal->build)) {
+
+		modal->selected_gauge = -1;
+		modal->selected_is_current_view = true;
+		for (int i = 0; i < modal->config.gauge_count; i++) {
+			modal->gauge_ui[i].current_view_has_changed = false;
+			modal->gauge_ui[i].detail_view_has_changed = false;
+		}
+		load_current_gauge_timeline_settings(modal);
+		update_gauge_ui(modal);
 	}
 
+	lv_obj_move_foreground(modal->background);
 	lv_obj_clear_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
 	modal->is_visible = true;
 }
@@ -1473,10 +1519,13 @@ void timeline_modal_hide(timeline_modal_t* modal)
 {
 	if (!modal) return;
 
-	printf("[I] timeline_modal: Hiding timeline modal\n");
+	LOG_I(TAG, "Hiding timeline modal");
 
 	// Individual changes are already saved via callback, no need to save all
 
+	if (modal->time_input && modal->time_input->user_data == modal) {
+		time_input_hide(modal->time_input);
+	}
 	lv_obj_add_flag(modal->background, LV_OBJ_FLAG_HIDDEN);
 	modal->is_visible = false;
 }
@@ -1508,7 +1557,7 @@ static void load_current_gauge_timeline_settings(timeline_modal_t* modal)
 {
 	if (!modal) return;
 
-	printf("[I] timeline_modal: Loading current gauge timeline settings\n");
+	LOG_I(TAG, "Loading current gauge timeline settings");
 
 	// Load current timeline duration for each gauge
 	for (int i = 0; i < modal->config.gauge_count; i++) {
@@ -1522,7 +1571,7 @@ static void load_current_gauge_timeline_settings(timeline_modal_t* modal)
 			case 4: gauge_type = POWER_MONITOR_DATA_SOLAR_VOLTAGE; break;
 			case 5: gauge_type = POWER_MONITOR_DATA_SOLAR_CURRENT; break;
 			default:
-				printf("[E] timeline_modal: Invalid gauge index %d\n", i);
+				LOG_E(TAG, "Invalid gauge index %d", i);
 				continue;
 		}
 
@@ -1557,7 +1606,7 @@ static void load_current_gauge_timeline_settings(timeline_modal_t* modal)
 		modal->gauge_ui[i].current_view_being_edited = false;
 		modal->gauge_ui[i].detail_view_being_edited = false;
 
-		printf("[I] timeline_modal: Gauge %d (%d) current duration: %d seconds, detail duration: %d seconds\n",
+		LOG_I(TAG, "Gauge %d (%d) current duration: %d seconds, detail duration: %d seconds",
 			   i, gauge_type, current_duration, detail_duration);
 
 		// Update the UI display for this gauge
@@ -1574,7 +1623,7 @@ static void timeline_modal_destroy_timer_cb(lv_timer_t* timer)
 {
 	// Retrieve modal pointer passed as user data
 	timeline_modal_t* modal = (timeline_modal_t*)lv_timer_get_user_data(timer);
-	printf("[I] timeline_modal: (timer) Destroying timeline modal\n");
+	LOG_I(TAG, "(timer) Destroying timeline modal");
 
 	if (!modal) {
 		if (timer) lv_timer_del(timer);
@@ -1586,11 +1635,10 @@ static void timeline_modal_destroy_timer_cb(lv_timer_t* timer)
 	// Ensure hidden to stop interactions
 	timeline_modal_hide(modal);
 
-	// Destroy subcomponents that own their own LVGL objects before deleting the tree
-	if (modal->time_input) {
-		time_input_destroy(modal->time_input);
-		modal->time_input = NULL;
-	}
+	// Release the shared time input; destroy subcomponents that own their own LVGL
+	// objects before deleting the tree
+	time_input_unbind(modal->time_input, modal);
+	modal->time_input = NULL;
 	if (modal->animation_manager) {
 		animation_manager_destroy(modal->animation_manager);
 		modal->animation_manager = NULL;
@@ -1630,10 +1678,11 @@ void timeline_modal_destroy(timeline_modal_t* modal)
 {
 	if (!modal) return;
 
-	printf("[I] timeline_modal: Destroying timeline modal (deferred)\n");
+	LOG_I(TAG, "Destroying timeline modal (deferred)");
+	ui_build_cancel(&modal->build);
 
 	if (s_timeline_destroy_pending) {
-		printf("[W] timeline_modal: Destroy already pending, ignoring duplicate request\n");
+		LOG_W(TAG, "Destroy already pending, ignoring duplicate request");
 		return;
 	}
 	s_timeline_destroy_pending = true;
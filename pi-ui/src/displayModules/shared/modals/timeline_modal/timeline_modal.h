@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include "../../time_input/time_input.h"
 #include "../../utils/animation/animation.h"
+#include "../../../../utils/ui_build.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -89,6 +90,7 @@ typedef struct {
 	lv_obj_t* content_container;    // Main content container
 	lv_obj_t* close_button;         // Close button
 	lv_obj_t* cancel_button;        // Cancel button
+	lv_obj_t* gauges_container;     // Parent of the gauge sections
 
 	// Dynamic gauge sections (allocated based on config)
 	lv_obj_t** gauge_sections;      // Gauge section containers
@@ -109,6 +111,8 @@ typedef struct {
 	// Animation
 	animation_manager_t* animation_manager; // Animation manager for smooth value transitions
 
+	ui_build_job_t build;           // Gauge sections and time input, built after the skeleton
+
 	void (*on_close)(void);         // Close callback
 	bool is_visible;                // Visibility state
 } timeline_modal_t;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include "module_interface.h"
+#include "../../utils/log.h"
 
 
 static const char *TAG = "module_interface";
@@ -17,19 +18,19 @@ static const display_module_t* registered_modules[] = {
 
 void display_modules_init_all(void)
 {
-		printf("[I] module_interface: Initializing %d display modules\n", NUM_MODULES);
+		LOG_I(TAG, "Initializing %d display modules", (int)NUM_MODULES);
 
 	for (size_t i = 0; i < NUM_MODULES; i++) {
 		const display_module_t* module = registered_modules[i];
 		if (module && module->init) {
-			printf("[I] module_interface: Initializing module: %s\n", module->name);
+			LOG_I(TAG, "Initializing module: %s", module->name);
 			module->init();
 		} else {
-			printf("[W] module_interface: Module %zu has no init function\n", i);
+			LOG_W(TAG, "Module %zu has no init function", i);
 		}
 	}
 
-	printf("[I] module_interface: All display modules initialized\n");
+	LOG_I(TAG, "All display modules initialized");
 }
 
 void display_modules_update_all(void)
@@ -44,17 +45,28 @@ void display_modules_update_all(void)
 	}
 }
 
+void display_modules_prebuild_all(void)
+{
+	for (size_t i = 0; i < NUM_MODULES; i++) {
+		const display_module_t* module = registered_modules[i];
+		if (module && module->prebuild) {
+			LOG_I(TAG, "Prebuilding module: %s", module->name);
+			module->prebuild();
+		}
+	}
+}
+
 void display_modules_cleanup_all(void)
 {
-		printf("[I] module_interface: Cleaning up %d display modules\n", NUM_MODULES);
+		LOG_I(TAG, "Cleaning up %d display modules", NUM_MODULES);
 
 	for (size_t i = 0; i < NUM_MODULES; i++) {
 		const display_module_t* module = registered_modules[i];
 		if (module && module->cleanup) {
-			printf("[I] module_interface: Cleaning up module: %s\n", module->name);
+			LOG_I(TAG, "Cleaning up module: %s", module->name);
 			module->cleanup();
 		}
 	}
 
-	printf("[I] module_interface: All display modules cleaned up\n");
+	LOG_I(TAG, "All display modules cleaned up");
 }
@@ -30,6 +30,14 @@ typedef void (*module_init_func_t)(void);
  */
 typedef void (*module_update_func_t)(void);
 
+/**
+ * @brief Prebuild a display module's reusable UI
+ *
+ * Optional. Called once after boot, when the first screen is up, to build
+ * UI the module keeps and reuses (e.g. modals) before the user asks for it.
+ */
+typedef void (*module_prebuild_func_t)(void);
+
 /**
  * @brief Cleanup a display module
  *
@@ -45,6 +53,7 @@ typedef struct {
 	const char *name;                    // Module name for identification
 	module_init_func_t init;            // Initialization function
 	module_update_func_t update;        // Update function (called every tick)
+	module_prebuild_func_t prebuild;    // Optional, after boot
 	module_cleanup_func_t cleanup;      // Cleanup function
 } display_module_t;
 
@@ -58,6 +67,11 @@ void display_modules_init_all(void);
  */
 void display_modules_update_all(void);
 
+/**
+ * @brief Prebuild the reusable UI of all registered display modules
+ */
+void display_modules_prebuild_all(void);
+
 /**
  * @brief Cleanup all registered display modules
  */
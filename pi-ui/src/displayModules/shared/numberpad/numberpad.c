@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include "../utils/positioning/positioning.h"
 #include "../utils/number_formatting/number_formatting.h"
+#include "../../../utils/log.h"
 
 static const char* TAG = "numberpad";
 
@@ -184,7 +185,7 @@ numberpad_t* numberpad_create(const numberpad_config_t* config, lv_obj_t* parent
 	lv_obj_add_flag(numpad->background, LV_OBJ_FLAG_HIDDEN);
 	numpad->is_visible = false;
 
-		printf("[I] numberpad: Numberpad created with size %dx%d\n", numpad_width, numpad_height);
+		LOG_I(TAG, "Numberpad created with size %dx%d", numpad_width, numpad_height);
 	return numpad;
 }
 
@@ -205,6 +206,22 @@ void numberpad_destroy(numberpad_t* numpad) {
 	free(numpad);
 }
 
+numberpad_t* numberpad_get_shared(const numberpad_config_t* config) {
+	static numberpad_t* shared = NULL;
+
+	if (!shared) {
+		shared = numberpad_create(config, lv_layer_top());
+	}
+	return shared;
+}
+
+void numberpad_unbind(numberpad_t* numpad, void* user_data) {
+	if (!numpad || numpad->user_data != user_data) return;
+
+	numberpad_hide(numpad);
+	numberpad_set_callbacks(numpad, NULL, NULL, NULL, NULL, NULL);
+}
+
 void numberpad_show(numberpad_t* numpad, lv_obj_t* target_field) {
 	if (!numpad || !target_field) return;
 
@@ -215,7 +232,7 @@ void numberpad_show(numberpad_t* numpad, lv_obj_t* target_field) {
 	numpad->is_first_digit = true; // First digit input will clear current value
 	numpad->is_negative = false; // Initialize negative flag
 
-	printf("[I] numberpad: Numberpad shown for target field\n");
+	LOG_I(TAG, "Numberpad shown for target field");
 }
 
 void numberpad_show_outside_container(numberpad_t* numpad, lv_obj_t* target_field, lv_obj_t* container) {
@@ -228,7 +245,7 @@ void numberpad_show_outside_container(numberpad_t* numpad, lv_obj_t* target_fiel
 	numpad->is_first_digit = true; // First digit input will clear current value
 	numpad->is_negative = false; // Initialize negative flag
 
-	printf("[I] numberpad: Numberpad shown outside container, aligned to field\n");
+	LOG_I(TAG, "Numberpad shown outside container, aligned to field");
 }
 
 void numberpad_show_with_first_digit_flag(numberpad_t* numpad, lv_obj_t* target_field, bool is_first_digit) {
@@ -241,7 +258,7 @@ void numberpad_show_with_first_digit_flag(numberpad_t* numpad, lv_obj_t* target_
 	numpad->is_first_digit = is_first_digit; // Use provided flag
 	numpad->is_negative = false; // Initialize negative flag
 
-		printf("[I] numberpad: Numberpad shown for target field (first_digit=%s)\n", is_first_digit ? "true" : "false");
+		LOG_I(TAG, "Numberpad shown for target field (first_digit=%s)", is_first_digit ? "true" : "false");
 }
 
 void numberpad_hide(numberpad_t* numpad) {
@@ -286,7 +303,7 @@ void numberpad_hide(numberpad_t* numpad) {
 		}
 	}
 
-	printf("[I] numberpad: Numberpad hidden and button colors reset\n");
+	LOG_I(TAG, "Numberpad hidden and button colors reset");
 }
 
 void numberpad_set_callbacks(numberpad_t* numpad,
@@ -366,7 +383,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 		best_y + pad_height <= screen_height - screen_margin) {
 		found_position = true;
 		numpad->position = NUMBERPAD_POSITION_BELOW;
-		printf("[I] numberpad: Positioned numberpad below field\n");
+		LOG_I(TAG, "Positioned numberpad below field");
 	}
 
 	// Strategy 2: Position above field
@@ -380,7 +397,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 			best_y + pad_height <= screen_height - screen_margin) {
 			found_position = true;
 			numpad->position = NUMBERPAD_POSITION_ABOVE;
-			printf("[I] numberpad: Positioned numberpad above field\n");
+			LOG_I(TAG, "Positioned numberpad above field");
 		}
 	}
 
@@ -395,7 +412,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 			best_y + pad_height <= screen_height - screen_margin) {
 			found_position = true;
 			numpad->position = NUMBERPAD_POSITION_RIGHT;
-			printf("[I] numberpad: Positioned numberpad to the right of field\n");
+			LOG_I(TAG, "Positioned numberpad to the right of field");
 		}
 	}
 
@@ -410,7 +427,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 			best_y + pad_height <= screen_height - screen_margin) {
 			found_position = true;
 			numpad->position = NUMBERPAD_POSITION_LEFT;
-			printf("[I] numberpad: Positioned numberpad to the left of field\n");
+			LOG_I(TAG, "Positioned numberpad to the left of field");
 		}
 	}
 
@@ -426,7 +443,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 
 		found_position = true;
 		numpad->position = NUMBERPAD_POSITION_BELOW;
-		printf("[I] numberpad: Positioned numberpad below field (adjusted for screen)\n");
+		LOG_I(TAG, "Positioned numberpad below field (adjusted for screen)");
 	}
 
 	// Strategy 6: Try to position above field, but adjust if it goes off screen
@@ -441,7 +458,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 
 		found_position = true;
 		numpad->position = NUMBERPAD_POSITION_ABOVE;
-		printf("[I] numberpad: Positioned numberpad above field (adjusted for screen)\n");
+		LOG_I(TAG, "Positioned numberpad above field (adjusted for screen)");
 	}
 
 	// Strategy 7: Try to position right of field, but adjust if it goes off screen
@@ -456,7 +473,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 
 		found_position = true;
 		numpad->position = NUMBERPAD_POSITION_RIGHT;
-		printf("[I] numberpad: Positioned numberpad right of field (adjusted for screen)\n");
+		LOG_I(TAG, "Positioned numberpad right of field (adjusted for screen)");
 	}
 
 	// Strategy 8: Try to position left of field, but adjust if it goes off screen
@@ -471,7 +488,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 
 		found_position = true;
 		numpad->position = NUMBERPAD_POSITION_LEFT;
-		printf("[I] numberpad: Positioned numberpad left of field (adjusted for screen)\n");
+		LOG_I(TAG, "Positioned numberpad left of field (adjusted for screen)");
 	}
 
 	// Strategy 9: Center positioning as last resort
@@ -479,7 +496,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 		best_x = (screen_width - pad_width) / 2;
 		best_y = (screen_height - pad_height) / 2;
 		numpad->position = NUMBERPAD_POSITION_OTHER;
-		printf("[I] numberpad: Positioned numberpad at center (fallback)\n");
+		LOG_I(TAG, "Positioned numberpad at center (fallback)");
 	}
 
 	// Ensure final position is within screen bounds
@@ -491,7 +508,7 @@ static void set_numberpad_smart(numberpad_t* numpad, lv_obj_t* target_field) {
 	// Apply the position
 	lv_obj_set_pos(numpad->background, best_x, best_y);
 
-		printf("[I] numberpad: Numberpad positioned at (%d, %d) for field at (%d, %d)\n",
+		LOG_I(TAG, "Numberpad positioned at (%d, %d) for field at (%d, %d)",
 			 best_x, best_y, field_coords.x1, field_coords.y1);
 }
 
@@ -539,12 +556,12 @@ static void numberpad_button_cb(lv_event_t* e) {
 static void add_digit(numberpad_t* numpad, char digit) {
 	if (!numpad) return;
 
-	printf("[I] numberpad: add_digit: digit='%c', is_first_digit=%s, current='%s'\n",
+	LOG_I(TAG, "add_digit: digit='%c', is_first_digit=%s, current='%s'",
 			 digit, numpad->is_first_digit ? "true" : "false", numpad->value_buffer);
 
 	// If this is the first digit input, clear current value and start fresh
 	if (numpad->is_first_digit) {
-		printf("[I] numberpad: First digit: clearing current value and starting fresh\n");
+		LOG_I(TAG, "First digit: clearing current value and starting fresh");
 		// Clear current value and start fresh
 		numpad->value_buffer[0] = '\0';
 		numpad->current_length = 0;
@@ -602,7 +619,7 @@ static void add_digit(numberpad_t* numpad, char digit) {
 		numberpad_format_display_value(numeric_value, numpad->display_buffer, numpad->buffer_size);
 
 		numpad->digit_count = 4; // Now at 4 digits
-		printf("[I] numberpad: Fourth digit - numeric: '%s', display: '%s'\n", numpad->value_buffer, numpad->display_buffer);
+		LOG_I(TAG, "Fourth digit - numeric: '%s', display: '%s'", numpad->value_buffer, numpad->display_buffer);
 
 		// Update the target field display
 		update_target_field(numpad);
@@ -619,7 +636,7 @@ static void add_digit(numberpad_t* numpad, char digit) {
 		// Store the actual numeric value in the buffer with bounds checking
 		int written = snprintf(numpad->value_buffer, numpad->buffer_size, "%.1f", numeric_value);
 		if (written >= numpad->buffer_size) {
-			printf("[E] numberpad: Buffer overflow in value_buffer! Written: %d, Buffer size: %d\n", written, numpad->buffer_size);
+			LOG_E(TAG, "Buffer overflow in value_buffer! Written: %d, Buffer size: %d", written, numpad->buffer_size);
 			numpad->value_buffer[numpad->buffer_size - 1] = '\0';
 		}
 		numpad->current_length = strlen(numpad->value_buffer);
@@ -628,15 +645,15 @@ static void add_digit(numberpad_t* numpad, char digit) {
 		numberpad_format_display_value(numeric_value, numpad->display_buffer, numpad->buffer_size);
 
 		numpad->digit_count = 5; // Complete (5 digits with k notation)
-		printf("[I] numberpad: Complete 5-digit number - numeric: '%s', display: '%s'\n", numpad->value_buffer, numpad->display_buffer);
+		LOG_I(TAG, "Complete 5-digit number - numeric: '%s', display: '%s'", numpad->value_buffer, numpad->display_buffer);
 
 		// Update the target field display
-		printf("[D] numberpad: About to call update_target_field for 5th digit\n");
+		LOG_D(TAG, "About to call update_target_field for 5th digit");
 		update_target_field(numpad);
-		printf("[D] numberpad: update_target_field completed for 5th digit\n");
+		LOG_D(TAG, "update_target_field completed for 5th digit");
 	} else if (numpad->digit_count >= 5) {
 		// Already at maximum (5 digits), clear and start fresh with new digit
-		printf("[I] numberpad: Maximum digits reached, clearing and starting fresh with '%c'\n", digit);
+		LOG_I(TAG, "Maximum digits reached, clearing and starting fresh with '%c'", digit);
 
 		// Clear current value and start fresh
 		numpad->value_buffer[0] = '\0';
@@ -656,7 +673,7 @@ static void add_digit(numberpad_t* numpad, char digit) {
 		numpad->digit_count = 1;
 	}
 
-		printf("[I] numberpad: Result: '%s'\n", numpad->value_buffer);
+		LOG_I(TAG, "Result: '%s'", numpad->value_buffer);
 
 	// Update display buffer for regular formatting (not 5-digit k notation)
 	if (numpad->digit_count < 5) {
@@ -666,15 +683,15 @@ static void add_digit(numberpad_t* numpad, char digit) {
 
 	if (numpad->on_value_changed) {
 		// Safety check: ensure callback is still valid
-		printf("[D] numberpad: Calling on_value_changed callback\n");
+		LOG_D(TAG, "Calling on_value_changed callback");
 		numpad->on_value_changed(numpad->value_buffer, numpad->user_data);
-		printf("[D] numberpad: on_value_changed callback completed\n");
+		LOG_D(TAG, "on_value_changed callback completed");
 	}
 
 	// Update target field display AFTER callback to ensure formatted display is shown
-	printf("[D] numberpad: Updating target field display\n");
+	LOG_D(TAG, "Updating target field display");
 	update_target_field(numpad);
-	printf("[D] numberpad: Target field display updated\n");
+	LOG_D(TAG, "Target field display updated");
 }
 
 static void clear_value(numberpad_t* numpad) {
@@ -708,7 +725,7 @@ static void update_target_field(numberpad_t* numpad) {
 
 	// Safety check: ensure target field is still valid
 	if (!lv_obj_is_valid(numpad->target_field)) {
-		printf("[W] numberpad: Target field is no longer valid, skipping update\n");
+		LOG_W(TAG, "Target field is no longer valid, skipping update");
 		return;
 	}
 
@@ -724,7 +741,7 @@ static void update_target_field(numberpad_t* numpad) {
 			lv_label_set_text(label, display_text);
 		}
 	} else {
-		printf("[W] numberpad: Label is invalid or not found, skipping update\n");
+		LOG_W(TAG, "Label is invalid or not found, skipping update");
 	}
 }
 
@@ -795,7 +812,7 @@ static void set_value_for_fresh_input(numberpad_t* numpad, const char* value) {
 
 	if (has_k_notation) {
 		// This is a k notation value like "1.5k" - keep as is
-		printf("[I] numberpad: Setting k notation value: '%s'\n", numpad->value_buffer);
+		LOG_I(TAG, "Setting k notation value: '%s'", numpad->value_buffer);
 	} else if (has_decimal && ends_with_zero && numpad->digit_count >= 3) {
 		// This is a whole number like "150.0" - convert to "150"
 		char temp_buffer[16];
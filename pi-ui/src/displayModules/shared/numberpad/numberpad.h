@@ -61,6 +61,13 @@ numberpad_t* numberpad_create(const numberpad_config_t* config, lv_obj_t* parent
 // Destroy numberpad
 void numberpad_destroy(numberpad_t* numpad);
 
+// The app's one numberpad, on the top layer above every modal. Built by the first
+// call with that call's config; users set their callbacks each time they show it
+numberpad_t* numberpad_get_shared(const numberpad_config_t* config);
+
+// Hide and clear the callbacks if they still belong to user_data (owner going away)
+void numberpad_unbind(numberpad_t* numpad, void* user_data);
+
 // Show numberpad positioned relative to target field
 void numberpad_show(numberpad_t* numpad, lv_obj_t* target_field);
 
@@ -2,9 +2,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "../../../fonts/app_fonts.h"
 #include "../../../fonts/lv_font_noplato_24.h"
 #include "../utils/positioning/positioning.h"
 #include "../palette.h"
+#include "../../../utils/log.h"
+
+static const char *TAG = "time_input";
+
+// Glyphs drawn in the app fonts: the roller options
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_24, APP_FONT_GLYPHS_TIME },
+};
 
 // Forward declarations
 static void roller_changed_cb(lv_event_t* e);
@@ -17,16 +26,18 @@ static void set_time_input_smart_outside_container(time_input_t* time_input, lv_
 // Create time input component
 time_input_t* time_input_create(const time_input_config_t* config, lv_obj_t* parent)
 {
-	printf("[I] time_input: Creating time input component\n");
+	LOG_I(TAG, "Creating time input component");
 
 	if (!config) {
-		printf("[E] time_input: Configuration is required\n");
+		LOG_E(TAG, "Configuration is required");
 		return NULL;
 	}
 
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
+
 	time_input_t* time_input = malloc(sizeof(time_input_t));
 	if (!time_input) {
-		printf("[E] time_input: Failed to allocate memory for time input\n");
+		LOG_E(TAG, "Failed to allocate memory for time input");
 		return NULL;
 	}
 
@@ -240,7 +251,7 @@ time_input_t* time_input_create(const time_input_config_t* config, lv_obj_t* par
 	lv_obj_add_flag(time_input->background, LV_OBJ_FLAG_HIDDEN);
 	time_input->is_visible = false;
 
-	printf("[I] time_input: Time input component created successfully\n");
+	LOG_I(TAG, "Time input component created successfully");
 	return time_input;
 }
 
@@ -249,7 +260,7 @@ void time_input_destroy(time_input_t* time_input)
 {
 	if (!time_input) return;
 
-	printf("[I] time_input: Destroying time input component\n");
+	LOG_I(TAG, "Destroying time input component");
 
 	// Hide first
 	time_input_hide(time_input);
@@ -268,6 +279,26 @@ void time_input_destroy(time_input_t* time_input)
 	free(time_input);
 }
 
+// Shared time input
+time_input_t* time_input_get_shared(const time_input_config_t* config)
+{
+	static time_input_t* shared = NULL;
+
+	if (!shared) {
+		shared = time_input_create(config, lv_layer_top());
+	}
+	return shared;
+}
+
+// Release the shared time input from an owner
+void time_input_unbind(time_input_t* time_input, void* user_data)
+{
+	if (!time_input || time_input->user_data != user_data) return;
+
+	time_input_hide(time_input);
+	time_input_set_callbacks(time_input, NULL, NULL, NULL, NULL);
+}
+
 // Show time input positioned relative to target field
 void time_input_show(time_input_t* time_input, lv_obj_t* target_field)
 {
@@ -280,7 +311,7 @@ void time_input_show(time_input_t* time_input, lv_obj_t* target_field)
 	// Check if current values match a preset and activate it
 	check_and_activate_preset(time_input);
 
-	printf("[I] time_input: Time input shown\n");
+	LOG_I(TAG, "Time input shown");
 }
 
 // Show time input aligned to field but positioned outside container
@@ -296,7 +327,7 @@ void time_input_show_outside_container(time_input_t* time_input, lv_obj_t* targe
 	// Check if current values match a preset and activate it
 	check_and_activate_preset(time_input);
 
-	printf("[I] time_input: Time input shown outside container\n");
+	LOG_I(TAG, "Time input shown outside container");
 }
 
 // Hide time input
@@ -308,7 +339,7 @@ void time_input_hide(time_input_t* time_input)
 	time_input->is_visible = false;
 	time_input->target_field = NULL;
 
-	printf("[I] time_input: Time input hidden\n");
+	LOG_I(TAG, "Time input hidden");
 }
 
 // Set callbacks
@@ -429,7 +460,7 @@ static void preset_button_cb(lv_event_t* e)
 		time_input->on_value_changed(hours, minutes, seconds, time_input->user_data);
 	}
 
-	printf("[I] time_input: Preset button clicked: %d:%02d:%02d\n", hours, minutes, seconds);
+	LOG_I(TAG, "Preset button clicked: %d:%02d:%02d", hours, minutes, seconds);
 }
 
 // Background click event handler - deactivates time input
@@ -441,7 +472,7 @@ static void background_click_cb(lv_event_t* e)
 	// Only hide if clicking on the background itself (not on child elements)
 	lv_obj_t* target = lv_event_get_target(e);
 	if (target == time_input->background) {
-		printf("[I] time_input: Background clicked, hiding time input\n");
+		LOG_I(TAG, "Background clicked, hiding time input");
 		time_input_hide(time_input);
 	}
 }
@@ -507,7 +538,7 @@ static void check_and_activate_preset(time_input_t* time_input)
 						lv_obj_set_style_text_color(label, PALETTE_BLACK, 0);
 					}
 
-					printf("[I] time_input: Preset %d activated for current values %d:%02d:%02d\n",
+					LOG_I(TAG, "Preset %d activated for current values %d:%02d:%02d",
 						   i, time_input->hours, time_input->minutes, time_input->seconds);
 					break; // Only one preset can be active at a time
 				}
@@ -67,6 +67,24 @@ time_input_t* time_input_create(const time_input_config_t* config, lv_obj_t* par
  */
 void time_input_destroy(time_input_t* time_input);
 
+/**
+ * @brief Get the app's one time input, on the top layer above every modal
+ *
+ * The first call builds it with its config. Users set their callbacks each time
+ * they show it.
+ *
+ * @param config Configuration used by the first call
+ * @return The shared time input, or NULL on failure
+ */
+time_input_t* time_input_get_shared(const time_input_config_t* config);
+
+/**
+ * @brief Hide and clear the callbacks if they still belong to user_data
+ * @param time_input Pointer to the time input
+ * @param user_data Owner going away
+ */
+void time_input_unbind(time_input_t* time_input, void* user_data);
+
 /**
  * @brief Show time input positioned relative to target field
  * @param time_input Pointer to the time input
@@ -1,19 +1,62 @@
 #include "number_formatting.h"
 #include "../warning_icon/warning_icon.h"
 #include "../../palette.h"
+#include "../../../../utils/log.h"
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
 
 static const char* TAG = "number_formatting";
 
+// These run every UI tick for every visible value. LVGL invalidates (and for alignment and
+// font, re-lays out) on every setter call even when nothing changes, so only touch what
+// differs: an unchanged label then costs no redraw, and a changed one only its own bounds.
+static void align_label(lv_obj_t* label, number_align_t alignment)
+{
+	lv_align_t align;
+	switch (alignment) {
+		case LABEL_ALIGN_LEFT:
+			align = LV_ALIGN_LEFT_MID;
+			break;
+		case LABEL_ALIGN_CENTER:
+			align = LV_ALIGN_CENTER;
+			break;
+		case LABEL_ALIGN_RIGHT:
+		default:
+			align = LV_ALIGN_RIGHT_MID;
+			break;
+	}
+
+	if (lv_obj_get_style_align(label, 0) != align ||
+		lv_obj_get_style_x(label, 0) != 0 ||
+		lv_obj_get_style_y(label, 0) != 0) {
+
+		lv_obj_align(label, align, 0, 0);
+	}
+}
+
+static void set_label_text(lv_obj_t* label, const char* text)
+{
+	const char* current = lv_label_get_text(label);
+	if (current && strcmp(current, text) == 0) return;
+
+	lv_label_set_text(label, text);
+}
+
+static void set_text_color(lv_obj_t* label, lv_color_t color)
+{
+	if (lv_color_eq(lv_obj_get_style_text_color(label, 0), color)) return;
+
+	lv_obj_set_style_text_color(label, color, 0);
+}
+
 void format_and_display_number(float value, const number_formatting_config_t* config)
 {
 	if (!config || !config->label) return;
 
 	// Safety check: ensure the label is still valid
 	if (!lv_obj_is_valid(config->label)) {
-		printf("[W] number_formatting: Label is not valid, skipping format\n");
+		LOG_W(TAG, "Label is not valid, skipping format");
 		return;
 	}
 
@@ -49,18 +92,7 @@ void format_and_display_number(float value, const number_formatting_config_t* co
 		lv_obj_update_layout(row_container);
 
 		// Apply alignment based on number alignment configuration
-		switch (config->number_alignment) {
-			case LABEL_ALIGN_LEFT:
-				lv_obj_align(value_label, LV_ALIGN_LEFT_MID, 0, 0);
-				break;
-			case LABEL_ALIGN_CENTER:
-				lv_obj_align(value_label, LV_ALIGN_CENTER, 0, 0);
-				break;
-			case LABEL_ALIGN_RIGHT:
-			default:
-				lv_obj_align(value_label, LV_ALIGN_RIGHT_MID, 0, 0);
-				break;
-		}
+		align_label(value_label, config->number_alignment);
 
 		// Update the parent reference
 		row_container = value_container;
@@ -70,18 +102,7 @@ void format_and_display_number(float value, const number_formatting_config_t* co
 		row_container = lv_obj_get_parent(value_label);
 
 		// Apply alignment based on number alignment configuration
-		switch (config->number_alignment) {
-			case LABEL_ALIGN_LEFT:
-				lv_obj_align(value_label, LV_ALIGN_LEFT_MID, 0, 0);
-				break;
-			case LABEL_ALIGN_CENTER:
-				lv_obj_align(value_label, LV_ALIGN_CENTER, 0, 0);
-				break;
-			case LABEL_ALIGN_RIGHT:
-			default:
-				lv_obj_align(value_label, LV_ALIGN_RIGHT_MID, 0, 0);
-				break;
-		}
+		align_label(value_label, config->number_alignment);
 	}
 
 	// Handle error state - show ONLY the warning icon
@@ -119,7 +140,9 @@ void format_and_display_number(float value, const number_formatting_config_t* co
 	}
 
 	// Make sure label is visible (in case it was hidden due to previous error)
-	lv_obj_clear_flag(value_label, LV_OBJ_FLAG_HIDDEN);
+	if (lv_obj_has_flag(value_label, LV_OBJ_FLAG_HIDDEN)) {
+		lv_obj_clear_flag(value_label, LV_OBJ_FLAG_HIDDEN);
+	}
 
 	// Hide any existing warning icon when showing numbers
 	lv_obj_t* value_container = lv_obj_get_parent(value_label);
@@ -144,35 +167,37 @@ void format_and_display_number(float value, const number_formatting_config_t* co
 	}
 
 	// Update main label text
-	lv_label_set_text(value_label, number_text);
+	set_label_text(value_label, number_text);
 
 	// No suffix handling needed since 'k' is included directly in the text
 
 	// Apply font if provided, otherwise use monospace font
-	if (config->font) {
-		lv_obj_set_style_text_font(value_label, config->font, 0);
-	} else {
-		// Use monospace font for consistent character width
-		lv_obj_set_style_text_font(value_label, &lv_font_montserrat_16, 0);
+	const lv_font_t* font = config->font ? config->font : &lv_font_montserrat_16;
+	if (lv_obj_get_style_text_font(value_label, 0) != font) {
+		lv_obj_set_style_text_font(value_label, font, 0);
 	}
 
 	// Set text alignment based on number alignment configuration
+	lv_text_align_t text_align;
 	switch (config->number_alignment) {
 		case LABEL_ALIGN_LEFT:
-			lv_obj_set_style_text_align(value_label, LV_TEXT_ALIGN_LEFT, 0);
+			text_align = LV_TEXT_ALIGN_LEFT;
 			break;
 		case LABEL_ALIGN_CENTER:
-			lv_obj_set_style_text_align(value_label, LV_TEXT_ALIGN_CENTER, 0);
+			text_align = LV_TEXT_ALIGN_CENTER;
 			break;
 		case LABEL_ALIGN_RIGHT:
 		default:
-			lv_obj_set_style_text_align(value_label, LV_TEXT_ALIGN_RIGHT, 0);
+			text_align = LV_TEXT_ALIGN_RIGHT;
 			break;
 	}
+	if (lv_obj_get_style_text_align(value_label, 0) != text_align) {
+		lv_obj_set_style_text_align(value_label, text_align, 0);
+	}
 
 	// Apply color (use warning color if warning is enabled)
 	lv_color_t text_color = config->show_warning ? config->warning_color : config->color;
-	lv_obj_set_style_text_color(value_label, text_color, 0);
+	set_text_color(value_label, text_color);
 }
 
 void create_warning_icon(lv_obj_t* parent, lv_obj_t* label, lv_coord_t icon_size, number_align_t alignment)
@@ -181,7 +206,7 @@ void create_warning_icon(lv_obj_t* parent, lv_obj_t* label, lv_coord_t icon_size
 
 	// Safety check: ensure objects are still valid
 	if (!lv_obj_is_valid(parent) || !lv_obj_is_valid(label)) {
-		printf("[W] number_formatting: Parent or label is not valid, skipping warning icon\n");
+		LOG_W(TAG, "Parent or label is not valid, skipping warning icon");
 		return;
 	}
 
@@ -210,7 +235,7 @@ void hide_warning_icon(lv_obj_t* parent)
 
 	// Safety check: ensure parent is still valid
 	if (!lv_obj_is_valid(parent)) {
-		printf("[W] number_formatting: Parent is not valid, skipping hide warning icon\n");
+		LOG_W(TAG, "Parent is not valid, skipping hide warning icon");
 		return;
 	}
 
@@ -251,13 +276,13 @@ bool apply_alert_flashing(lv_obj_t* label, float value, float threshold_low, flo
 	if (alert) {
 		// Only change color, no hiding/showing to prevent layout shifts
 		if (blink_on) {
-			lv_obj_set_style_text_color(label, PALETTE_YELLOW, 0);
+			set_text_color(label, PALETTE_YELLOW);
 		} else {
-			lv_obj_set_style_text_color(label, PALETTE_WHITE, 0);
+			set_text_color(label, PALETTE_WHITE);
 		}
 	} else {
 		// Normal state - always white
-		lv_obj_set_style_text_color(label, PALETTE_WHITE, 0);
+		set_text_color(label, PALETTE_WHITE);
 	}
 
 	return alert;
@@ -1,6 +1,9 @@
 #include "positioning.h"
 #include <stdio.h>
 #include <math.h>
+#include "../../../../utils/log.h"
+
+static const char *TAG = "positioning";
 
 void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field, lv_obj_t* container,
 									lv_coord_t min_gap, lv_coord_t screen_margin)
@@ -42,7 +45,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 	if (best_x + element_width <= screen_width - screen_margin &&
 		!(best_x < container_coords.x2 && best_x + element_width > container_coords.x1)) {
 		x_found = true;
-		printf("[I] positioning: Left-aligned X position works\n");
+		LOG_D(TAG, "Left-aligned X position works");
 	}
 
 	// If centered doesn't work, try to the right of container
@@ -50,7 +53,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		best_x = container_coords.x2 + min_gap;
 		if (best_x >= screen_margin && best_x + element_width <= screen_width - screen_margin) {
 			x_found = true;
-			printf("[I] positioning: Positioned X to the right of container\n");
+			LOG_D(TAG, "Positioned X to the right of container");
 		}
 	}
 
@@ -59,7 +62,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		best_x = container_coords.x1 - element_width - min_gap;
 		if (best_x >= screen_margin && best_x + element_width <= screen_width - screen_margin) {
 			x_found = true;
-			printf("[I] positioning: Positioned X to the left of container\n");
+			LOG_D(TAG, "Positioned X to the left of container");
 		}
 	}
 
@@ -68,7 +71,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		best_x = field_center_x - element_width / 2;
 		if (best_x < screen_margin) best_x = screen_margin;
 		if (best_x + element_width > screen_width - screen_margin) best_x = screen_width - element_width - screen_margin;
-		printf("[I] positioning: Forced X to screen boundaries\n");
+		LOG_D(TAG, "Forced X to screen boundaries");
 	}
 
 	// Step 2: Determine optimal Y position (top-bottom) that fits on screen and avoids container collision
@@ -80,7 +83,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 	if (best_y >= screen_margin && best_y + element_height <= screen_height - screen_margin &&
 		!(best_y < container_coords.y2 && best_y + element_height > container_coords.y1)) {
 		found_position = true;
-		printf("[I] positioning: Positioned below container\n");
+		LOG_D(TAG, "Positioned below container");
 	}
 
 	// Strategy 2: Try above container
@@ -89,7 +92,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		if (best_y >= screen_margin && best_y + element_height <= screen_height - screen_margin &&
 			!(best_y < container_coords.y2 && best_y + element_height > container_coords.y1)) {
 			found_position = true;
-			printf("[I] positioning: Positioned above container\n");
+			LOG_D(TAG, "Positioned above container");
 		}
 	}
 
@@ -98,7 +101,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		best_y = field_center_y - element_height / 2;
 		if (best_y >= screen_margin && best_y + element_height <= screen_height - screen_margin) {
 			found_position = true;
-			printf("[I] positioning: Positioned to the right of container\n");
+			LOG_D(TAG, "Positioned to the right of container");
 		}
 	}
 
@@ -107,7 +110,7 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 		best_y = field_center_y - element_height / 2;
 		if (best_y >= screen_margin && best_y + element_height <= screen_height - screen_margin) {
 			found_position = true;
-			printf("[I] positioning: Positioned to the left of container\n");
+			LOG_D(TAG, "Positioned to the left of container");
 		}
 	}
 
@@ -118,13 +121,13 @@ void smart_position_outside_container(lv_obj_t* element, lv_obj_t* target_field,
 			best_y = screen_height - element_height - screen_margin;
 		}
 		found_position = true;
-		printf("[I] positioning: Fallback - forced below container with screen adjustments\n");
+		LOG_D(TAG, "Fallback - forced below container with screen adjustments");
 	}
 
 	// Set the final position
 	lv_obj_set_pos(element, best_x, best_y);
 
-	printf("[I] positioning: Element positioned at (%d, %d) for field at (%d, %d), container at (%d, %d)\n",
+	LOG_D(TAG, "Element positioned at (%d, %d) for field at (%d, %d), container at (%d, %d)",
 		   best_x, best_y, field_coords.x1, field_coords.y1, container_coords.x1, container_coords.y1);
 }
 
@@ -1,5 +1,6 @@
 #include "warning_icon.h"
 #include "../../../shared/palette.h"
+#include "../../../../utils/mem_region.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -136,7 +137,7 @@ static void canvas_cleanup_cb(lv_event_t* e) {
 	lv_obj_t* canvas = lv_event_get_target(e);
 	uint8_t* buffer = (uint8_t*)lv_obj_get_user_data(canvas);
 	if (buffer) {
-		free(buffer);
+		mem_region_free(buffer);
 		lv_obj_set_user_data(canvas, NULL);
 	}
 }
@@ -200,8 +201,8 @@ lv_obj_t* warning_icon_create(lv_obj_t* parent, warning_icon_size_t size, lv_col
 	lv_obj_t* canvas = lv_canvas_create(parent);
 	lv_obj_set_size(canvas, icon_size, icon_size);
 
-	// Allocate buffer for THIS SPECIFIC icon (each icon needs its own buffer!)
-	uint8_t* buffer = (uint8_t*)malloc(icon_size * icon_size * 2);
+	// Allocate buffer for THIS SPECIFIC icon (each icon needs its own buffer!), next to the screen's objects
+	uint8_t* buffer = (uint8_t*)mem_region_alloc_current(icon_size * icon_size * 2);
 	if (!buffer) {
 		lv_obj_del(canvas);
 		return NULL;
@@ -1,6 +1,7 @@
 #include "single_value_bar_graph_view.h"
 #include "../../gauges/bar_graph_gauge/bar_graph_gauge.h"
 #include "../../palette.h"
+#include "../../../../fonts/app_fonts.h"
 #include "../../../../fonts/lv_font_noplato_14.h"
 #include "../../../../state/device_state.h"
 #include "../../../../app_data_store.h"
@@ -26,6 +27,12 @@ single_value_bar_graph_view_state_t* single_value_bar_graph_view_create(lv_obj_t
 	// Initialize state
 	memset(base_view, 0, sizeof(single_value_bar_graph_view_state_t));
 
+	// The value is all this view draws in the view's own font
+	const app_font_glyphs_t glyphs[] = {
+		{ config->number_config.font, APP_FONT_GLYPHS_NUMBER },
+	};
+	app_fonts_prefetch(glyphs, 1);
+
 	// Get container dimensions
 	lv_coord_t container_width = lv_obj_get_width(parent);
 	lv_coord_t container_height = lv_obj_get_height(parent);
@@ -0,0 +1,95 @@
+#include "app_fonts.h"
+#include "../utils/font_mmap.h"
+#include "../utils/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *TAG = "fonts";
+
+#if PI_UI_FONTS_MMAP
+
+#include "lv_font_noplato_10.h"
+#include "lv_font_noplato_14.h"
+#include "lv_font_noplato_18.h"
+#include "lv_font_noplato_20.h"
+#include "lv_font_noplato_24.h"
+#include "lv_font_noplato_32.h"
+#include "lv_font_zector_72.h"
+
+#ifndef PI_UI_FONT_DIR
+#define PI_UI_FONT_DIR "fonts/bin"
+#endif
+
+// Filled in by app_fonts_init(); the lv_font_*.c files aren't built in this mode
+lv_font_t lv_font_noplato_10;
+lv_font_t lv_font_noplato_14;
+lv_font_t lv_font_noplato_18;
+lv_font_t lv_font_noplato_20;
+lv_font_t lv_font_noplato_24;
+lv_font_t lv_font_noplato_32;
+lv_font_t lv_font_zector_72;
+
+typedef struct {
+	lv_font_t *font;
+	const char *file;
+} app_font_file_t;
+
+static const app_font_file_t font_files[] = {
+	{ &lv_font_noplato_10, "noplato_10.bin" },
+	{ &lv_font_noplato_14, "noplato_14.bin" },
+	{ &lv_font_noplato_18, "noplato_18.bin" },
+	{ &lv_font_noplato_20, "noplato_20.bin" },
+	{ &lv_font_noplato_24, "noplato_24.bin" },
+	{ &lv_font_noplato_32, "noplato_32.bin" },
+	{ &lv_font_zector_72, "zector_72.bin" },
+};
+
+bool app_fonts_init(void)
+{
+	const char *dir = getenv("PI_UI_FONT_DIR");
+	if (!dir || !*dir) dir = PI_UI_FONT_DIR;
+
+	int missing = 0;
+	for (size_t i = 0; i < sizeof(font_files) / sizeof(font_files[0]); i++) {
+
+		char path[512];
+		snprintf(path, sizeof(path), "%s/%s", dir, font_files[i].file);
+		if (!font_mmap_load(font_files[i].font, path)) missing++;
+	}
+	if (missing) {
+
+		LOG_E(TAG, "%d of %d fonts missing in %s: build them with fonts/build_bin_fonts.sh", missing,
+			(int)(sizeof(font_files) / sizeof(font_files[0])), dir);
+		return false;
+	}
+	return true;
+}
+
+bool app_fonts_mapped(void)
+{
+	return true;
+}
+
+#else
+
+bool app_fonts_init(void)
+{
+	return true;
+}
+
+bool app_fonts_mapped(void)
+{
+	return false;
+}
+
+#endif // PI_UI_FONTS_MMAP
+
+void app_fonts_prefetch(const app_font_glyphs_t *subsets, int count)
+{
+	uint32_t glyphs = 0;
+	for (int i = 0; i < count; i++) {
+		glyphs += font_mmap_prefetch(subsets[i].font, subsets[i].glyphs);
+	}
+	if (glyphs) LOG_D(TAG, "Prefetched %u glyphs", (unsigned)glyphs);
+}
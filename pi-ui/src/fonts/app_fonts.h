@@ -0,0 +1,37 @@
+#ifndef APP_FONTS_H
+#define APP_FONTS_H
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The app's own fonts (noplato, zector). Compiled in by default; built with
+// -DPI_UI_FONTS_MMAP=ON they are mapped from the binary fonts in PI_UI_FONT_DIR
+// (fonts/build_bin_fonts.sh) instead, and only the glyphs in use are ever read.
+
+// Before the first view is built; no LVGL calls, any thread. With mapped fonts, false
+// if a file is missing or unreadable: there is no stand-in of the right size, so the
+// app does not start without them.
+bool app_fonts_init(void);
+bool app_fonts_mapped(void);
+
+// The glyphs a view draws in one of these fonts. Views declare theirs and prefetch
+// them when they are built (nothing to do for compiled-in fonts).
+typedef struct {
+	const lv_font_t *font;
+	const char *glyphs;
+} app_font_glyphs_t;
+
+#define APP_FONT_GLYPHS_NUMBER "0123456789.-km"   // number_formatting output
+#define APP_FONT_GLYPHS_TIME "0123456789:"
+
+void app_fonts_prefetch(const app_font_glyphs_t *subsets, int count);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*APP_FONTS_H*/
@@ -8,7 +8,11 @@ extern "C" {
 #include "lvgl.h"
 
 /*Declare the font*/
+#if PI_UI_FONTS_MMAP
+extern lv_font_t lv_font_noplato_14;   /*Mapped from fonts/bin by app_fonts_init()*/
+#else
 extern const lv_font_t lv_font_noplato_14;
+#endif
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -0,0 +1,200 @@
+#include "lvgl_port_buffers.h"
+#include "utils/log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "lvgl_port_buffers";
+
+// Draw buffers are written by LVGL's SW renderer and read by SDL; keep them cache-line aligned
+#define BUFFER_ALIGN 64
+
+lvgl_port_buffer_config_t lvgl_port_buffer_config_default(void)
+{
+	lvgl_port_buffer_config_t config = {
+		.mode = LVGL_PORT_BUFFER_PARTIAL,
+		.partial_lines = LVGL_PORT_PARTIAL_LINES_DEFAULT,
+	};
+	return config;
+}
+
+bool lvgl_port_buffer_config_parse(const char *spec, lvgl_port_buffer_config_t *config)
+{
+	if (!spec || !config) return false;
+
+	lvgl_port_buffer_config_t parsed = lvgl_port_buffer_config_default();
+
+	if (strcmp(spec, "full") == 0) {
+
+		parsed.mode = LVGL_PORT_BUFFER_FULL;
+	} else if (strcmp(spec, "direct") == 0) {
+
+		parsed.mode = LVGL_PORT_BUFFER_DIRECT;
+	} else if (strcmp(spec, "texture") == 0) {
+
+		parsed.mode = LVGL_PORT_BUFFER_TEXTURE;
+	} else if (strncmp(spec, "partial", 7) == 0) {
+
+		parsed.mode = LVGL_PORT_BUFFER_PARTIAL;
+		if (spec[7] == ':') {
+
+			char *end = NULL;
+			long lines = strtol(spec + 8, &end, 10);
+			if (!end || *end != '\0' || lines < 1 || lines > 4096) return false;
+			parsed.partial_lines = (int)lines;
+		} else if (spec[7] != '\0') {
+
+			return false;
+		}
+	} else {
+
+		return false;
+	}
+
+	*config = parsed;
+	return true;
+}
+
+const char *lvgl_port_buffer_mode_name(lvgl_port_buffer_mode_t mode)
+{
+	switch (mode) {
+		case LVGL_PORT_BUFFER_FULL:
+			return "full";
+		case LVGL_PORT_BUFFER_DIRECT:
+			return "direct";
+		case LVGL_PORT_BUFFER_TEXTURE:
+			return "texture";
+		case LVGL_PORT_BUFFER_PARTIAL:
+		default:
+			return "partial";
+	}
+}
+
+static uint8_t *alloc_buffer(uint32_t size)
+{
+	void *buf = NULL;
+	if (posix_memalign(&buf, BUFFER_ALIGN, size) != 0) return NULL;
+	memset(buf, 0, size);
+	return buf;
+}
+
+bool lvgl_port_buffers_create(lv_display_t *disp, const lvgl_port_buffer_config_t *config, lvgl_port_buffers_t *buffers)
+{
+	if (!disp || !config || !buffers) return false;
+
+	memset(buffers, 0, sizeof(*buffers));
+	buffers->config = *config;
+
+	int32_t ver_res = lv_display_get_vertical_resolution(disp);
+	buffers->stride = lvgl_port_buffers_display_stride(disp);
+
+	uint32_t lines;
+	switch (config->mode) {
+		case LVGL_PORT_BUFFER_TEXTURE:
+			// Needs memory from the caller (lvgl_port_buffers_create_external)
+			LOG_E(TAG, "texture strategy needs caller-owned pixels");
+			return false;
+		case LVGL_PORT_BUFFER_FULL:
+			buffers->render_mode = LV_DISPLAY_RENDER_MODE_FULL;
+			lines = ver_res;
+			break;
+		case LVGL_PORT_BUFFER_DIRECT:
+			buffers->render_mode = LV_DISPLAY_RENDER_MODE_DIRECT;
+			lines = ver_res;
+			break;
+		case LVGL_PORT_BUFFER_PARTIAL:
+		default:
+			buffers->render_mode = LV_DISPLAY_RENDER_MODE_PARTIAL;
+			lines = config->partial_lines > 0 ? (uint32_t)config->partial_lines : LVGL_PORT_PARTIAL_LINES_DEFAULT;
+			if (lines > (uint32_t)ver_res) lines = ver_res;
+			buffers->config.partial_lines = lines;
+			break;
+	}
+
+	buffers->buf_size = buffers->stride * lines;
+	buffers->buf_1 = alloc_buffer(buffers->buf_size);
+	buffers->buf_2 = alloc_buffer(buffers->buf_size);
+	if (!buffers->buf_1 || !buffers->buf_2) {
+
+		LOG_E(TAG, "Failed to allocate 2 x %u byte draw buffers", buffers->buf_size);
+		lvgl_port_buffers_destroy(buffers);
+		return false;
+	}
+
+	lv_display_set_buffers(disp, buffers->buf_1, buffers->buf_2, buffers->buf_size, buffers->render_mode);
+
+	if (buffers->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+
+		LOG_I(TAG, "%s, %u lines, 2 x %.1f KB",
+			lvgl_port_buffer_mode_name(config->mode), lines, buffers->buf_size / 1024.0f);
+	} else {
+
+		LOG_I(TAG, "%s, 2 x %.1f KB",
+			lvgl_port_buffer_mode_name(config->mode), buffers->buf_size / 1024.0f);
+	}
+
+	return true;
+}
+
+bool lvgl_port_buffers_create_external(lv_display_t *disp, void *pixels, uint32_t stride, lvgl_port_buffers_t *buffers)
+{
+	if (!disp || !pixels || !buffers) return false;
+
+	memset(buffers, 0, sizeof(*buffers));
+	buffers->config.mode = LVGL_PORT_BUFFER_TEXTURE;
+	buffers->render_mode = LV_DISPLAY_RENDER_MODE_DIRECT;
+	buffers->stride = lvgl_port_buffers_display_stride(disp);
+	buffers->external = true;
+
+	if (stride != buffers->stride) {
+
+		LOG_W(TAG, "external pitch %u != LVGL stride %u", stride, buffers->stride);
+		return false;
+	}
+
+	// Single buffer: LVGL draws only dirty areas in place, the rest of the frame persists
+	buffers->buf_1 = pixels;
+	buffers->buf_size = buffers->stride * lv_display_get_vertical_resolution(disp);
+	lv_display_set_buffers(disp, buffers->buf_1, NULL, buffers->buf_size, buffers->render_mode);
+
+	LOG_I(TAG, "texture, direct into %.1f KB of external pixels (no draw buffers)",
+		buffers->buf_size / 1024.0f);
+	return true;
+}
+
+uint32_t lvgl_port_buffers_display_stride(lv_display_t *disp)
+{
+	return lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), lv_display_get_color_format(disp));
+}
+
+void lvgl_port_buffers_destroy(lvgl_port_buffers_t *buffers)
+{
+	if (!buffers) return;
+
+	if (!buffers->external) {
+
+		free(buffers->buf_1);
+		free(buffers->buf_2);
+	}
+	buffers->buf_1 = NULL;
+	buffers->buf_2 = NULL;
+	buffers->buf_size = 0;
+}
+
+const uint8_t *lvgl_port_buffers_area_pixels(
+	const lvgl_port_buffers_t *buffers, lv_display_t *disp,
+	const lv_area_t *area, const uint8_t *px_map, int *pitch)
+{
+	lv_color_format_t cf = lv_display_get_color_format(disp);
+
+	if (buffers->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+
+		// Stripe holds just this area, rows packed at the area width
+		*pitch = (int)lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+		return px_map;
+	}
+
+	// Full-size frame: px_map is the frame origin, the area sits at its screen position
+	*pitch = (int)buffers->stride;
+	return px_map + (size_t)area->y1 * buffers->stride + (size_t)area->x1 * lv_color_format_get_size(cf);
+}
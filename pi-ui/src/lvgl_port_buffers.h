@@ -0,0 +1,77 @@
+/*
+ * LVGL draw buffer strategies for the Pi display port
+ *
+ * Picks how LVGL renders into memory (full frames, direct into a full-size
+ * frame, or partial N-line stripes), allocates the matching buffers and tells
+ * the flush path where a flushed area's pixels live. Chosen once at startup.
+ */
+
+#ifndef LVGL_PORT_BUFFERS_H
+#define LVGL_PORT_BUFFERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+	LVGL_PORT_BUFFER_FULL = 0,   // Two full frames, whole screen rendered every refresh
+	LVGL_PORT_BUFFER_DIRECT,     // Two full frames, only dirty areas rendered in place
+	LVGL_PORT_BUFFER_PARTIAL,    // Two N-line stripes, dirty areas rendered stripe by stripe
+	LVGL_PORT_BUFFER_TEXTURE,    // Direct into memory the port already owns (SDL texture pixels), no copy on flush
+} lvgl_port_buffer_mode_t;
+
+// Default stripe height for partial mode (480 x 80 x 2 B = 75 KB per buffer)
+#define LVGL_PORT_PARTIAL_LINES_DEFAULT 80
+
+typedef struct {
+	lvgl_port_buffer_mode_t mode;
+	int partial_lines;           // Stripe height, PARTIAL only
+} lvgl_port_buffer_config_t;
+
+typedef struct {
+	lvgl_port_buffer_config_t config;
+	lv_display_render_mode_t render_mode;
+	uint8_t *buf_1;
+	uint8_t *buf_2;
+	uint32_t buf_size;           // Bytes per buffer
+	uint32_t stride;             // Bytes per full-width row
+	bool external;               // buf_1 is owned by the caller (TEXTURE), not freed here
+} lvgl_port_buffers_t;
+
+// Default strategy (partial, LVGL_PORT_PARTIAL_LINES_DEFAULT lines)
+lvgl_port_buffer_config_t lvgl_port_buffer_config_default(void);
+
+// Parse "full", "direct", "texture", "partial" or "partial:<lines>". Returns false on a bad spec.
+bool lvgl_port_buffer_config_parse(const char *spec, lvgl_port_buffer_config_t *config);
+
+// Human-readable mode name ("full", "direct", "partial", "texture")
+const char *lvgl_port_buffer_mode_name(lvgl_port_buffer_mode_t mode);
+
+// Allocate buffers for a display and hand them to LVGL. Returns false on allocation failure.
+bool lvgl_port_buffers_create(lv_display_t *disp, const lvgl_port_buffer_config_t *config, lvgl_port_buffers_t *buffers);
+void lvgl_port_buffers_destroy(lvgl_port_buffers_t *buffers);
+
+// Render straight into caller-owned full-frame memory (single buffer, direct mode). The memory
+// must stay valid and keep its contents between frames; `stride` must match LVGL's row stride.
+bool lvgl_port_buffers_create_external(lv_display_t *disp, void *pixels, uint32_t stride, lvgl_port_buffers_t *buffers);
+
+// Full-frame stride LVGL expects for this display, in bytes
+uint32_t lvgl_port_buffers_display_stride(lv_display_t *disp);
+
+// Where a flushed area's pixels are: returns its first pixel inside px_map and sets the row
+// pitch in bytes. Partial stripes are packed at the area width; full and direct frames keep
+// the full-screen stride.
+const uint8_t *lvgl_port_buffers_area_pixels(
+	const lvgl_port_buffers_t *buffers, lv_display_t *disp,
+	const lv_area_t *area, const uint8_t *px_map, int *pitch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_BUFFERS_H
@@ -0,0 +1,308 @@
+#define _GNU_SOURCE
+#include "lvgl_port_fbdev.h"
+#include "lvgl_port_rotate.h"
+#include "utils/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/fb.h>
+
+static const char *TAG = "lvgl_port_fbdev";
+
+static uint8_t *page_at(const lvgl_port_fbdev_t *fb, int page)
+{
+	return fb->map + (size_t)page * fb->page_size;
+}
+
+uint8_t *lvgl_port_fbdev_back_page(const lvgl_port_fbdev_t *fb)
+{
+	return page_at(fb, fb->pages > 1 ? 1 - fb->front : fb->front);
+}
+
+// Real framebuffer: take its geometry, ask for a double-height virtual screen to flip pages
+static bool open_device(lvgl_port_fbdev_t *fb, const char *path)
+{
+	fb->fd = open(path, O_RDWR | O_CLOEXEC);
+	if (fb->fd < 0) {
+
+		LOG_E(TAG, "Cannot open %s", path);
+		return false;
+	}
+	fb->is_device = true;
+
+	struct fb_var_screeninfo vinfo;
+	struct fb_fix_screeninfo finfo;
+	if (ioctl(fb->fd, FBIOGET_VSCREENINFO, &vinfo) != 0 || ioctl(fb->fd, FBIOGET_FSCREENINFO, &finfo) != 0) {
+
+		LOG_E(TAG, "%s is not a framebuffer", path);
+		return false;
+	}
+
+	if (vinfo.bits_per_pixel != 16) {
+
+		LOG_E(TAG, "%s is %u bpp, RGB565 (16 bpp) required", path, vinfo.bits_per_pixel);
+		return false;
+	}
+
+	if (vinfo.yres_virtual < vinfo.yres * 2) {
+
+		struct fb_var_screeninfo request = vinfo;
+		request.yres_virtual = vinfo.yres * 2;
+		request.yoffset = 0;
+		if (ioctl(fb->fd, FBIOPUT_VSCREENINFO, &request) == 0) {
+
+			ioctl(fb->fd, FBIOGET_VSCREENINFO, &vinfo);
+			ioctl(fb->fd, FBIOGET_FSCREENINFO, &finfo);
+		}
+	}
+
+	fb->width = vinfo.xres;
+	fb->height = vinfo.yres;
+	fb->line_length = finfo.line_length;
+	fb->page_size = fb->line_length * fb->height;
+	fb->pages = 1;
+
+	if (vinfo.yres_virtual >= vinfo.yres * 2 && finfo.smem_len >= fb->page_size * 2) {
+
+		// Confirm the driver pans before relying on it
+		vinfo.yoffset = 0;
+		if (ioctl(fb->fd, FBIOPAN_DISPLAY, &vinfo) == 0) {
+			fb->pages = 2;
+		}
+	}
+
+	uint32_t arg = 0;
+	fb->vsync = (ioctl(fb->fd, FBIO_WAITFORVSYNC, &arg) == 0);
+	return true;
+}
+
+// File or memfd stand-in: fixed geometry, two pages, no ioctls
+static bool open_file(lvgl_port_fbdev_t *fb, const char *target, uint32_t width, uint32_t height)
+{
+	if (strcmp(target, "memfd") == 0) {
+
+		fb->fd = memfd_create("pi_ui_fb", MFD_CLOEXEC);
+	} else {
+
+		fb->fd = open(target + strlen("file:"), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	}
+
+	if (fb->fd < 0) {
+
+		LOG_E(TAG, "Cannot create %s", target);
+		return false;
+	}
+
+	fb->is_device = false;
+	fb->width = width;
+	fb->height = height;
+	fb->line_length = width * 2;
+	fb->page_size = fb->line_length * height;
+	fb->pages = 2;
+	fb->vsync = false;
+
+	if (ftruncate(fb->fd, (off_t)fb->page_size * fb->pages) != 0) {
+
+		LOG_E(TAG, "Cannot size %s", target);
+		return false;
+	}
+	return true;
+}
+
+bool lvgl_port_fbdev_open(
+
+	lvgl_port_fbdev_t *fb,
+	const char *target,
+	uint32_t panel_width,
+	uint32_t panel_height,
+	uint32_t lvgl_width,
+	uint32_t lvgl_height
+){
+	if (!fb || !target) return false;
+
+	memset(fb, 0, sizeof(*fb));
+	fb->fd = -1;
+
+	bool opened = (strncmp(target, "file:", 5) == 0 || strcmp(target, "memfd") == 0)
+		? open_file(fb, target, panel_width, panel_height)
+		: open_device(fb, target);
+	if (!opened) {
+
+		lvgl_port_fbdev_close(fb);
+		return false;
+	}
+
+	// Portrait LVGL on a landscape panel (or the other way round) is rotated on the way in
+	fb->rotate = (lvgl_width < lvgl_height) != (fb->width < fb->height);
+	uint32_t need_w = fb->rotate ? lvgl_height : lvgl_width;
+	uint32_t need_h = fb->rotate ? lvgl_width : lvgl_height;
+	if (fb->width < need_w || fb->height < need_h) {
+
+		LOG_E(TAG, "%ux%u panel cannot show %ux%u UI", fb->width, fb->height, lvgl_width, lvgl_height);
+		lvgl_port_fbdev_close(fb);
+		return false;
+	}
+	fb->lvgl_height = lvgl_height;
+
+	fb->map_size = (size_t)fb->page_size * fb->pages;
+	fb->map = mmap(NULL, fb->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fb->fd, 0);
+	if (fb->map == MAP_FAILED) {
+
+		fb->map = NULL;
+		LOG_E(TAG, "mmap of %zu bytes failed", fb->map_size);
+		lvgl_port_fbdev_close(fb);
+		return false;
+	}
+
+	fb->front = 0;
+	LOG_I(TAG, "%s %ux%u, %u B/line, %d page%s%s%s", target,
+		fb->width, fb->height, fb->line_length, fb->pages, fb->pages > 1 ? "s (pan)" : "",
+		fb->rotate ? ", rotated" : "", fb->vsync ? ", vsync" : "");
+	return true;
+}
+
+void lvgl_port_fbdev_close(lvgl_port_fbdev_t *fb)
+{
+	if (!fb) return;
+
+	if (fb->map) {
+
+		// Leave the first page on screen
+		if (fb->is_device && fb->pages > 1 && fb->front != 0) {
+
+			memcpy(page_at(fb, 0), page_at(fb, fb->front), fb->page_size);
+			struct fb_var_screeninfo vinfo;
+			if (ioctl(fb->fd, FBIOGET_VSCREENINFO, &vinfo) == 0) {
+
+				vinfo.yoffset = 0;
+				ioctl(fb->fd, FBIOPAN_DISPLAY, &vinfo);
+			}
+		}
+		munmap(fb->map, fb->map_size);
+		fb->map = NULL;
+	}
+
+	if (fb->fd >= 0) {
+
+		close(fb->fd);
+		fb->fd = -1;
+	}
+}
+
+static void add_damage(lvgl_port_fbdev_t *fb, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	if (fb->damage_count < LVGL_PORT_FBDEV_DAMAGE_MAX) {
+
+		lv_area_t *d = &fb->damage[fb->damage_count++];
+		d->x1 = x1;
+		d->y1 = y1;
+		d->x2 = x2;
+		d->y2 = y2;
+	} else {
+
+		fb->damage_overflow = true;
+	}
+}
+
+void lvgl_port_fbdev_flush_area(lvgl_port_fbdev_t *fb, const lv_area_t *area, const uint8_t *pixels, int pitch)
+{
+	// Area math inline (no LVGL calls), so the benchmark can drive this file without LVGL
+	uint8_t *page = lvgl_port_fbdev_back_page(fb);
+	int32_t w = area->x2 - area->x1 + 1;
+	int32_t h = area->y2 - area->y1 + 1;
+
+	if (fb->rotate) {
+
+		// Portrait (x, y) -> panel (lvgl_height - 1 - y, x)
+		int32_t panel_x = (int32_t)fb->lvgl_height - 1 - area->y2;
+		int32_t panel_y = area->x1;
+		uint16_t *dst = (uint16_t *)(page + (size_t)panel_y * fb->line_length) + panel_x;
+
+		lvgl_port_rotate90_rgb565((const uint16_t *)pixels, pitch / 2, dst, fb->line_length / 2, w, h);
+		add_damage(fb, panel_x, panel_y, panel_x + h - 1, panel_y + w - 1);
+		return;
+	}
+
+	size_t row_bytes = (size_t)w * 2;
+	uint8_t *dst = page + (size_t)area->y1 * fb->line_length + (size_t)area->x1 * 2;
+	for (int32_t y = 0; y < h; y++) {
+
+		memcpy(dst, pixels, row_bytes);
+		dst += fb->line_length;
+		pixels += pitch;
+	}
+	add_damage(fb, area->x1, area->y1, area->x2, area->y2);
+}
+
+// Copy this frame's damage from one page to the other
+static void copy_damage(const lvgl_port_fbdev_t *fb, int from, int to)
+{
+	const uint8_t *src = page_at(fb, from);
+	uint8_t *dst = page_at(fb, to);
+
+	if (fb->damage_overflow) {
+
+		memcpy(dst, src, fb->page_size);
+		return;
+	}
+
+	for (int i = 0; i < fb->damage_count; i++) {
+
+		const lv_area_t *d = &fb->damage[i];
+		size_t offset = (size_t)d->y1 * fb->line_length + (size_t)d->x1 * 2;
+		size_t row_bytes = (size_t)(d->x2 - d->x1 + 1) * 2;
+		for (int32_t y = d->y1; y <= d->y2; y++) {
+
+			memcpy(dst + offset, src + offset, row_bytes);
+			offset += fb->line_length;
+		}
+	}
+}
+
+void lvgl_port_fbdev_present(lvgl_port_fbdev_t *fb)
+{
+	if (fb->pages > 1) {
+
+		int back = 1 - fb->front;
+		bool flipped = true;
+
+		if (fb->is_device) {
+
+			if (fb->vsync) {
+
+				uint32_t arg = 0;
+				ioctl(fb->fd, FBIO_WAITFORVSYNC, &arg);
+			}
+
+			struct fb_var_screeninfo vinfo;
+			flipped = ioctl(fb->fd, FBIOGET_VSCREENINFO, &vinfo) == 0;
+			if (flipped) {
+
+				vinfo.yoffset = (uint32_t)back * fb->height;
+				flipped = ioctl(fb->fd, FBIOPAN_DISPLAY, &vinfo) == 0;
+			}
+		}
+
+		if (flipped) {
+
+			// The new back page is a frame behind: bring over what this frame changed
+			fb->front = back;
+			copy_damage(fb, fb->front, 1 - fb->front);
+		} else {
+
+			// Panning stopped working: finish this frame on the visible page and stay there
+			LOG_W(TAG, "FBIOPAN_DISPLAY failed, single buffering");
+			fb->damage_overflow = true;
+			copy_damage(fb, back, fb->front);
+			fb->pages = 1;
+		}
+	}
+
+	fb->damage_count = 0;
+	fb->damage_overflow = false;
+}
@@ -0,0 +1,75 @@
+/*
+ * Memory-mapped framebuffer output for the Pi display port
+ *
+ * Maps /dev/fbN (or a plain file / memfd of the same geometry, for testing and
+ * benchmarks on any Linux box) and writes flushed LVGL areas straight into the
+ * mapping, rotating portrait areas onto a landscape panel on the CPU. Uses two
+ * pages and FBIOPAN_DISPLAY when the driver allows a double-height virtual
+ * screen; otherwise draws into the visible page.
+ */
+
+#ifndef LVGL_PORT_FBDEV_H
+#define LVGL_PORT_FBDEV_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Damage kept per frame (panel coordinates) to bring the other page up to date after a flip
+#define LVGL_PORT_FBDEV_DAMAGE_MAX 32
+
+typedef struct {
+	int fd;
+	bool is_device;              // Real fbdev (ioctls) vs file / memfd
+	uint8_t *map;
+	size_t map_size;
+
+	uint32_t width;              // Visible panel size in pixels
+	uint32_t height;
+	uint32_t line_length;        // Bytes per panel row
+	uint32_t page_size;          // Bytes per page (line_length * height)
+	int pages;                   // 2 = double buffered via panning
+	int front;                   // Page currently on screen
+	bool rotate;                 // Panel is landscape, LVGL portrait: rotate 90° clockwise
+	uint32_t lvgl_height;        // LVGL vertical resolution (rotation origin)
+	bool vsync;                  // FBIO_WAITFORVSYNC works on this device
+
+	lv_area_t damage[LVGL_PORT_FBDEV_DAMAGE_MAX];
+	int damage_count;
+	bool damage_overflow;
+} lvgl_port_fbdev_t;
+
+// Open a target: "/dev/fbN", "file:<path>" or "memfd". Files and memfds get two pages of
+// panel_width x panel_height RGB565 so the double-buffer path runs there too; devices use
+// their own geometry (must be RGB565). lvgl_width/height is the LVGL display resolution.
+bool lvgl_port_fbdev_open(
+
+	lvgl_port_fbdev_t *fb,
+	const char *target,
+	uint32_t panel_width,
+	uint32_t panel_height,
+	uint32_t lvgl_width,
+	uint32_t lvgl_height
+);
+
+void lvgl_port_fbdev_close(lvgl_port_fbdev_t *fb);
+
+// Write one flushed area (LVGL coordinates, RGB565 at `pitch` bytes per row) into the back page
+void lvgl_port_fbdev_flush_area(lvgl_port_fbdev_t *fb, const lv_area_t *area, const uint8_t *pixels, int pitch);
+
+// Frame complete: show the back page (pan) and copy this frame's damage into the new back page
+void lvgl_port_fbdev_present(lvgl_port_fbdev_t *fb);
+
+// Page currently being drawn (the visible one when single buffered)
+uint8_t *lvgl_port_fbdev_back_page(const lvgl_port_fbdev_t *fb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_FBDEV_H
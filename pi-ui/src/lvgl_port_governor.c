@@ -0,0 +1,181 @@
+#include "lvgl_port_governor.h"
+#include "utils/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static const char *TAG = "lvgl_port_governor";
+
+lvgl_port_governor_config_t lvgl_port_governor_config_default(void)
+{
+	lvgl_port_governor_config_t config = {
+		.active_period_ms = 8,
+		.idle_period_ms = 33,
+		.ignition_off_period_ms = 100,
+		.hot_period_ms = 50,
+		.idle_after_ms = 1500,
+		.touch_boost_ms = 5000,
+		.thermal_path = LVGL_PORT_GOVERNOR_THERMAL_DEFAULT,
+		.hot_millicelsius = 80000,
+		.cool_millicelsius = 75000,
+		.thermal_poll_ms = 2000,
+	};
+	return config;
+}
+
+bool lvgl_port_governor_config_parse_thermal(const char *spec, lvgl_port_governor_config_t *config)
+{
+	if (!spec || !config || spec[0] == '\0') return false;
+
+	if (strcmp(spec, "off") == 0) {
+
+		config->thermal_path[0] = '\0';
+		return true;
+	}
+
+	const char *comma = strchr(spec, ',');
+	size_t path_len = comma ? (size_t)(comma - spec) : strlen(spec);
+	if (path_len == 0 || path_len >= sizeof(config->thermal_path)) return false;
+
+	if (comma) {
+
+		char *end;
+		long hot_c = strtol(comma + 1, &end, 10);
+		if (end == comma + 1 || *end != '\0' || hot_c < 30 || hot_c > 120) return false;
+
+		config->hot_millicelsius = (int32_t)hot_c * 1000;
+		config->cool_millicelsius = config->hot_millicelsius - 5000;
+	}
+
+	memcpy(config->thermal_path, spec, path_len);
+	config->thermal_path[path_len] = '\0';
+	return true;
+}
+
+void lvgl_port_governor_init(lvgl_port_governor_t *gov, const lvgl_port_governor_config_t *config, uint32_t now_ms)
+{
+	memset(gov, 0, sizeof(*gov));
+	gov->config = config ? *config : lvgl_port_governor_config_default();
+	gov->thermal_fd = -1;
+	gov->ignition_on = true;
+	gov->last_change_ms = now_ms;
+	gov->last_touch_ms = now_ms;
+	gov->level = LVGL_PORT_GOVERNOR_ACTIVE;
+	gov->period_ms = gov->config.active_period_ms;
+
+	if (gov->config.thermal_path[0] != '\0') {
+
+		gov->thermal_fd = open(gov->config.thermal_path, O_RDONLY | O_CLOEXEC);
+		if (gov->thermal_fd < 0) {
+
+			LOG_W(TAG, "Cannot open %s, no thermal cap", gov->config.thermal_path);
+		}
+	}
+
+	// First thermal read on the first update
+	gov->last_thermal_poll_ms = now_ms - gov->config.thermal_poll_ms;
+}
+
+void lvgl_port_governor_deinit(lvgl_port_governor_t *gov)
+{
+	if (gov->thermal_fd >= 0) {
+
+		close(gov->thermal_fd);
+		gov->thermal_fd = -1;
+	}
+}
+
+void lvgl_port_governor_note_frame(lvgl_port_governor_t *gov, uint32_t now_ms, bool content_changed)
+{
+	if (content_changed) gov->last_change_ms = now_ms;
+}
+
+void lvgl_port_governor_note_touch(lvgl_port_governor_t *gov, uint32_t now_ms)
+{
+	gov->last_touch_ms = now_ms;
+	gov->last_change_ms = now_ms;
+}
+
+void lvgl_port_governor_set_ignition(lvgl_port_governor_t *gov, bool ignition_on)
+{
+	gov->ignition_on = ignition_on;
+}
+
+// sysfs temp files re-read from offset 0 on every pread
+static void poll_thermal(lvgl_port_governor_t *gov)
+{
+	char text[16];
+	ssize_t len = pread(gov->thermal_fd, text, sizeof(text) - 1, 0);
+	if (len <= 0) return;
+
+	text[len] = '\0';
+	gov->millicelsius = (int32_t)strtol(text, NULL, 10);
+
+	if (!gov->hot && gov->millicelsius >= gov->config.hot_millicelsius) {
+
+		gov->hot = true;
+		LOG_W(TAG, "%.1f °C, capping at %u ms per frame",
+			gov->millicelsius / 1000.0f, gov->config.hot_period_ms);
+	} else if (gov->hot && gov->millicelsius < gov->config.cool_millicelsius) {
+
+		gov->hot = false;
+		LOG_I(TAG, "%.1f °C, thermal cap lifted", gov->millicelsius / 1000.0f);
+	}
+}
+
+uint32_t lvgl_port_governor_update(lvgl_port_governor_t *gov, uint32_t now_ms, bool animating)
+{
+	if (gov->thermal_fd >= 0 && now_ms - gov->last_thermal_poll_ms >= gov->config.thermal_poll_ms) {
+
+		gov->last_thermal_poll_ms = now_ms;
+		poll_thermal(gov);
+	}
+
+	if (animating) gov->last_change_ms = now_ms;
+
+	lvgl_port_governor_level_t level;
+	uint32_t period;
+	if (now_ms - gov->last_touch_ms < gov->config.touch_boost_ms) {
+
+		level = LVGL_PORT_GOVERNOR_ACTIVE;
+		period = gov->config.active_period_ms;
+	} else if (!gov->ignition_on) {
+
+		level = LVGL_PORT_GOVERNOR_IGNITION_OFF;
+		period = gov->config.ignition_off_period_ms;
+	} else if (now_ms - gov->last_change_ms >= gov->config.idle_after_ms) {
+
+		level = LVGL_PORT_GOVERNOR_IDLE;
+		period = gov->config.idle_period_ms;
+	} else {
+
+		level = LVGL_PORT_GOVERNOR_ACTIVE;
+		period = gov->config.active_period_ms;
+	}
+
+	if (gov->hot && period < gov->config.hot_period_ms) {
+		period = gov->config.hot_period_ms;
+	}
+
+	if (level != gov->level) {
+
+		LOG_I(TAG, "%s (%u ms)", lvgl_port_governor_level_name(level), period);
+		gov->level = level;
+	}
+
+	gov->period_ms = period;
+	return period;
+}
+
+const char *lvgl_port_governor_level_name(lvgl_port_governor_level_t level)
+{
+	switch (level) {
+		case LVGL_PORT_GOVERNOR_ACTIVE:       return "active";
+		case LVGL_PORT_GOVERNOR_IDLE:         return "idle";
+		case LVGL_PORT_GOVERNOR_IGNITION_OFF: return "ignition off";
+	}
+	return "?";
+}
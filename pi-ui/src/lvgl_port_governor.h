@@ -0,0 +1,81 @@
+/*
+ * Adaptive frame governor for the Pi display port
+ *
+ * Picks the period LVGL's refresh, input and UI timers run at: full rate while
+ * something changes on screen or the user is touching it, slower once the
+ * screen has been static for a while, slower still with the ignition off, and
+ * never faster than a thermal cap while a sysfs thermal zone reads hot. A touch
+ * switches back to full rate immediately. Pure policy: the port feeds it frames,
+ * touches and ignition state and applies the period it returns.
+ */
+
+#ifndef LVGL_PORT_GOVERNOR_H
+#define LVGL_PORT_GOVERNOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LVGL_PORT_GOVERNOR_THERMAL_DEFAULT "/sys/class/thermal/thermal_zone0/temp"
+
+typedef enum {
+	LVGL_PORT_GOVERNOR_ACTIVE = 0,      // Content changing or recent touch
+	LVGL_PORT_GOVERNOR_IDLE,            // Nothing changed for idle_after_ms
+	LVGL_PORT_GOVERNOR_IGNITION_OFF,    // Vehicle off, nobody touching
+} lvgl_port_governor_level_t;
+
+typedef struct {
+	uint32_t active_period_ms;          // Timer period at full rate (LV_DEF_REFR_PERIOD)
+	uint32_t idle_period_ms;
+	uint32_t ignition_off_period_ms;
+	uint32_t hot_period_ms;             // Lower bound on the period while hot
+	uint32_t idle_after_ms;             // Static screen this long -> idle
+	uint32_t touch_boost_ms;            // Full rate this long after the last touch
+	char thermal_path[128];             // "" = no thermal input
+	int32_t hot_millicelsius;           // Cap above this...
+	int32_t cool_millicelsius;          // ...until back below this
+	uint32_t thermal_poll_ms;
+} lvgl_port_governor_config_t;
+
+typedef struct {
+	lvgl_port_governor_config_t config;
+	int thermal_fd;
+	uint32_t last_thermal_poll_ms;
+	int32_t millicelsius;
+	bool hot;
+	bool ignition_on;
+	uint32_t last_change_ms;
+	uint32_t last_touch_ms;
+	lvgl_port_governor_level_t level;
+	uint32_t period_ms;
+} lvgl_port_governor_t;
+
+// 120 / 30 / 10 fps, 20 fps cap above 80 °C (75 °C to recover), thermal_zone0
+lvgl_port_governor_config_t lvgl_port_governor_config_default(void);
+
+// "off", "<path>" or "<path>,<hot °C>"
+bool lvgl_port_governor_config_parse_thermal(const char *spec, lvgl_port_governor_config_t *config);
+
+void lvgl_port_governor_init(lvgl_port_governor_t *gov, const lvgl_port_governor_config_t *config, uint32_t now_ms);
+void lvgl_port_governor_deinit(lvgl_port_governor_t *gov);
+
+// A frame was rendered; content_changed is false when only the FPS overlay redrew
+void lvgl_port_governor_note_frame(lvgl_port_governor_t *gov, uint32_t now_ms, bool content_changed);
+
+void lvgl_port_governor_note_touch(lvgl_port_governor_t *gov, uint32_t now_ms);
+
+void lvgl_port_governor_set_ignition(lvgl_port_governor_t *gov, bool ignition_on);
+
+// Re-evaluate (reads the thermal zone when due) and return the timer period to use
+uint32_t lvgl_port_governor_update(lvgl_port_governor_t *gov, uint32_t now_ms, bool animating);
+
+const char *lvgl_port_governor_level_name(lvgl_port_governor_level_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_GOVERNOR_H
@@ -0,0 +1,88 @@
+#include "lvgl_port_headless.h"
+#include "utils/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "lvgl_port_headless";
+
+bool lvgl_port_headless_open(lvgl_port_headless_t *headless, uint32_t width, uint32_t height)
+{
+	if (!headless) return false;
+
+	memset(headless, 0, sizeof(*headless));
+	headless->frame = calloc((size_t)width * height, sizeof(uint16_t));
+	if (!headless->frame) {
+
+		LOG_E(TAG, "No memory for a %ux%u frame", width, height);
+		return false;
+	}
+
+	headless->width = width;
+	headless->height = height;
+	LOG_I(TAG, "%ux%u RGB565 offscreen frame", width, height);
+	return true;
+}
+
+void lvgl_port_headless_close(lvgl_port_headless_t *headless)
+{
+	if (!headless) return;
+
+	free(headless->frame);
+	headless->frame = NULL;
+}
+
+void lvgl_port_headless_flush_area(lvgl_port_headless_t *headless, const lv_area_t *area, const uint8_t *pixels, int pitch)
+{
+	int32_t w = area->x2 - area->x1 + 1;
+	size_t row_bytes = (size_t)w * sizeof(uint16_t);
+	uint16_t *dst = headless->frame + (size_t)area->y1 * headless->width + area->x1;
+
+	for (int32_t y = area->y1; y <= area->y2; y++) {
+
+		memcpy(dst, pixels, row_bytes);
+		dst += headless->width;
+		pixels += pitch;
+	}
+
+	headless->flushed_px += (uint64_t)w * (area->y2 - area->y1 + 1);
+}
+
+bool lvgl_port_headless_save_ppm(const lvgl_port_headless_t *headless, const char *path)
+{
+	if (!headless || !headless->frame || !path) return false;
+
+	FILE *file = fopen(path, "wb");
+	if (!file) {
+
+		LOG_E(TAG, "Cannot write %s", path);
+		return false;
+	}
+
+	fprintf(file, "P6\n%u %u\n255\n", headless->width, headless->height);
+
+	uint8_t *row = malloc((size_t)headless->width * 3);
+	bool ok = (row != NULL);
+	for (uint32_t y = 0; ok && y < headless->height; y++) {
+
+		const uint16_t *src = headless->frame + (size_t)y * headless->width;
+		for (uint32_t x = 0; x < headless->width; x++) {
+
+			// RGB565 -> RGB888, replicating the top bits into the low ones
+			uint16_t c = src[x];
+			uint8_t r = (c >> 11) & 0x1F;
+			uint8_t g = (c >> 5) & 0x3F;
+			uint8_t b = c & 0x1F;
+			row[x * 3 + 0] = (uint8_t)((r << 3) | (r >> 2));
+			row[x * 3 + 1] = (uint8_t)((g << 2) | (g >> 4));
+			row[x * 3 + 2] = (uint8_t)((b << 3) | (b >> 2));
+		}
+		ok = fwrite(row, 3, headless->width, file) == headless->width;
+	}
+
+	free(row);
+	if (fclose(file) != 0) ok = false;
+	if (!ok) LOG_E(TAG, "Writing %s failed", path);
+	return ok;
+}
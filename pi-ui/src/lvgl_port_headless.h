@@ -0,0 +1,42 @@
+/*
+ * Headless output for the Pi display port
+ *
+ * Keeps the LVGL frame in memory (portrait RGB565, no rotation) so pi_ui runs
+ * with the same screens and modules on a machine without a display, GPU or
+ * touchscreen: benchmarks, CI and regression tests. The frame can be read back
+ * or written out as a PPM image.
+ */
+
+#ifndef LVGL_PORT_HEADLESS_H
+#define LVGL_PORT_HEADLESS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+	uint16_t *frame;             // width x height RGB565, rows packed
+	uint32_t width;
+	uint32_t height;
+	uint32_t frames;             // Completed frames
+	uint64_t flushed_px;         // Pixels written by flushes, all frames
+} lvgl_port_headless_t;
+
+bool lvgl_port_headless_open(lvgl_port_headless_t *headless, uint32_t width, uint32_t height);
+void lvgl_port_headless_close(lvgl_port_headless_t *headless);
+
+// Copy one flushed area (LVGL coordinates, RGB565 at `pitch` bytes per row) into the frame
+void lvgl_port_headless_flush_area(lvgl_port_headless_t *headless, const lv_area_t *area, const uint8_t *pixels, int pitch);
+
+// Write the frame as a binary PPM (P6, 8 bits per channel)
+bool lvgl_port_headless_save_ppm(const lvgl_port_headless_t *headless, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_HEADLESS_H
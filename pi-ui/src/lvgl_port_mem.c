@@ -0,0 +1,74 @@
+// LVGL's allocator hooks (LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM) on top of the region
+// allocator: lv_malloc() goes to the calling thread's current region, so a screen's
+// objects, styles and draw descriptors land in the region it pushed while building, and
+// everything else (draw threads, timers, caches) in the global one. There is no fixed
+// pool to fragment; mem_region.h has the details.
+
+#include <lvgl.h>
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+#include "utils/mem_region.h"
+
+void lv_mem_init(void)
+{
+	// Regions are set up on first use
+}
+
+void lv_mem_deinit(void)
+{
+	// Blocks still live belong to whoever outlives lv_deinit()
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+{
+	(void)mem;
+	(void)bytes;
+	return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+	(void)pool;
+}
+
+void *lv_malloc_core(size_t size)
+{
+	return mem_region_alloc_current(size);
+}
+
+void *lv_realloc_core(void *p, size_t new_size)
+{
+	return mem_region_realloc(p, new_size);
+}
+
+void lv_free_core(void *p)
+{
+	mem_region_free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+{
+	mem_region_stats_t stats;
+	mem_region_get_total_stats(&stats);
+
+	mon_p->total_size = stats.chunk_bytes + stats.large_bytes;
+	mon_p->free_size = mon_p->total_size - stats.used_bytes;
+	mon_p->free_biggest_size = stats.biggest_free;
+	mon_p->used_cnt = stats.live_blocks;
+	mon_p->max_used = stats.max_used_bytes;
+	mon_p->used_pct = mon_p->total_size ? (uint8_t)(stats.used_bytes * 100 / mon_p->total_size) : 0;
+
+	// Same measure as LVGL's TLSF pool: how much of the free memory the biggest block isn't.
+	// Free here is chunk space not in use (free lists, chunk tails, unused bump space);
+	// larger requests bypass the chunks and never fail on fragmentation.
+	size_t biggest = stats.biggest_free < mon_p->free_size ? stats.biggest_free : mon_p->free_size;
+	mon_p->frag_pct = mon_p->free_size ? (uint8_t)(100 - biggest * 100 / mon_p->free_size) : 0;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+	return LV_RESULT_OK;
+}
+
+#endif // LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
@@ -0,0 +1,226 @@
+#include "lvgl_port_overlay.h"
+#include "lvgl_port_profile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define GRAPH_FRAMES 90                              // Newest on the right
+#define GRAPH_BAR_W 2
+#define GRAPH_W (GRAPH_FRAMES * GRAPH_BAR_W)
+#define GRAPH_H 64
+#define GRAPH_SCALE_US (LV_DEF_REFR_PERIOD * 4000)   // Full height: four refresh periods
+#define WORST_H 6
+#define WORST_LISTED 4                               // Largest phases named for the worst frame
+
+#define RGB565(hex) (uint16_t)((((hex) >> 8) & 0xF800) | (((hex) >> 5) & 0x07E0) | (((hex) >> 3) & 0x001F))
+
+static const uint16_t phase_colors[LVGL_PORT_PHASE_COUNT] = {
+	[LVGL_PORT_PHASE_EVENTS]  = RGB565(0x9E9E9E),
+	[LVGL_PORT_PHASE_DATA]    = RGB565(0x8D6E63),
+	[LVGL_PORT_PHASE_STORE]   = RGB565(0xFFB300),
+	[LVGL_PORT_PHASE_MODULES] = RGB565(0xFB8C00),
+	[LVGL_PORT_PHASE_SCREENS] = RGB565(0xE53935),
+	[LVGL_PORT_PHASE_LAYOUT]  = RGB565(0x8E24AA),
+	[LVGL_PORT_PHASE_DRAW]    = RGB565(0x1E88E5),
+	[LVGL_PORT_PHASE_FLUSH]   = RGB565(0x43A047),
+	[LVGL_PORT_PHASE_OTHER]   = RGB565(0x546E7A),
+};
+#define BUDGET_COLOR RGB565(0xBDBDBD)
+#define OVER_COLOR RGB565(0xFFFFFF)
+
+static lv_obj_t *panel = NULL;
+static lv_obj_t *stats_label = NULL;
+static lv_obj_t *graph = NULL;
+static lv_obj_t *worst_bar = NULL;
+static lv_obj_t *worst_label = NULL;
+static uint16_t graph_pixels[GRAPH_H * GRAPH_W];
+static uint16_t worst_pixels[WORST_H * GRAPH_W];
+static bool visible = true;
+static uint32_t last_graph_ms = 0;
+
+static lv_obj_t *create_label(lv_obj_t *parent, const lv_font_t *font, const char *text)
+{
+	lv_obj_t *label = lv_label_create(parent);
+	lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+	lv_obj_set_style_text_font(label, font, 0);
+	lv_label_set_text(label, text);
+	return label;
+}
+
+void lvgl_port_overlay_create(lv_obj_t *parent)
+{
+	if (panel) return; // Already created
+
+	panel = lv_obj_create(parent);
+	lv_obj_remove_style_all(panel);
+	lv_obj_set_size(panel, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+	lv_obj_set_style_bg_color(panel, lv_color_hex(0x000000), 0);
+	lv_obj_set_style_bg_opa(panel, LV_OPA_80, 0);
+	lv_obj_set_style_pad_all(panel, 8, 0);
+	lv_obj_set_style_pad_row(panel, 4, 0);
+	lv_obj_set_style_radius(panel, 4, 0);
+	lv_obj_set_flex_flow(panel, LV_FLEX_FLOW_COLUMN);
+	lv_obj_align(panel, LV_ALIGN_TOP_RIGHT, -10, 10);
+	lv_obj_add_flag(panel, LV_OBJ_FLAG_FLOATING); // Float above other content
+	lv_obj_add_flag(panel, LV_OBJ_FLAG_IGNORE_LAYOUT); // Ignore layout constraints
+	lv_obj_clear_flag(panel, LV_OBJ_FLAG_CLICKABLE);
+	lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+	stats_label = create_label(panel, &lv_font_montserrat_14, "FPS: 0.0");
+
+	graph = lv_canvas_create(panel);
+	lv_canvas_set_buffer(graph, graph_pixels, GRAPH_W, GRAPH_H, LV_COLOR_FORMAT_RGB565);
+
+	worst_bar = lv_canvas_create(panel);
+	lv_canvas_set_buffer(worst_bar, worst_pixels, GRAPH_W, WORST_H, LV_COLOR_FORMAT_RGB565);
+
+	worst_label = create_label(panel, &lv_font_montserrat_12, "Worst: -");
+
+	lv_obj_move_foreground(panel); // Move to front
+	if (!visible) {
+		lv_obj_add_flag(panel, LV_OBJ_FLAG_HIDDEN);
+	}
+}
+
+void lvgl_port_overlay_set_visible(bool show)
+{
+	visible = show;
+	if (!panel) return;
+
+	if (visible) {
+
+		lv_obj_clear_flag(panel, LV_OBJ_FLAG_HIDDEN);
+		last_graph_ms -= LVGL_PORT_OVERLAY_GRAPH_MS; // Redraw on the next update
+	} else {
+
+		lv_obj_add_flag(panel, LV_OBJ_FLAG_HIDDEN);
+	}
+}
+
+static void fill_rect(uint16_t *pixels, int stride, int x, int y, int w, int h, uint16_t color)
+{
+	for (int row = y; row < y + h; row++) {
+
+		uint16_t *px = &pixels[row * stride + x];
+		for (int col = 0; col < w; col++) px[col] = color;
+	}
+}
+
+// One column per frame, phases stacked bottom-up in enum order
+static void draw_graph(void)
+{
+	memset(graph_pixels, 0, sizeof(graph_pixels));
+
+	for (int age = 0; age < GRAPH_FRAMES; age++) {
+
+		const lvgl_port_frame_profile_t *frame = lvgl_port_profile_frame(age);
+		if (!frame) break;
+
+		int x = GRAPH_W - (age + 1) * GRAPH_BAR_W;
+		int bottom = GRAPH_H;
+		uint32_t stacked_us = 0;
+		for (int p = 0; p < LVGL_PORT_PHASE_COUNT && bottom > 0; p++) {
+
+			stacked_us += frame->phase_wall_us[p];
+			int top = GRAPH_H - (int)((uint64_t)stacked_us * GRAPH_H / GRAPH_SCALE_US);
+			if (top < 0) top = 0;
+			fill_rect(graph_pixels, GRAPH_W, x, top, GRAPH_BAR_W, bottom - top, phase_colors[p]);
+			bottom = top;
+		}
+
+		// Off the scale
+		if (stacked_us > GRAPH_SCALE_US) {
+			fill_rect(graph_pixels, GRAPH_W, x, 0, GRAPH_BAR_W, 2, OVER_COLOR);
+		}
+	}
+
+	// Refresh budget, dashed so the bars show through
+	int budget_y = GRAPH_H - LV_DEF_REFR_PERIOD * 1000 * GRAPH_H / GRAPH_SCALE_US;
+	for (int x = 0; x < GRAPH_W; x += 4) {
+		fill_rect(graph_pixels, GRAPH_W, x, budget_y, 2, 1, BUDGET_COLOR);
+	}
+
+	lv_obj_invalidate(graph);
+}
+
+// Worst frame in the ring: phase shares as a strip, largest phases as text
+static void draw_worst(void)
+{
+	const lvgl_port_frame_profile_t *worst = NULL;
+	for (int age = 0; age < lvgl_port_profile_frame_count(); age++) {
+
+		const lvgl_port_frame_profile_t *frame = lvgl_port_profile_frame(age);
+		if (!worst || frame->wall_us > worst->wall_us) worst = frame;
+	}
+
+	memset(worst_pixels, 0, sizeof(worst_pixels));
+	if (!worst || worst->wall_us == 0) {
+
+		lv_obj_invalidate(worst_bar);
+		return;
+	}
+
+	int x = 0;
+	for (int p = 0; p < LVGL_PORT_PHASE_COUNT && x < GRAPH_W; p++) {
+
+		int w = (int)((uint64_t)worst->phase_wall_us[p] * GRAPH_W / worst->wall_us);
+		if (x + w > GRAPH_W) w = GRAPH_W - x;
+		fill_rect(worst_pixels, GRAPH_W, x, 0, w, WORST_H, phase_colors[p]);
+		x += w;
+	}
+	lv_obj_invalidate(worst_bar);
+
+	// Largest phases first
+	bool listed[LVGL_PORT_PHASE_COUNT] = { false };
+	char text[128];
+	int len = snprintf(text, sizeof(text), "Worst: %.1f ms", worst->wall_us / 1000.0f);
+	for (int n = 0; n < WORST_LISTED; n++) {
+
+		int largest = -1;
+		for (int p = 0; p < LVGL_PORT_PHASE_COUNT; p++) {
+
+			if (!listed[p] && (largest < 0 || worst->phase_wall_us[p] > worst->phase_wall_us[largest])) largest = p;
+		}
+		if (largest < 0 || worst->phase_wall_us[largest] == 0) break;
+
+		listed[largest] = true;
+		len += snprintf(text + len, sizeof(text) - (size_t)len, "%s%s %.1f", n % 2 == 0 ? "\n" : "   ",
+			lvgl_port_profile_phase_name((lvgl_port_phase_t)largest), worst->phase_wall_us[largest] / 1000.0f);
+	}
+
+	if (strcmp(lv_label_get_text(worst_label), text) != 0) {
+		lv_label_set_text(worst_label, text);
+	}
+}
+
+bool lvgl_port_overlay_update(uint32_t now_ms, float fps, float area_kpx, float area_pct, float max_area_pct, lv_area_t *area)
+{
+	if (!panel || !visible) return false;
+
+	char stats_text[96];
+	snprintf(stats_text, sizeof(stats_text), "FPS: %.1f\nArea: %.1fk px (%.1f%%)\nMax: %.1f%%",
+		fps, area_kpx, area_pct, max_area_pct);
+
+	// Only touch the label when something changed: every set_text or reorder invalidates it,
+	// which would otherwise put the overlay itself in every frame's redrawn area
+	if (strcmp(lv_label_get_text(stats_label), stats_text) != 0) {
+
+		lv_label_set_text(stats_label, stats_text);
+	}
+
+	if (now_ms - last_graph_ms >= LVGL_PORT_OVERLAY_GRAPH_MS) {
+
+		last_graph_ms = now_ms;
+		draw_graph();
+		draw_worst();
+	}
+
+	lv_obj_t *parent = lv_obj_get_parent(panel);
+	if (parent && lv_obj_get_index(panel) != (int32_t)lv_obj_get_child_count(parent) - 1) {
+
+		lv_obj_move_foreground(panel); // Ensure it stays on top
+	}
+
+	lv_obj_get_coords(panel, area);
+	return true;
+}
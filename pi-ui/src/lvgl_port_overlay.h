@@ -0,0 +1,35 @@
+/*
+ * Frame profiler overlay for the Pi display port
+ *
+ * Replaces the FPS label: the FPS / redrawn area line, one stacked bar per recent
+ * frame (a colour per lvgl_port_profile phase, a dashed line at the refresh
+ * budget) and the worst frame in the profile ring as a stacked strip plus its
+ * largest phases. Toggled with 'F'. LVGL context.
+ */
+
+#ifndef LVGL_PORT_OVERLAY_H
+#define LVGL_PORT_OVERLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The bar graph and worst frame refresh at most this often: redrawing the overlay is work too
+#define LVGL_PORT_OVERLAY_GRAPH_MS 250
+
+void lvgl_port_overlay_create(lv_obj_t *parent);
+void lvgl_port_overlay_set_visible(bool visible);
+
+// Refresh the overlay (redrawn area of the average and worst frame as a share of the
+// screen); while visible returns true and its bounds in *area
+bool lvgl_port_overlay_update(uint32_t now_ms, float fps, float area_kpx, float area_pct, float max_area_pct, lv_area_t *area);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_OVERLAY_H
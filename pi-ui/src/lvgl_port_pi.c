@@ -3,16 +3,36 @@
  * Updated for LVGL v9 API
  */
 #include "lvgl_port_pi.h"
+#include "lvgl_port_buffers.h"
+#include "lvgl_port_rotate.h"
+#include "lvgl_port_fbdev.h"
+#include "lvgl_port_governor.h"
+#include "lvgl_port_headless.h"
+#include "lvgl_port_profile.h"
+#include "lvgl_port_overlay.h"
+#include "utils/time_source.h"
+#include "utils/trace.h"
+#include "utils/startup_profile.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 #include <SDL2/SDL.h>
 #include <lvgl.h>
 #include "drivers/evdev/lv_evdev.h"
+#include "utils/log.h"
 
-static const char *TAG = "lv_port_pi";
+static const char *TAG = "lvgl_port_pi";
 
 // Logical resolution for LVGL (portrait)
 #define LVGL_HOR_RES 480
@@ -22,21 +42,93 @@ static const char *TAG = "lv_port_pi";
 #define DISP_HOR_RES 800
 #define DISP_VER_RES 480
 
+// Touchscreen (LVGL reads it through lv_evdev; the loop also watches it to wake up)
+#define TOUCH_DEVICE "/dev/input/event7"
+
 // Global flag to control main loop
 static volatile bool running = true;
 
+// Output backend: SDL window (default), a memory-mapped framebuffer / file / memfd, or an
+// offscreen frame in memory (headless)
+typedef enum {
+	OUTPUT_SDL = 0,
+	OUTPUT_FBDEV,
+	OUTPUT_HEADLESS,
+} port_output_t;
+
+static port_output_t output = OUTPUT_SDL;
+static char output_target[256] = "";
+static lvgl_port_fbdev_t fbdev;
+static lvgl_port_headless_t headless;
+
+// Headless clock: 0 runs in real time as fast as possible; otherwise the shared time source
+// is virtual and every loop iteration advances it by this many ms, however long it really took
+static uint32_t headless_step_ms = 0;
+
+// Stop the main loop after this many (port) milliseconds; 0 runs until asked to quit
+static uint32_t run_limit_ms = 0;
+
+// Millisecond ticks for the loop, governor and FPS overlay: the same clock the UI reads
+static uint32_t port_get_ticks(void)
+{
+	return time_source_ms();
+}
+
 // FPS tracking variables
 static uint32_t frame_count = 0;
 static float current_fps = 0.0f;
 static bool show_fps = true;
-static lv_obj_t *fps_label = NULL;
 static uint32_t last_tick = 0;
 static uint32_t last_calculation_time = 0;
 
+// Redrawn-area tracking (partial render mode): pixels flushed in the current frame and
+// over the current measurement window
+static uint32_t frame_area_px = 0;
+static uint64_t window_area_px = 0;
+static uint32_t window_max_area_px = 0;
+static float current_area_px = 0.0f;
+static uint32_t current_max_area_px = 0;
+
+// Frame governor: LVGL's timers run slower while the screen is static, the ignition is off or
+// the SoC is hot, and the loop sleeps until the next timer is due or the touchscreen reports
+static bool governor_enabled = true;
+static lvgl_port_governor_config_t governor_config;
+static bool governor_config_custom = false;
+static lvgl_port_governor_t governor;
+
+// Event loop: one epoll set over a second, non-blocking handle on the touchscreen (every open
+// file gets its own copy of the events; LVGL reads through its own), an eventfd the data
+// producer signals and a timerfd armed to LVGL's next timer deadline
+enum {
+	WAKE_TOUCH = 1,
+	WAKE_DATA,
+	WAKE_TIMER,
+};
+static int epoll_fd = -1;
+static int touch_wake_fd = -1;
+static int data_event_fd = -1;
+static int timer_fd = -1;
+static lv_timer_t *data_timer = NULL;   // Run right away when the producer signals
+
+// Timers the governor paces, with the period they run at when active
+#define PACED_TIMERS_MAX 8
+typedef struct {
+	lv_timer_t *timer;
+	uint32_t base_period_ms;
+} paced_timer_t;
+static paced_timer_t paced_timers[PACED_TIMERS_MAX];
+static int paced_timer_count = 0;
+static uint32_t paced_period_ms = 0;
+
+// Overlay bounds: frames that only redraw the overlay don't count as content changes
+static lv_area_t overlay_area;
+static bool overlay_visible = false;
+static bool frame_content_changed = false;
+
 // Initial FPS calculation callback (runs once after 1 second)
 static void initial_fps_callback(lv_timer_t *timer)
 {
-	uint32_t now = SDL_GetTicks();
+	uint32_t now = port_get_ticks();
 	if (now - last_tick > 0) {
 		current_fps = (float)frame_count * 1000.0f / (now - last_tick);
 	}
@@ -49,7 +141,7 @@ static void fps_timer_cb(lv_timer_t *timer)
 	static int call_count = 0;
 	call_count++;
 
-	uint32_t now = SDL_GetTicks();
+	uint32_t now = port_get_ticks();
 
 	// Update FPS every 500ms for more responsive display
 	if (now - last_calculation_time >= 500) {
@@ -58,6 +150,10 @@ static void fps_timer_cb(lv_timer_t *timer)
 
 			current_fps = (float)frame_count * 1000.0f / (now - last_calculation_time);
 		}
+		current_area_px = frame_count ? (float)window_area_px / (float)frame_count : 0.0f;
+		current_max_area_px = window_max_area_px;
+		window_area_px = 0;
+		window_max_area_px = 0;
 		frame_count = 0;
 		last_calculation_time = now; // Update last_calculation_time to current time for next calculation
 	}
@@ -70,47 +166,24 @@ static void signal_handler(int sig)
 	running = false;
 }
 
-// Function to create FPS label on screen
-static void create_fps_label(void)
-{
-	if (fps_label) return; // Already created
-
-	// Create FPS label
-	fps_label = lv_label_create(lv_scr_act());
-	lv_label_set_text(fps_label, "FPS: 0.0");
-	lv_obj_set_style_text_color(fps_label, lv_color_hex(0xFFFFFF), 0);
-	lv_obj_set_style_text_font(fps_label, &lv_font_montserrat_14, 0);
-	lv_obj_set_style_bg_color(fps_label, lv_color_hex(0x000000), 0);
-	lv_obj_set_style_bg_opa(fps_label, LV_OPA_80, 0);
-	lv_obj_set_style_pad_all(fps_label, 8, 0);
-	lv_obj_set_style_radius(fps_label, 4, 0);
-	lv_obj_align(fps_label, LV_ALIGN_TOP_RIGHT, -10, 10);
-	lv_obj_add_flag(fps_label, LV_OBJ_FLAG_FLOATING); // Float above other content
-	lv_obj_add_flag(fps_label, LV_OBJ_FLAG_IGNORE_LAYOUT); // Ignore layout constraints
-	lv_obj_clear_flag(fps_label, LV_OBJ_FLAG_CLICKABLE);
-	lv_obj_move_foreground(fps_label); // Move to front
-}
-
-// Function to update FPS display on screen
+// Profiler overlay: FPS, redrawn area and per-phase frame times (lvgl_port_overlay)
 static void update_fps_display(void)
 {
-	if (!show_fps || !fps_label) return;
-
-	char fps_text[32];
-	snprintf(fps_text, sizeof(fps_text), "FPS: %.1f", current_fps);
-	lv_label_set_text(fps_label, fps_text);
-	lv_obj_move_foreground(fps_label); // Ensure it stays on top
+	const float screen_px = (float)(LVGL_HOR_RES * LVGL_VER_RES);
+	overlay_visible = lvgl_port_overlay_update(port_get_ticks(), current_fps, current_area_px / 1000.0f,
+		current_area_px * 100.0f / screen_px, (float)current_max_area_px * 100.0f / screen_px, &overlay_area);
 }
 
-#define DISP_BUF_SIZE (LVGL_HOR_RES * LVGL_VER_RES)
-
 // Global display dimensions
 static uint32_t g_display_width = LVGL_HOR_RES;
 static uint32_t g_display_height = LVGL_VER_RES;
 
-// Buffers
-static lv_color_t buf_1[DISP_BUF_SIZE];
-static lv_color_t buf_2[DISP_BUF_SIZE];
+// Draw buffers (strategy chosen before lvgl_port_init)
+static lvgl_port_buffer_config_t buffer_config = {
+	.mode = LVGL_PORT_BUFFER_PARTIAL,
+	.partial_lines = LVGL_PORT_PARTIAL_LINES_DEFAULT,
+};
+static lvgl_port_buffers_t buffers;
 
 // Display and input device handles
 static lv_display_t *disp;
@@ -121,24 +194,129 @@ static SDL_Window *window;
 static SDL_Renderer *renderer;
 static SDL_Texture *texture;
 
-// Mouse state for input
+// Portrait -> landscape rotation: SDL (default) or the CPU into a landscape streaming texture
+static lvgl_port_rotation_t rotation = LVGL_PORT_ROTATE_SDL;
+static SDL_Texture *landscape;
+
+// Landscape composite (render target) holding the rotated frame between flushes, so each
+// frame only re-rotates the areas LVGL flushed
+static SDL_Texture *composite;
+static atomic_bool composite_full_damage = true;
+
+// Portrait areas flushed in the current frame
+#define FRAME_AREAS_MAX 32
+static lv_area_t frame_areas[FRAME_AREAS_MAX];
+static int frame_area_count = 0;
+static bool frame_areas_overflow = false;
+
+// Presenter thread (SDL output): owns the renderer, takes flushed areas from a lock-free
+// single-producer/single-consumer queue, uploads each one and hands the draw buffer straight
+// back with flush_ready, then composes and presents while LVGL renders the next frame.
+// Jobs only carry pointers into LVGL's draw buffer: LVGL doesn't touch a flushed buffer
+// again until flush_ready, so at most one job is ever outstanding.
+#define PRESENT_QUEUE_SIZE 4
+
+typedef struct {
+	lv_area_t area;
+	const uint8_t *pixels;
+	int pitch;
+	bool last;
+} present_job_t;
+
+static bool present_threaded = true;     // Requested (lvgl_port_set_present_threaded)
+static bool presenter_active = false;    // Running for this session
+static pthread_t presenter_thread;
+static present_job_t present_queue[PRESENT_QUEUE_SIZE];
+static atomic_uint present_head;         // Next slot the LVGL thread fills
+static atomic_uint present_tail;         // Next slot the presenter uploads
+static atomic_bool presenter_stop;
+static sem_t present_work;               // One post per job (and one to stop)
+static sem_t present_done;               // Posted after an upload, only while the LVGL thread waits
+static atomic_bool present_waiting;      // LVGL thread blocked (or about to block) on present_done
+static sem_t presenter_ready;            // Renderer created (or failed) on the presenter
+static int presenter_init_result = -1;
+
+// Virtual pointer (headless, or when the touchscreen can't be opened): driven by
+// lvgl_port_set_pointer and, in the SDL window, the mouse
+static bool pointer_virtual = false;
 static int32_t mouse_x = 0;
 static int32_t mouse_y = 0;
 static bool mouse_pressed = false;
 
+// Zero-copy flush (texture strategy): LVGL renders straight into the locked streaming
+// texture, so a flush is just unlock (upload), render-copy and present
+static bool texture_direct = false;
+static void *texture_pixels = NULL;
+static int texture_pitch = 0;
+static bool texture_rebind_pending = false;
+
+// Lock the whole streaming texture and keep it locked while LVGL renders into it.
+// Only usable when the driver hands back the same CPU-side pixels on every lock (SDL's
+// software, OpenGL and GLES2 renderers keep a persistent copy), so content LVGL didn't
+// redraw survives between frames, and when its pitch matches the LVGL stride.
+static bool texture_direct_init(void)
+{
+	void *pixels;
+	int pitch;
+	if (SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0) {
 
-// Display flush callback + Software Rotation
-static void disp_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+		LOG_W(TAG, "SDL_LockTexture failed: %s", SDL_GetError());
+		return false;
+	}
+	SDL_UnlockTexture(texture);
+
+	void *relocked;
+	if (SDL_LockTexture(texture, NULL, &relocked, &pitch) != 0) {
+
+		LOG_W(TAG, "SDL_LockTexture failed: %s", SDL_GetError());
+		return false;
+	}
+
+	if (relocked != pixels) {
+
+		LOG_W(TAG, "texture pixels move between locks");
+		SDL_UnlockTexture(texture);
+		return false;
+	}
+
+	if (!lvgl_port_buffers_create_external(disp, pixels, (uint32_t)pitch, &buffers)) {
+
+		SDL_UnlockTexture(texture);
+		return false;
+	}
+
+	texture_pixels = pixels;
+	texture_pitch = pitch;
+	return true;
+}
+
+// Point LVGL at new texture pixels if a relock moved them (outside of rendering)
+static void texture_direct_rebind(void)
 {
-	frame_count++;
+	texture_rebind_pending = false;
 
-	// Update the entire LVGL portrait texture (480x800)
-	// Pitch = width in pixels * sizeof(lv_color_t) = 480 * 2 bytes for RGB565
-	if (SDL_UpdateTexture(texture, NULL, px_map, LVGL_HOR_RES * 2) != 0) {
+	if (!lvgl_port_buffers_create_external(disp, texture_pixels, (uint32_t)texture_pitch, &buffers)) {
 
-		printf("SDL_UpdateTexture failed: %s\n", SDL_GetError());
+		// Pitch no longer matches: drop to copying from regular draw buffers
+		SDL_UnlockTexture(texture);
+		texture_direct = false;
+		buffer_config = lvgl_port_buffer_config_default();
+		if (!lvgl_port_buffers_create(disp, &buffer_config, &buffers)) {
+
+			LOG_E(TAG, "No draw buffers after texture fallback");
+			running = false;
+			return;
+		}
 	}
 
+	// Relocked pixels are undefined: render everything once
+	lv_obj_invalidate(lv_screen_active());
+}
+
+
+// Rotate the whole portrait texture straight onto the screen (no render-target support)
+static void compose_rotated_full(void)
+{
 	SDL_RenderClear(renderer);
 
 	// Destination rectangle: width and height swapped relative to the texture
@@ -166,15 +344,308 @@ static void disp_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px
 	if( SDL_RenderCopyEx( renderer, texture, NULL, &destinantion_rectangle, 90, NULL, SDL_FLIP_NONE ) != 0 ){
 
 		//  rotation failed
-		printf("SDL_RenderCopyEx failed: %s\n", SDL_GetError());
+		LOG_E(TAG, "SDL_RenderCopyEx failed: %s", SDL_GetError());
+	}
+}
+
+// Re-rotate one flushed portrait area into the landscape composite.
+// Portrait (x, y) lands at landscape (DISP_HOR_RES - 1 - y, x) after the 90° clockwise turn;
+// SDL rotates around the destination rect's centre, so the unrotated rect is placed centred
+// on where the area lands (float rect: the centre can fall on a half pixel).
+static void rotate_area_into_composite(const lv_area_t *area)
+{
+	int32_t w = lv_area_get_width(area);
+	int32_t h = lv_area_get_height(area);
+	SDL_Rect source = { area->x1, area->y1, w, h };
+
+	float center_x = (float)(DISP_HOR_RES - 1 - area->y2) + h / 2.0f;
+	float center_y = (float)area->x1 + w / 2.0f;
+	SDL_FRect destination = { center_x - w / 2.0f, center_y - h / 2.0f, (float)w, (float)h };
+
+	if (SDL_RenderCopyExF(renderer, texture, &source, &destination, 90, NULL, SDL_FLIP_NONE) != 0) {
+
+		LOG_E(TAG, "SDL_RenderCopyExF failed: %s", SDL_GetError());
 	}
+}
+
+// Where an 800x480 landscape texture goes on the renderer output (centred)
+static SDL_Rect landscape_destination(void)
+{
+	int renderer_output_width, renderer_output_height;
+	SDL_GetRendererOutputSize(renderer, &renderer_output_width, &renderer_output_height);
+
+	SDL_Rect destination = {
+		(renderer_output_width - DISP_HOR_RES) / 2,
+		(renderer_output_height - DISP_VER_RES) / 2,
+		DISP_HOR_RES, DISP_VER_RES
+	};
+	return destination;
+}
+
+// Software rotation: turn one flushed area straight into its landscape spot. The locked rect
+// is fully overwritten, so the lock's write-only pixels are fine.
+static void rotate_area_into_landscape(const lv_area_t *area, const uint8_t *pixels, int pitch)
+{
+	int32_t w = lv_area_get_width(area);
+	int32_t h = lv_area_get_height(area);
+	SDL_Rect rect = { DISP_HOR_RES - 1 - area->y2, area->x1, h, w };
+
+	void *out;
+	int out_pitch;
+	if (SDL_LockTexture(landscape, &rect, &out, &out_pitch) != 0) {
+
+		LOG_E(TAG, "SDL_LockTexture failed: %s", SDL_GetError());
+		return;
+	}
+
+	lvgl_port_rotate90_rgb565((const uint16_t *)pixels, pitch / 2, (uint16_t *)out, out_pitch / 2, w, h);
+	SDL_UnlockTexture(landscape);
+}
+
+// Software rotation: the landscape texture already holds the frame
+static void compose_landscape(void)
+{
+	SDL_RenderClear(renderer);
+
+	SDL_Rect destination = landscape_destination();
+	if (SDL_RenderCopy(renderer, landscape, NULL, &destination) != 0) {
+
+		LOG_E(TAG, "SDL_RenderCopy failed: %s", SDL_GetError());
+	}
+}
+
+// Update the persistent landscape composite with this frame's damaged areas only, then put
+// the composite on screen with a plain (unrotated) copy
+static void compose_damaged(void)
+{
+	SDL_SetRenderTarget(renderer, composite);
+
+	bool full_damage = atomic_exchange(&composite_full_damage, false);
+	if (full_damage || frame_areas_overflow) {
+
+		lv_area_t whole = { 0, 0, LVGL_HOR_RES - 1, LVGL_VER_RES - 1 };
+		rotate_area_into_composite(&whole);
+	} else {
+
+		for (int i = 0; i < frame_area_count; i++) {
+			rotate_area_into_composite(&frame_areas[i]);
+		}
+	}
+
+	SDL_SetRenderTarget(renderer, NULL);
+	SDL_RenderClear(renderer);
+
+	SDL_Rect destination = landscape_destination();
+	if (SDL_RenderCopy(renderer, composite, NULL, &destination) != 0) {
+
+		LOG_E(TAG, "SDL_RenderCopy failed: %s", SDL_GetError());
+	}
+}
+
+// Put one flushed area where compose expects it and remember it for the damaged-area compose.
+// SDL rotation uploads just the redrawn rectangle into the LVGL portrait texture (480x800);
+// the texture keeps every other pixel from earlier frames. Rotation happens on compose,
+// so the stripe/frame layout of the draw buffer doesn't matter here.
+static void upload_area(const lv_area_t *area, const uint8_t *pixels, int pitch)
+{
+	if (rotation == LVGL_PORT_ROTATE_SOFTWARE) {
+
+		rotate_area_into_landscape(area, pixels, pitch);
+	} else if (!texture_direct) {
+
+		// (Texture strategy: the area is already in the texture)
+		SDL_Rect rect = { area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area) };
+		if (SDL_UpdateTexture(texture, &rect, pixels, pitch) != 0) {
+			LOG_E(TAG, "SDL_UpdateTexture failed: %s", SDL_GetError());
+		}
+	}
+
+	if (frame_area_count < FRAME_AREAS_MAX) {
+
+		frame_areas[frame_area_count++] = *area;
+	} else {
+
+		// Too many pieces this frame: re-rotate everything
+		frame_areas_overflow = true;
+	}
+}
+
+// Frame complete: compose the uploaded areas onto the screen and present
+static void present_frame(void)
+{
+	if (texture_direct) {
+
+		// Unlock uploads what LVGL rendered in place
+		SDL_UnlockTexture(texture);
+	}
+
+	if (rotation == LVGL_PORT_ROTATE_SOFTWARE) {
+
+		compose_landscape();
+	} else if (composite) {
+
+		compose_damaged();
+	} else {
+
+		compose_rotated_full();
+	}
+	frame_area_count = 0;
+	frame_areas_overflow = false;
 
 	SDL_RenderPresent(renderer);
 
+	if (texture_direct) {
+
+		// Relock for the next frame; LVGL keeps drawing into the same pixels
+		void *pixels_next;
+		if (SDL_LockTexture(texture, NULL, &pixels_next, &texture_pitch) != 0) {
+
+			LOG_E(TAG, "SDL_LockTexture failed: %s", SDL_GetError());
+		} else if (pixels_next != texture_pixels) {
+
+			texture_pixels = pixels_next;
+			texture_rebind_pending = true;
+		}
+	}
+}
+
+// LVGL thread: sleep until the presenter has uploaded up to (not including) slot target
+static void present_wait_tail(unsigned target)
+{
+	// A post that raced with the last wakeup; at most one is left over
+	while (sem_trywait(&present_done) == 0) {
+	}
+
+	while ((int)(atomic_load(&present_tail) - target) < 0) {
+
+		// Flag first, then re-check: the presenter stores the tail, then reads the flag
+		atomic_store(&present_waiting, true);
+		if ((int)(atomic_load(&present_tail) - target) >= 0) {
+
+			atomic_store(&present_waiting, false);
+			break;
+		}
+		sem_wait(&present_done);
+	}
+}
+
+// LVGL thread: queue a flushed area for the presenter (flush_ready comes from there)
+static void present_submit(const lv_area_t *area, const uint8_t *pixels, int pitch, bool last)
+{
+	unsigned head = atomic_load_explicit(&present_head, memory_order_relaxed);
+	if (head - atomic_load_explicit(&present_tail, memory_order_acquire) >= PRESENT_QUEUE_SIZE) {
+		present_wait_tail(head - PRESENT_QUEUE_SIZE + 1);
+	}
+
+	present_job_t *job = &present_queue[head % PRESENT_QUEUE_SIZE];
+	job->area = *area;
+	job->pixels = pixels;
+	job->pitch = pitch;
+	job->last = last;
+
+	atomic_store_explicit(&present_head, head + 1, memory_order_release);
+	sem_post(&present_work);
+}
+
+// LVGL's wait for the previous flush: sleep until the presenter has uploaded every queued area
+// instead of spinning on the flushing flag
+static void present_flush_wait(lv_display_t *display)
+{
+	(void)display;
+
+	present_wait_tail(atomic_load_explicit(&present_head, memory_order_relaxed));
+}
+
+// Display flush callback + Software Rotation
+static void disp_flush_area(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+	int pitch;
+	const uint8_t *pixels = lvgl_port_buffers_area_pixels(&buffers, disp, area, px_map, &pitch);
+	bool last = lv_display_flush_is_last(disp);
+
+	frame_area_px += (uint32_t)(lv_area_get_width(area) * lv_area_get_height(area));
+	if (!overlay_visible || !lv_area_is_in(area, &overlay_area, 0)) {
+		frame_content_changed = true;
+	}
+
+	if (last) {
+
+		frame_count++;
+		window_area_px += frame_area_px;
+		if (frame_area_px > window_max_area_px) window_max_area_px = frame_area_px;
+		frame_area_px = 0;
+
+		lvgl_port_governor_note_frame(&governor, port_get_ticks(), frame_content_changed);
+		frame_content_changed = false;
+	}
+
+	if (presenter_active) {
+
+		// The presenter uploads, releases the buffer and (after the last area) presents
+		present_submit(area, pixels, pitch, last);
+		return;
+	}
+
+	if (output == OUTPUT_HEADLESS) {
+
+		lvgl_port_headless_flush_area(&headless, area, pixels, pitch);
+		if (last) headless.frames++;
+		lv_display_flush_ready(disp);
+		return;
+	}
+
+	if (output == OUTPUT_FBDEV) {
+
+		lvgl_port_fbdev_flush_area(&fbdev, area, pixels, pitch);
+		if (last) {
+
+			// Flip to the page the areas went into
+			lvgl_port_fbdev_present(&fbdev);
+		}
+		lv_display_flush_ready(disp);
+		return;
+	}
+
+	upload_area(area, pixels, pitch);
+
+	// More areas of this frame still to come: compose once, after the last one
+	if (last) {
+		present_frame();
+	}
+
 	// Tell LVGL we're done flushing
 	lv_display_flush_ready( disp );
 }
 
+static void disp_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+	TRACE_SCOPE("flush");
+	lvgl_port_phase_mark_t mark = lvgl_port_profile_mark();
+	disp_flush_area(disp, area, px_map);
+	lvgl_port_profile_add(LVGL_PORT_PHASE_FLUSH, mark);
+}
+
+// Refresh start, render start and refresh end split LVGL's refresh into layout and drawing
+static void disp_refr_event_cb(lv_event_t *e)
+{
+	static bool rendered = false;
+
+	switch (lv_event_get_code(e)) {
+		case LV_EVENT_REFR_START:
+			lvgl_port_profile_refr_start();
+			rendered = false;
+			break;
+		case LV_EVENT_RENDER_START:
+			lvgl_port_profile_render_start();
+			rendered = true;
+			break;
+		default:
+			lvgl_port_profile_refr_ready();
+			if (rendered) startup_profile_frame_rendered();
+			break;
+	}
+}
+
 // Input device read callback
 static void indev_read(lv_indev_t * indev, lv_indev_data_t * data)
 {
@@ -183,16 +654,12 @@ static void indev_read(lv_indev_t * indev, lv_indev_data_t * data)
 	data->state = mouse_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
 }
 
-// Initialize LVGL for Raspberry Pi
-int lvgl_port_init(void)
+// SDL video and window (events are pumped on this thread, the main loop's)
+static int sdl_window_init(void)
 {
-
-	printf("[I] lvgl_port_pi: (logical %dx%d -> physical %dx%d)...\n",
-		LVGL_HOR_RES, LVGL_VER_RES, DISP_HOR_RES, DISP_VER_RES);
-
 	// Initialize SDL
 	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-		printf("Failed to initialize SDL: %s\n", SDL_GetError());
+		LOG_E(TAG, "Failed to initialize SDL: %s", SDL_GetError());
 		return -1;
 	}
 
@@ -202,14 +669,20 @@ int lvgl_port_init(void)
 							  DISP_HOR_RES, DISP_VER_RES,
 							  SDL_WINDOW_SHOWN);
 	if (!window) {
-		printf("Failed to create SDL window: %s\n", SDL_GetError());
+		LOG_E(TAG, "Failed to create SDL window: %s", SDL_GetError());
 		return -1;
 	}
 
+	return 0;
+}
+
+// SDL renderer and textures; created, used and destroyed on the thread that presents
+static int sdl_renderer_init(void)
+{
 	// Create SDL renderer with maximum performance settings
 	renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE);
 	if (!renderer) {
-		printf("Failed to create SDL renderer: %s\n", SDL_GetError());
+		LOG_E(TAG, "Failed to create SDL renderer: %s", SDL_GetError());
 		return -1;
 	}
 
@@ -231,44 +704,435 @@ int lvgl_port_init(void)
 	);
 
 	if (!texture) {
-		printf("Failed to create SDL texture: %s\n", SDL_GetError());
+		LOG_E(TAG, "Failed to create SDL texture: %s", SDL_GetError());
+		return -1;
+	}
+
+	if (rotation == LVGL_PORT_ROTATE_SOFTWARE) {
+
+		landscape = SDL_CreateTexture(
+			renderer, SDL_PIXELFORMAT_RGB565,
+			SDL_TEXTUREACCESS_STREAMING,
+			DISP_HOR_RES, DISP_VER_RES
+		);
+
+		if (landscape) {
+			LOG_I(TAG, "Software rotation (%s)", lvgl_port_rotate_isa());
+		} else {
+			LOG_W(TAG, "No landscape texture (%s), using SDL rotation", SDL_GetError());
+			rotation = LVGL_PORT_ROTATE_SDL;
+		}
+	}
+
+	// Rotated composite; without render-target support every flush rotates the full frame
+	if (rotation == LVGL_PORT_ROTATE_SDL) {
+
+		composite = SDL_CreateTexture(
+			renderer, SDL_PIXELFORMAT_ARGB8888,
+			SDL_TEXTUREACCESS_TARGET,
+			DISP_HOR_RES, DISP_VER_RES
+		);
+
+		if (composite) {
+			SDL_SetTextureBlendMode(composite, SDL_BLENDMODE_NONE);
+		} else {
+			LOG_W(TAG, "No render-target texture (%s), rotating full frames", SDL_GetError());
+		}
+	}
+
+	return 0;
+}
+
+static void sdl_renderer_destroy(void)
+{
+	if (texture_direct && texture) {
+		SDL_UnlockTexture(texture);
+		texture_direct = false;
+	}
+	if (composite) {
+		SDL_DestroyTexture(composite);
+		composite = NULL;
+	}
+	if (landscape) {
+		SDL_DestroyTexture(landscape);
+		landscape = NULL;
+	}
+	if (texture) {
+		SDL_DestroyTexture(texture);
+		texture = NULL;
+	}
+	if (renderer) {
+		SDL_DestroyRenderer(renderer);
+		renderer = NULL;
+	}
+}
+
+/* ===== Presenter thread ===== */
+
+static void *presenter_main(void *arg)
+{
+	(void)arg;
+
+	trace_set_thread_name("presenter");
+	presenter_init_result = sdl_renderer_init();
+	sem_post(&presenter_ready);
+	if (presenter_init_result != 0) {
+		sdl_renderer_destroy();
+		return NULL;
+	}
+
+	while (true) {
+
+		sem_wait(&present_work);
+
+		unsigned tail = atomic_load_explicit(&present_tail, memory_order_relaxed);
+		if (tail == atomic_load_explicit(&present_head, memory_order_acquire)) {
+
+			if (atomic_load(&presenter_stop)) break;
+			continue;
+		}
+
+		present_job_t job = present_queue[tail % PRESENT_QUEUE_SIZE];
+		upload_area(&job.area, job.pixels, job.pitch);
+
+		// The pixels are in the texture: LVGL may render into this buffer again
+		atomic_store(&present_tail, tail + 1);
+		lv_display_flush_ready(disp);
+		if (atomic_exchange(&present_waiting, false)) sem_post(&present_done);
+
+		if (job.last) {
+			TRACE_SCOPE("present");
+			present_frame();
+		}
+	}
+
+	sdl_renderer_destroy();
+	return NULL;
+}
+
+static int presenter_start(void)
+{
+	atomic_store(&present_head, 0);
+	atomic_store(&present_tail, 0);
+	atomic_store(&presenter_stop, false);
+	atomic_store(&present_waiting, false);
+	sem_init(&present_work, 0, 0);
+	sem_init(&present_done, 0, 0);
+	sem_init(&presenter_ready, 0, 0);
+
+	if (pthread_create(&presenter_thread, NULL, presenter_main, NULL) != 0) {
+
+		LOG_E(TAG, "Cannot start presenter thread");
 		return -1;
 	}
 
+	sem_wait(&presenter_ready);
+	if (presenter_init_result != 0) {
+
+		pthread_join(presenter_thread, NULL);
+		return -1;
+	}
+
+	LOG_I(TAG, "Presenting on a separate thread");
+	return 0;
+}
+
+// Drain the queue, then let the presenter tear down its renderer and exit
+static void presenter_stop_and_join(void)
+{
+	atomic_store(&presenter_stop, true);
+	sem_post(&present_work);
+	pthread_join(presenter_thread, NULL);
+
+	sem_destroy(&present_work);
+	sem_destroy(&present_done);
+	sem_destroy(&presenter_ready);
+}
+
+/* ===== Event loop ===== */
+
+static void watch_fd(int fd, uint32_t tag)
+{
+	struct epoll_event event = { .events = EPOLLIN, .data.u32 = tag };
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+
+		LOG_W(TAG, "epoll_ctl failed for wake source %u", tag);
+	}
+}
+
+static void event_loop_init(void)
+{
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	data_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (epoll_fd < 0 || data_event_fd < 0 || timer_fd < 0) {
+
+		// Without epoll the loop sleeps between timers and touch waits for the next input tick
+		LOG_W(TAG, "No epoll/eventfd/timerfd, sleeping between timers");
+		return;
+	}
+
+	touch_wake_fd = open(TOUCH_DEVICE, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (touch_wake_fd >= 0) {
+
+		watch_fd(touch_wake_fd, WAKE_TOUCH);
+	} else {
+
+		LOG_W(TAG, "Cannot watch %s, touch won't wake the loop early", TOUCH_DEVICE);
+	}
+	watch_fd(data_event_fd, WAKE_DATA);
+	watch_fd(timer_fd, WAKE_TIMER);
+}
+
+static void event_loop_deinit(void)
+{
+	int *fds[] = { &touch_wake_fd, &data_event_fd, &timer_fd, &epoll_fd };
+	for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+
+		if (*fds[i] >= 0) {
+
+			close(*fds[i]);
+			*fds[i] = -1;
+		}
+	}
+}
+
+// Initialize LVGL for Raspberry Pi
+int lvgl_port_init(void)
+{
+	trace_init();
+	trace_set_thread_name("ui");
+
+	LOG_I(TAG, "(logical %dx%d -> physical %dx%d)...",
+		LVGL_HOR_RES, LVGL_VER_RES, DISP_HOR_RES, DISP_VER_RES);
+
+	if (output == OUTPUT_FBDEV) {
+
+		// Areas are rotated on the CPU straight into the mapping
+		if (!lvgl_port_fbdev_open(&fbdev, output_target, DISP_HOR_RES, DISP_VER_RES, LVGL_HOR_RES, LVGL_VER_RES)) {
+			return -1;
+		}
+	} else if (output == OUTPUT_HEADLESS) {
+
+		if (!lvgl_port_headless_open(&headless, LVGL_HOR_RES, LVGL_VER_RES)) {
+			return -1;
+		}
+	} else {
+
+		if (sdl_window_init() != 0) {
+			return -1;
+		}
+
+		// The zero-copy texture strategy renders into the locked texture itself, so its
+		// buffer can't be handed back before present: it keeps presenting inline
+		presenter_active = present_threaded && buffer_config.mode != LVGL_PORT_BUFFER_TEXTURE;
+		if (presenter_active ? presenter_start() != 0 : sdl_renderer_init() != 0) {
+
+			presenter_active = false;
+			return -1;
+		}
+	}
+
 	// Initialize LVGL
 	lv_init();
 
 	// Create display
 	disp = lv_display_create(LVGL_HOR_RES, LVGL_VER_RES);
 	lv_display_set_flush_cb(disp, disp_flush);
-	lv_display_set_buffers(disp, buf_1, buf_2, sizeof(buf_1), LV_DISPLAY_RENDER_MODE_FULL);
-	lv_display_set_default(disp);
+	lv_display_add_event_cb(disp, disp_refr_event_cb, LV_EVENT_REFR_START, NULL);
+	lv_display_add_event_cb(disp, disp_refr_event_cb, LV_EVENT_RENDER_START, NULL);
+	lv_display_add_event_cb(disp, disp_refr_event_cb, LV_EVENT_REFR_READY, NULL);
+	if (presenter_active) {
+		lv_display_set_flush_wait_cb(disp, present_flush_wait);
+	}
+	if (buffer_config.mode == LVGL_PORT_BUFFER_TEXTURE && (output != OUTPUT_SDL || rotation == LVGL_PORT_ROTATE_SOFTWARE)) {
 
-	lv_indev_t *touch = lv_evdev_create(LV_INDEV_TYPE_POINTER, "/dev/input/event7");
-	if (touch == NULL) {
-		printf("ERROR: Failed to create evdev input device\n");
+		// LVGL would render portrait pixels into a texture nobody shows
+		LOG_W(TAG, "Texture strategy needs SDL output and rotation, using partial buffers");
+		buffer_config = lvgl_port_buffer_config_default();
+	}
+
+	if (buffer_config.mode == LVGL_PORT_BUFFER_TEXTURE) {
+
+		texture_direct = texture_direct_init();
+		if (!texture_direct) {
+
+			LOG_W(TAG, "Zero-copy texture rendering unavailable, using partial buffers");
+			buffer_config = lvgl_port_buffer_config_default();
+		}
+	}
+
+	if (!texture_direct && !lvgl_port_buffers_create(disp, &buffer_config, &buffers)) {
 		return -1;
 	}
+	lv_display_set_default(disp);
 
-	lv_indev_set_display(touch, disp);
+	lv_indev_t *touch = (output == OUTPUT_HEADLESS) ? NULL : lv_evdev_create(LV_INDEV_TYPE_POINTER, TOUCH_DEVICE);
+	if (touch) {
 
-	// Touchscreen is 800x480 in landscape; display is 480x800 portrait.
-	// Swap axes and calibrate raw range to display coordinates.
-	lv_evdev_set_swap_axes(touch, true);
-	// After swapping axes: X comes from raw Y (0..479), Y comes from raw X (0..799)
-	// Invert Y to map top-left to (0,0)
-	lv_evdev_set_calibration(touch, 0, 799, 479, 0);
+		lv_indev_set_display(touch, disp);
+
+		// Touchscreen is 800x480 in landscape; display is 480x800 portrait.
+		// Swap axes and calibrate raw range to display coordinates.
+		lv_evdev_set_swap_axes(touch, true);
+		// After swapping axes: X comes from raw Y (0..479), Y comes from raw X (0..799)
+		// Invert Y to map top-left to (0,0)
+		lv_evdev_set_calibration(touch, 0, 799, 479, 0);
+	} else {
+
+		if (output != OUTPUT_HEADLESS) {
+			LOG_W(TAG, "No touchscreen at %s, using a virtual pointer", TOUCH_DEVICE);
+		}
+
+		touch = lv_indev_create();
+		lv_indev_set_type(touch, LV_INDEV_TYPE_POINTER);
+		lv_indev_set_read_cb(touch, indev_read);
+		lv_indev_set_display(touch, disp);
+		pointer_virtual = true;
+	}
 
 	indev = touch;
 
 	lv_indev_enable(indev, true);
+
+	// Governor: pace LVGL's own refresh and input timers
+	if (!governor_config_custom) governor_config = lvgl_port_governor_config_default();
+	governor_config.active_period_ms = LV_DEF_REFR_PERIOD;
+	lvgl_port_governor_init(&governor, &governor_config, port_get_ticks());
+	lvgl_port_pace_timer(lv_display_get_refr_timer(disp), LV_DEF_REFR_PERIOD);
+	lvgl_port_pace_timer(lv_indev_get_read_timer(indev), LV_DEF_REFR_PERIOD);
+
+	// Headless never waits: real-time runs flat out, simulated time steps per iteration
+	if (output != OUTPUT_HEADLESS) {
+		event_loop_init();
+	}
 	return 0;
 }
 
-// Main render loop
-void lvgl_port_main_loop(void)
+/* ===== Frame governor ===== */
+
+// Run a timer at the governor's period (never faster than its own base period)
+void lvgl_port_pace_timer(lv_timer_t *timer, uint32_t base_period_ms)
+{
+	if (!timer || paced_timer_count >= PACED_TIMERS_MAX) return;
+
+	paced_timers[paced_timer_count].timer = timer;
+	paced_timers[paced_timer_count].base_period_ms = base_period_ms;
+	paced_timer_count++;
+
+	uint32_t period = paced_period_ms > base_period_ms ? paced_period_ms : base_period_ms;
+	lv_timer_set_period(timer, period);
+}
+
+static void apply_pace(uint32_t period_ms)
+{
+	if (period_ms == paced_period_ms) return;
+
+	paced_period_ms = period_ms;
+	for (int i = 0; i < paced_timer_count; i++) {
+
+		uint32_t base = paced_timers[i].base_period_ms;
+		lv_timer_set_period(paced_timers[i].timer, period_ms > base ? period_ms : base);
+	}
+}
+
+// Touch: back to full rate and read the touchscreen now rather than at the next input tick
+static void wake_on_touch(void)
+{
+	char events[256];
+	while (read(touch_wake_fd, events, sizeof(events)) > 0) {
+		// Drain; LVGL reads the events through its own handle
+	}
+
+	uint32_t now = port_get_ticks();
+	lvgl_port_governor_note_touch(&governor, now);
+
+	lv_lock();
+	apply_pace(lvgl_port_governor_update(&governor, now, false));
+	lv_timer_ready(lv_indev_get_read_timer(indev));
+	lv_unlock();
+}
+
+// New values from the producer: run the data timer now instead of at its next tick, unless
+// the governor is deliberately running slow
+static void wake_on_data(void)
+{
+	uint64_t count;
+	if (read(data_event_fd, &count, sizeof(count)) < 0) return;
+
+	if (data_timer && paced_period_ms <= governor_config.active_period_ms) {
+
+		lv_lock();
+		lv_timer_ready(data_timer);
+		lv_unlock();
+	}
+}
+
+// Block until the next LVGL timer is due, the touchscreen has events or the producer signals
+static void wait_for_work(uint32_t timeout_ms)
+{
+	// LV_NO_TIMER_READY or a long one-shot: still come back at the paced rate (SDL keys, signals)
+	if (timeout_ms > paced_period_ms) timeout_ms = paced_period_ms;
+	if (timeout_ms == 0) return;
+
+	if (epoll_fd < 0) {
+
+		struct timespec pause = { timeout_ms / 1000, (long)(timeout_ms % 1000) * 1000000L };
+		nanosleep(&pause, NULL);
+		return;
+	}
+
+	struct itimerspec deadline = {
+		.it_value = { timeout_ms / 1000, (long)(timeout_ms % 1000) * 1000000L },
+	};
+	timerfd_settime(timer_fd, 0, &deadline, NULL);
+
+	struct epoll_event events[3];
+	int count = epoll_wait(epoll_fd, events, 3, -1);
+	for (int i = 0; i < count; i++) {
+
+		switch (events[i].data.u32) {
+			case WAKE_TOUCH:
+				wake_on_touch();
+				break;
+			case WAKE_DATA:
+				wake_on_data();
+				break;
+			case WAKE_TIMER: {
+				uint64_t expirations;
+				if (read(timer_fd, &expirations, sizeof(expirations)) < 0) {
+					// Re-armed before the next wait either way
+				}
+				break;
+			}
+		}
+	}
+}
+
+// Any thread: new data is in the state objects (coalesces until the loop wakes)
+void lvgl_port_notify_data(void)
+{
+	if (data_event_fd < 0) return;
+
+	uint64_t one = 1;
+	if (write(data_event_fd, &one, sizeof(one)) < 0) {
+		// Counter saturated: the loop is already due to wake
+	}
+}
+
+// Timer to run as soon as the data producer signals (e.g. the UI update timer)
+void lvgl_port_set_data_timer(lv_timer_t *timer)
+{
+	data_timer = timer;
+}
+
+// First iteration: signal handlers and the FPS HUD
+static uint32_t loop_start;
+static bool loop_started = false;
+
+static void main_loop_start(void)
 {
-	printf("Starting main loop...\n");
+	LOG_I(TAG, "Starting main loop...");
 
 	// Register signal handlers for graceful shutdown
 	signal(SIGINT, signal_handler);   // Ctrl+C
@@ -282,79 +1146,300 @@ void lvgl_port_main_loop(void)
 	// Create FPS calculation timer (runs every 10ms for maximum responsiveness)
 	lv_timer_t *fps_timer = lv_timer_create(fps_timer_cb, 10, NULL);
 	lv_timer_set_repeat_count(fps_timer, -1);
+	lvgl_port_pace_timer(fps_timer, 10);
 
 	// Force an initial FPS calculation after 1 second
 	lv_timer_t *initial_fps_timer = lv_timer_create(initial_fps_callback, 1000, NULL);
 
-	// Create FPS label on screen
-	create_fps_label();
+	// Create the profiler overlay on screen
+	lvgl_port_overlay_create(lv_scr_act());
+	if (show_fps) {
+		lvgl_port_profile_set_enabled(true);
+	}
+
+	LOG_I(TAG, "Profiler overlay enabled! Press 'F' to toggle it, 'ESC' to exit");
 
-	printf("FPS HUD enabled! Press 'F' to toggle FPS display, 'ESC' to exit\n");
+	loop_start = port_get_ticks();
+	loop_started = true;
+}
+
+// One main loop iteration: events, LVGL timers and rendering, then (with the governor)
+// the wait for the next piece of work. Returns false once the loop should end.
+bool lvgl_port_step(void)
+{
+	if (!loop_started) {
+		main_loop_start();
+	}
+	if (!running) return false;
 
-	while (running) {
+	time_source_advance(headless_step_ms);
 
-		// Calculate elapsed ms since last iteration
-		uint32_t now = SDL_GetTicks();
-		uint32_t elapsed = now - last_tick;
-		last_tick = now;
+	// Calculate elapsed ms since last iteration
+	uint32_t now = port_get_ticks();
+	uint32_t elapsed = now - last_tick;
+	last_tick = now;
 
-		// Handle SDL events (including keyboard input)
-		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
-			switch (event.type) {
-				case SDL_QUIT:
-					printf("SDL_QUIT event received\n");
+	if (run_limit_ms && now - loop_start >= run_limit_ms) {
+
+		LOG_I(TAG, "Run limit of %u ms reached", run_limit_ms);
+		running = false;
+		return false;
+	}
+
+	trace_frame_begin();
+	lvgl_port_profile_frame_begin();
+	lvgl_port_phase_mark_t mark = lvgl_port_profile_mark();
+
+	// Everything below touches LVGL objects; lv_timer_handler takes the lock itself
+	lv_lock();
+
+	// Handle SDL events (including keyboard input)
+	SDL_Event event;
+	while (output == OUTPUT_SDL && SDL_PollEvent(&event)) {
+		switch (event.type) {
+			case SDL_QUIT:
+				LOG_I(TAG, "SDL_QUIT event received");
+				running = false;
+				break;
+			case SDL_MOUSEMOTION:
+			case SDL_MOUSEBUTTONDOWN:
+			case SDL_MOUSEBUTTONUP:
+				if (pointer_virtual) {
+
+					// Window is the landscape panel: landscape (X, Y) is portrait (Y, 799 - X)
+					int32_t x = event.type == SDL_MOUSEMOTION ? event.motion.x : event.button.x;
+					int32_t y = event.type == SDL_MOUSEMOTION ? event.motion.y : event.button.y;
+					bool pressed = event.type == SDL_MOUSEMOTION ? (event.motion.state & SDL_BUTTON_LMASK) != 0
+						: event.type == SDL_MOUSEBUTTONDOWN;
+					lvgl_port_set_pointer(y, DISP_HOR_RES - 1 - x, pressed);
+				}
+				break;
+			case SDL_RENDER_TARGETS_RESET:
+			case SDL_RENDER_DEVICE_RESET:
+				// Composite contents lost: rebuild it from the portrait texture
+				atomic_store(&composite_full_damage, true);
+				break;
+			case SDL_KEYDOWN:
+				if (event.key.keysym.sym == SDLK_ESCAPE) {
+					LOG_I(TAG, "Escape key pressed, exiting...");
 					running = false;
-					break;
-				case SDL_KEYDOWN:
-					if (event.key.keysym.sym == SDLK_ESCAPE) {
-						printf("Escape key pressed, exiting...\n");
-						running = false;
-					} else if (event.key.keysym.sym == SDLK_f) {
-						// Toggle FPS display with 'F' key
-						show_fps = !show_fps;
-						if (fps_label) {
-							if (show_fps) {
-								lv_obj_clear_flag(fps_label, LV_OBJ_FLAG_HIDDEN);
-							} else {
-								lv_obj_add_flag(fps_label, LV_OBJ_FLAG_HIDDEN);
-							}
-						}
-						printf("\nFPS display %s\n", show_fps ? "enabled" : "disabled");
-					}
-					break;
-			}
+				} else if (event.key.keysym.sym == SDLK_f) {
+					// Toggle the profiler overlay with 'F' key
+					lvgl_port_set_fps_visible(!show_fps);
+					LOG_I(TAG, "Profiler overlay %s", show_fps ? "enabled" : "disabled");
+				} else if (event.key.keysym.sym == SDLK_t) {
+					// Dump the trace rings with 'T' key (tracing builds only)
+					trace_request_dump();
+				}
+				break;
 		}
+	}
+
+	// Increment LVGL tick by the actual time elapsed
+	lv_tick_inc(elapsed);
 
-		// Increment LVGL tick by the actual time elapsed
-		lv_tick_inc(elapsed);
+	if (texture_rebind_pending) {
+		texture_direct_rebind();
+	}
+	lv_unlock();
+	lvgl_port_profile_add(LVGL_PORT_PHASE_EVENTS, mark);
 
-		// Handle LVGL tasks
-		lv_timer_handler();
+	// Handle LVGL tasks
+	mark = lvgl_port_profile_mark();
+	uint32_t until_next_timer = lv_timer_handler();
+	lvgl_port_profile_handler_span(mark);
+
+	// Update FPS display on screen
+	lv_lock();
+	update_fps_display();
+	lv_unlock();
+
+	lvgl_port_profile_frame_end();
+	trace_frame_end();
+
+	// Headless never sleeps; neither does the loop without a governor
+	if (!governor_enabled || output == OUTPUT_HEADLESS) return running;
+
+	lv_lock();
+	apply_pace(lvgl_port_governor_update(&governor, port_get_ticks(), lv_anim_count_running() > 0));
+	lv_unlock();
+
+	wait_for_work(until_next_timer);
+	return running;
+}
 
-		// Update FPS display on screen
-		update_fps_display();
+// Main render loop
+void lvgl_port_main_loop(void)
+{
+	while (lvgl_port_step()) {
 	}
 
-	printf("Main loop exiting gracefully...\n");
+	LOG_I(TAG, "Main loop exiting gracefully...");
 }
 
 // Deinitialize LVGL
 void lvgl_port_deinit(void)
 {
-	if (texture) {
-		SDL_DestroyTexture(texture);
-		texture = NULL;
+	event_loop_deinit();
+	lvgl_port_governor_deinit(&governor);
+
+	if (output == OUTPUT_FBDEV) {
+
+		lvgl_port_fbdev_close(&fbdev);
+		lvgl_port_buffers_destroy(&buffers);
+		return;
 	}
-	if (renderer) {
-		SDL_DestroyRenderer(renderer);
-		renderer = NULL;
+
+	if (output == OUTPUT_HEADLESS) {
+
+		lvgl_port_headless_close(&headless);
+		lvgl_port_buffers_destroy(&buffers);
+		return;
+	}
+
+	if (presenter_active) {
+
+		presenter_stop_and_join();
+		presenter_active = false;
+	} else {
+
+		sdl_renderer_destroy();
 	}
 	if (window) {
 		SDL_DestroyWindow(window);
 		window = NULL;
 	}
 	SDL_Quit();
+
+	lvgl_port_buffers_destroy(&buffers);
+}
+
+// Choose the output backend (must be called before lvgl_port_init)
+bool lvgl_port_set_output(const char *spec)
+{
+	if (!spec) return false;
+
+	if (strcmp(spec, "sdl") == 0) {
+
+		output = OUTPUT_SDL;
+		return true;
+	}
+
+	// "headless" (real time, flat out) or "headless:<ms>" (simulated clock, ms per iteration)
+	if (strncmp(spec, "headless", 8) == 0) {
+
+		uint32_t step = 0;
+		if (spec[8] == ':') {
+
+			char *end;
+			long value = strtol(spec + 9, &end, 10);
+			if (end == spec + 9 || *end != '\0' || value <= 0 || value > 60000) return false;
+			step = (uint32_t)value;
+		} else if (spec[8] != '\0') {
+			return false;
+		}
+
+		headless_step_ms = step;
+		if (step) time_source_set_virtual(TIME_SOURCE_VIRTUAL_EPOCH);
+		output = OUTPUT_HEADLESS;
+		return true;
+	}
+
+	const char *target = NULL;
+	if (strcmp(spec, "fbdev") == 0) {
+
+		target = "/dev/fb0";
+	} else if (strncmp(spec, "fbdev:", 6) == 0 && spec[6] != '\0') {
+
+		target = spec + 6;
+	} else if ((strncmp(spec, "file:", 5) == 0 && spec[5] != '\0') || strcmp(spec, "memfd") == 0) {
+
+		target = spec;
+	}
+
+	if (!target || strlen(target) >= sizeof(output_target)) return false;
+
+	snprintf(output_target, sizeof(output_target), "%s", target);
+	output = OUTPUT_FBDEV;
+	return true;
+}
+
+// Virtual pointer position (LVGL coordinates) and button; LVGL context
+void lvgl_port_set_pointer(int32_t x, int32_t y, bool pressed)
+{
+	mouse_x = x;
+	mouse_y = y;
+	mouse_pressed = pressed;
+}
+
+// Show or hide the profiler overlay (the 'F' key toggles it); the frame profile only runs
+// while it is shown. LVGL context
+void lvgl_port_set_fps_visible(bool visible)
+{
+	show_fps = visible;
+	lvgl_port_overlay_set_visible(visible);
+	lvgl_port_profile_set_enabled(visible);
+}
+
+// Leave the main loop after this many milliseconds of port time (simulated when headless
+// runs on a simulated clock); 0 = no limit
+void lvgl_port_set_run_limit(uint32_t limit_ms)
+{
+	run_limit_ms = limit_ms;
+}
+
+// Write the headless frame as a PPM image (headless output only)
+bool lvgl_port_save_screenshot(const char *path)
+{
+	if (output != OUTPUT_HEADLESS) {
+
+		LOG_W(TAG, "Screenshots need headless output");
+		return false;
+	}
+
+	return lvgl_port_headless_save_ppm(&headless, path);
+}
+
+// Choose who rotates portrait frames onto the landscape panel (must be called before lvgl_port_init)
+void lvgl_port_set_rotation(lvgl_port_rotation_t mode)
+{
+	rotation = mode;
+}
+
+// Present from a separate thread (default) or inline in the flush callback (must be called
+// before lvgl_port_init; ignored for fbdev output and the texture strategy)
+void lvgl_port_set_present_threaded(bool threaded)
+{
+	present_threaded = threaded;
+}
+
+// Turn the frame governor off (spin at full rate, as before) or on (default)
+void lvgl_port_set_governor_enabled(bool enabled)
+{
+	governor_enabled = enabled;
+}
+
+// Thermal zone the governor watches: "off", "<path>" or "<path>,<hot °C>" (before lvgl_port_init)
+bool lvgl_port_set_thermal(const char *spec)
+{
+	lvgl_port_governor_config_t config = governor_config_custom ? governor_config : lvgl_port_governor_config_default();
+	if (!lvgl_port_governor_config_parse_thermal(spec, &config)) return false;
+
+	governor_config = config;
+	governor_config_custom = true;
+	return true;
+}
+
+// Ignition state for the governor (LVGL context, e.g. the UI timer)
+void lvgl_port_set_ignition(bool ignition_on)
+{
+	lvgl_port_governor_set_ignition(&governor, ignition_on);
+}
+
+// Choose the draw buffer strategy (must be called before lvgl_port_init)
+void lvgl_port_set_buffer_config(const lvgl_port_buffer_config_t *config)
+{
+	if (config) buffer_config = *config;
 }
 
 // Get display dimensions
@@ -377,6 +1462,19 @@ lv_display_t* lvgl_port_get_display(void)
 	return disp;
 }
 
+bool lvgl_port_lock(uint32_t timeout_ms)
+{
+	(void)timeout_ms;
+
+	lv_lock();
+	return true;
+}
+
+void lvgl_port_unlock(void)
+{
+	lv_unlock();
+}
+
 // Force all screens to use the correct dimensions
 void lvgl_port_force_screen_dimensions(lv_obj_t *screen)
 {
@@ -11,11 +11,62 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <lvgl.h>
+#include "lvgl_port_buffers.h"
+#include "lvgl_port_rotate.h"
+#include "lvgl_port_governor.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Choose the draw buffer strategy (full / direct / partial stripes); call before lvgl_port_init
+void lvgl_port_set_buffer_config(const lvgl_port_buffer_config_t *config);
+
+// Choose the output backend; call before lvgl_port_init. "sdl" (default), "fbdev" (/dev/fb0),
+// "fbdev:<device>", "file:<path>" / "memfd" (framebuffer stand-ins for tests and benchmarks),
+// or "headless" / "headless:<ms>" (offscreen frame, virtual pointer; flat out in real time or
+// on the virtual time source advanced <ms>, up to 60000, per loop iteration). Returns false on
+// a bad spec.
+bool lvgl_port_set_output(const char *spec);
+
+// Virtual pointer (headless output, or no touchscreen): position in LVGL coordinates
+void lvgl_port_set_pointer(int32_t x, int32_t y, bool pressed);
+
+// Leave lvgl_port_main_loop after limit_ms of port time (0 = run until quit)
+void lvgl_port_set_run_limit(uint32_t limit_ms);
+
+// Show or hide the profiler overlay (FPS, redrawn area, per-phase frame times)
+void lvgl_port_set_fps_visible(bool visible);
+
+// Save the headless frame as a PPM image
+bool lvgl_port_save_screenshot(const char *path);
+
+// Choose SDL or software (CPU) 90° rotation; call before lvgl_port_init
+void lvgl_port_set_rotation(lvgl_port_rotation_t rotation);
+
+// Present SDL frames from a separate thread (default) so LVGL renders the next frame meanwhile,
+// or inline in the flush callback; call before lvgl_port_init
+void lvgl_port_set_present_threaded(bool threaded);
+
+// Frame governor (default on): slower LVGL timers when the screen is static, the ignition is
+// off or the thermal zone reads hot, and sleeping between timers; off spins at full rate
+void lvgl_port_set_governor_enabled(bool enabled);
+
+// Governor thermal input: "off", "<sysfs temp path>" or "<path>,<hot °C>"; call before lvgl_port_init
+bool lvgl_port_set_thermal(const char *spec);
+
+// Ignition state for the governor; call from LVGL context (e.g. the UI timer)
+void lvgl_port_set_ignition(bool ignition_on);
+
+// Let the governor pace an app timer: it runs at base_period_ms while active, slower otherwise
+void lvgl_port_pace_timer(lv_timer_t *timer, uint32_t base_period_ms);
+
+// Data producer (any thread): new values are in the state objects; wakes the UI loop
+void lvgl_port_notify_data(void);
+
+// Timer the UI loop runs as soon as the producer notifies (at full rate only)
+void lvgl_port_set_data_timer(lv_timer_t *timer);
+
 // Initialize LVGL for Raspberry Pi
 int lvgl_port_init(void);
 
@@ -28,6 +79,9 @@ void lvgl_port_render_loop(void);
 // Main event loop to keep window alive and handle events
 void lvgl_port_main_loop(void);
 
+// One iteration of the main loop (for drivers such as the benchmark); false once it should end
+bool lvgl_port_step(void);
+
 // Get display dimensions
 void lvgl_port_get_display_size(uint32_t *width, uint32_t *height);
 
@@ -40,7 +94,9 @@ lv_display_t* lvgl_port_get_display(void);
 // Force all screens to use the correct dimensions
 void lvgl_port_force_screen_dimensions(lv_obj_t *screen);
 
-// Thread synchronization functions
+// Thread synchronization: LVGL's global lock (LV_OS_PTHREAD, recursive). lv_timer_handler
+// holds it while timers run, so code on other threads takes it before touching LVGL objects
+// or state the UI timers read. timeout_ms is kept for the ESP port's signature; this blocks.
 bool lvgl_port_lock(uint32_t timeout_ms);
 void lvgl_port_unlock(void);
 
@@ -0,0 +1,187 @@
+#include "lvgl_port_profile.h"
+
+#include <string.h>
+#include <time.h>
+
+// Real time even on the virtual clock: this measures the machine, not the simulation
+static uint64_t clock_us(clockid_t clock)
+{
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static bool enabled = false;
+static bool measure_cpu = false;
+static lvgl_port_profile_cb_t frame_cb = NULL;
+static void *frame_cb_data = NULL;
+
+// Current frame, accumulated in microseconds
+static lvgl_port_phase_mark_t frame_start;
+static uint64_t phase_wall[LVGL_PORT_PHASE_COUNT];
+static uint64_t phase_cpu[LVGL_PORT_PHASE_COUNT];
+static uint64_t handler_wall;
+static uint64_t handler_cpu;
+static bool frame_rendered;
+
+// LVGL refresh: REFR_START -> RENDER_START is layout, RENDER_START -> REFR_READY is drawing
+static lvgl_port_phase_mark_t refr_mark;
+static bool refr_rendering;
+
+// Finished frames
+static lvgl_port_frame_profile_t ring[LVGL_PORT_PROFILE_RING];
+static int ring_head = 0;
+static int ring_count = 0;
+
+void lvgl_port_profile_set_enabled(bool enable)
+{
+	enabled = enable;
+	ring_count = 0;
+}
+
+bool lvgl_port_profile_is_enabled(void)
+{
+	return enabled;
+}
+
+void lvgl_port_profile_set_cpu(bool measure)
+{
+	measure_cpu = measure;
+}
+
+void lvgl_port_profile_set_frame_cb(lvgl_port_profile_cb_t cb, void *user_data)
+{
+	frame_cb = cb;
+	frame_cb_data = user_data;
+}
+
+lvgl_port_phase_mark_t lvgl_port_profile_mark(void)
+{
+	lvgl_port_phase_mark_t mark = { 0, 0 };
+	if (!enabled) return mark;
+
+	mark.wall_us = clock_us(CLOCK_MONOTONIC);
+	if (measure_cpu) mark.cpu_us = clock_us(CLOCK_PROCESS_CPUTIME_ID);
+	return mark;
+}
+
+void lvgl_port_profile_add(lvgl_port_phase_t phase, lvgl_port_phase_mark_t start)
+{
+	// Enabled mid-phase: the mark is empty, skip it
+	if (!enabled || start.wall_us == 0) return;
+
+	lvgl_port_phase_mark_t now = lvgl_port_profile_mark();
+	phase_wall[phase] += now.wall_us - start.wall_us;
+	phase_cpu[phase] += now.cpu_us - start.cpu_us;
+}
+
+void lvgl_port_profile_frame_begin(void)
+{
+	memset(phase_wall, 0, sizeof(phase_wall));
+	memset(phase_cpu, 0, sizeof(phase_cpu));
+	handler_wall = 0;
+	handler_cpu = 0;
+	frame_rendered = false;
+	frame_start = lvgl_port_profile_mark();
+}
+
+void lvgl_port_profile_handler_span(lvgl_port_phase_mark_t start)
+{
+	if (!enabled || start.wall_us == 0) return;
+
+	lvgl_port_phase_mark_t now = lvgl_port_profile_mark();
+	handler_wall += now.wall_us - start.wall_us;
+	handler_cpu += now.cpu_us - start.cpu_us;
+}
+
+void lvgl_port_profile_refr_start(void)
+{
+	refr_mark = lvgl_port_profile_mark();
+	refr_rendering = false;
+}
+
+void lvgl_port_profile_render_start(void)
+{
+	lvgl_port_profile_add(LVGL_PORT_PHASE_LAYOUT, refr_mark);
+	refr_mark = lvgl_port_profile_mark();
+	refr_rendering = true;
+	frame_rendered = true;
+}
+
+void lvgl_port_profile_refr_ready(void)
+{
+	// Nothing invalid: the whole refresh was layout
+	lvgl_port_profile_add(refr_rendering ? LVGL_PORT_PHASE_DRAW : LVGL_PORT_PHASE_LAYOUT, refr_mark);
+	refr_rendering = false;
+}
+
+static uint64_t sub_clamped(uint64_t a, uint64_t b)
+{
+	return a > b ? a - b : 0;
+}
+
+void lvgl_port_profile_frame_end(void)
+{
+	if (!enabled || frame_start.wall_us == 0) return;
+
+	lvgl_port_phase_mark_t now = lvgl_port_profile_mark();
+
+	// The render events bracket the flushes too
+	phase_wall[LVGL_PORT_PHASE_DRAW] = sub_clamped(phase_wall[LVGL_PORT_PHASE_DRAW], phase_wall[LVGL_PORT_PHASE_FLUSH]);
+	phase_cpu[LVGL_PORT_PHASE_DRAW] = sub_clamped(phase_cpu[LVGL_PORT_PHASE_DRAW], phase_cpu[LVGL_PORT_PHASE_FLUSH]);
+
+	// Everything but EVENTS ran inside lv_timer_handler
+	uint64_t inside_wall = 0;
+	uint64_t inside_cpu = 0;
+	for (int i = LVGL_PORT_PHASE_DATA; i < LVGL_PORT_PHASE_OTHER; i++) {
+
+		inside_wall += phase_wall[i];
+		inside_cpu += phase_cpu[i];
+	}
+	phase_wall[LVGL_PORT_PHASE_OTHER] = sub_clamped(handler_wall, inside_wall);
+	phase_cpu[LVGL_PORT_PHASE_OTHER] = sub_clamped(handler_cpu, inside_cpu);
+
+	lvgl_port_frame_profile_t *frame = &ring[ring_head];
+	frame->wall_us = (uint32_t)(now.wall_us - frame_start.wall_us);
+	frame->cpu_us = (uint32_t)(now.cpu_us - frame_start.cpu_us);
+	for (int i = 0; i < LVGL_PORT_PHASE_COUNT; i++) {
+
+		frame->phase_wall_us[i] = (uint32_t)phase_wall[i];
+		frame->phase_cpu_us[i] = (uint32_t)phase_cpu[i];
+	}
+	frame->rendered = frame_rendered;
+
+	ring_head = (ring_head + 1) % LVGL_PORT_PROFILE_RING;
+	if (ring_count < LVGL_PORT_PROFILE_RING) ring_count++;
+
+	if (frame_cb) frame_cb(frame, frame_cb_data);
+}
+
+int lvgl_port_profile_frame_count(void)
+{
+	return ring_count;
+}
+
+const lvgl_port_frame_profile_t *lvgl_port_profile_frame(int age)
+{
+	if (age < 0 || age >= ring_count) return NULL;
+
+	return &ring[(ring_head - 1 - age + LVGL_PORT_PROFILE_RING) % LVGL_PORT_PROFILE_RING];
+}
+
+const char *lvgl_port_profile_phase_name(lvgl_port_phase_t phase)
+{
+	switch (phase) {
+		case LVGL_PORT_PHASE_EVENTS:  return "events";
+		case LVGL_PORT_PHASE_DATA:    return "data";
+		case LVGL_PORT_PHASE_STORE:   return "store";
+		case LVGL_PORT_PHASE_MODULES: return "modules";
+		case LVGL_PORT_PHASE_SCREENS: return "screens";
+		case LVGL_PORT_PHASE_LAYOUT:  return "layout";
+		case LVGL_PORT_PHASE_DRAW:    return "draw";
+		case LVGL_PORT_PHASE_FLUSH:   return "flush";
+		case LVGL_PORT_PHASE_OTHER:   return "other";
+		case LVGL_PORT_PHASE_COUNT:   break;
+	}
+	return "?";
+}
@@ -0,0 +1,85 @@
+/*
+ * Per-phase frame profile for the Pi display port
+ *
+ * Splits every main loop iteration into the phases below and measures their wall
+ * time (CLOCK_MONOTONIC, a vDSO read) and optionally process CPU time (which
+ * includes the draw unit threads, but costs a syscall per mark). The port marks
+ * the phases it owns and LVGL's refresh / render events; the app marks the UI
+ * timer's steps and, on the virtual clock, the data producer. The last
+ * LVGL_PORT_PROFILE_RING frames are kept for the overlay. Off until enabled.
+ * UI thread only.
+ */
+
+#ifndef LVGL_PORT_PROFILE_H
+#define LVGL_PORT_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LVGL_PORT_PROFILE_RING 120
+
+typedef enum {
+	LVGL_PORT_PHASE_EVENTS = 0,     // SDL events, input wake-ups, tick
+	LVGL_PORT_PHASE_DATA,           // Data producer, when it runs as an LVGL timer
+	LVGL_PORT_PHASE_STORE,          // app_data_store_update
+	LVGL_PORT_PHASE_MODULES,        // display_modules_update_all
+	LVGL_PORT_PHASE_SCREENS,        // screen_manager_update
+	LVGL_PORT_PHASE_LAYOUT,         // LVGL refresh up to rendering: layout, invalid area merge
+	LVGL_PORT_PHASE_DRAW,           // LVGL rendering without the flushes: rasterization
+	LVGL_PORT_PHASE_FLUSH,          // Copy / rotate / upload / present of rendered areas
+	LVGL_PORT_PHASE_OTHER,          // Rest of lv_timer_handler: input read, animations, other timers
+	LVGL_PORT_PHASE_COUNT
+} lvgl_port_phase_t;
+
+typedef struct {
+	uint64_t wall_us;
+	uint64_t cpu_us;
+} lvgl_port_phase_mark_t;
+
+typedef struct {
+	uint32_t wall_us;                               // Whole iteration, excluding the idle wait
+	uint32_t cpu_us;                                // 0 unless CPU time is measured
+	uint32_t phase_wall_us[LVGL_PORT_PHASE_COUNT];
+	uint32_t phase_cpu_us[LVGL_PORT_PHASE_COUNT];
+	bool rendered;                                  // LVGL refreshed the display in this iteration
+} lvgl_port_frame_profile_t;
+
+typedef void (*lvgl_port_profile_cb_t)(const lvgl_port_frame_profile_t *frame, void *user_data);
+
+void lvgl_port_profile_set_enabled(bool enabled);
+bool lvgl_port_profile_is_enabled(void);
+
+// Also measure process CPU time per phase (benchmarks; a syscall per mark)
+void lvgl_port_profile_set_cpu(bool measure_cpu);
+
+// Called with every finished frame while enabled
+void lvgl_port_profile_set_frame_cb(lvgl_port_profile_cb_t cb, void *user_data);
+
+// Start of a phase; pass the mark to lvgl_port_profile_add when it ends
+lvgl_port_phase_mark_t lvgl_port_profile_mark(void);
+void lvgl_port_profile_add(lvgl_port_phase_t phase, lvgl_port_phase_mark_t start);
+
+// Port side: frame boundaries, the span of lv_timer_handler (OTHER is what the phases
+// inside it do not account for) and LVGL's refresh events
+void lvgl_port_profile_frame_begin(void);
+void lvgl_port_profile_handler_span(lvgl_port_phase_mark_t start);
+void lvgl_port_profile_refr_start(void);
+void lvgl_port_profile_render_start(void);
+void lvgl_port_profile_refr_ready(void);
+void lvgl_port_profile_frame_end(void);
+
+// Recorded frames, newest first (age 0); NULL past the ones recorded
+int lvgl_port_profile_frame_count(void);
+const lvgl_port_frame_profile_t *lvgl_port_profile_frame(int age);
+
+const char *lvgl_port_profile_phase_name(lvgl_port_phase_t phase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_PROFILE_H
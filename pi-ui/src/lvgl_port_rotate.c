@@ -0,0 +1,199 @@
+#include "lvgl_port_rotate.h"
+
+#include <string.h>
+
+#if !defined(LVGL_PORT_ROTATE_SCALAR) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+	#define LVGL_PORT_ROTATE_NEON 1
+	#include <arm_neon.h>
+#elif !defined(LVGL_PORT_ROTATE_SCALAR) && defined(__SSE2__)
+	#define LVGL_PORT_ROTATE_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// Cache block: 64x64 source pixels (8 KB in, 8 KB out) keeps both sides of a block in L1
+#define ROTATE_BLOCK 64
+#define ROTATE_TILE 8
+
+bool lvgl_port_rotation_parse(const char *spec, lvgl_port_rotation_t *rotation)
+{
+	if (!spec || !rotation) return false;
+
+	if (strcmp(spec, "sdl") == 0) {
+
+		*rotation = LVGL_PORT_ROTATE_SDL;
+		return true;
+	}
+
+	if (strcmp(spec, "software") == 0 || strcmp(spec, "sw") == 0) {
+
+		*rotation = LVGL_PORT_ROTATE_SOFTWARE;
+		return true;
+	}
+
+	return false;
+}
+
+/* =========================
+   SCALAR
+   ========================= */
+
+// Rotate the sub-block [x0, x1) x [y0, y1) of a w x h area
+static void rotate_region_scalar(
+
+	const uint16_t *src,
+	int src_stride,
+	uint16_t *dst,
+	int dst_stride,
+	int h,
+	int x0, int x1,
+	int y0, int y1
+){
+	for (int x = x0; x < x1; x++) {
+
+		uint16_t *out = dst + (size_t)x * dst_stride + (h - 1 - y0);
+		const uint16_t *in = src + (size_t)y0 * src_stride + x;
+		for (int y = y0; y < y1; y++) {
+
+			*out-- = *in;
+			in += src_stride;
+		}
+	}
+}
+
+void lvgl_port_rotate90_rgb565_scalar(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h)
+{
+	if (w <= 0 || h <= 0) return;
+
+	rotate_region_scalar(src, src_stride, dst, dst_stride, h, 0, w, 0, h);
+}
+
+/* =========================
+   8x8 TILES
+   ========================= */
+
+// One 8x8 tile: source rows y..y+7 at columns x..x+7. Rows are loaded bottom-up so the
+// register transpose comes out already flipped: transposed row i is dst row x + i.
+#if LVGL_PORT_ROTATE_NEON
+
+static inline void rotate_tile(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int h, int x, int y)
+{
+	const uint16_t *in = src + (size_t)(y + 7) * src_stride + x;
+	uint16x8_t a0 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a1 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a2 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a3 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a4 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a5 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a6 = vld1q_u16(in); in -= src_stride;
+	uint16x8_t a7 = vld1q_u16(in);
+
+	uint16x8x2_t b0 = vtrnq_u16(a0, a1);
+	uint16x8x2_t b1 = vtrnq_u16(a2, a3);
+	uint16x8x2_t b2 = vtrnq_u16(a4, a5);
+	uint16x8x2_t b3 = vtrnq_u16(a6, a7);
+
+	uint32x4x2_t c0 = vtrnq_u32(vreinterpretq_u32_u16(b0.val[0]), vreinterpretq_u32_u16(b1.val[0]));
+	uint32x4x2_t c1 = vtrnq_u32(vreinterpretq_u32_u16(b0.val[1]), vreinterpretq_u32_u16(b1.val[1]));
+	uint32x4x2_t c2 = vtrnq_u32(vreinterpretq_u32_u16(b2.val[0]), vreinterpretq_u32_u16(b3.val[0]));
+	uint32x4x2_t c3 = vtrnq_u32(vreinterpretq_u32_u16(b2.val[1]), vreinterpretq_u32_u16(b3.val[1]));
+
+	uint16_t *out = dst + (size_t)x * dst_stride + (h - 8 - y);
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0.val[0]), vget_low_u32(c2.val[0])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1.val[0]), vget_low_u32(c3.val[0])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0.val[1]), vget_low_u32(c2.val[1])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1.val[1]), vget_low_u32(c3.val[1])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0.val[0]), vget_high_u32(c2.val[0])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1.val[0]), vget_high_u32(c3.val[0])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0.val[1]), vget_high_u32(c2.val[1])))); out += dst_stride;
+	vst1q_u16(out, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1.val[1]), vget_high_u32(c3.val[1]))));
+}
+
+#elif LVGL_PORT_ROTATE_SSE2
+
+static inline void rotate_tile(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int h, int x, int y)
+{
+	const uint16_t *in = src + (size_t)(y + 7) * src_stride + x;
+	__m128i a0 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a1 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a2 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a3 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a4 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a5 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a6 = _mm_loadu_si128((const __m128i *)in); in -= src_stride;
+	__m128i a7 = _mm_loadu_si128((const __m128i *)in);
+
+	__m128i t0 = _mm_unpacklo_epi16(a0, a1);
+	__m128i t1 = _mm_unpackhi_epi16(a0, a1);
+	__m128i t2 = _mm_unpacklo_epi16(a2, a3);
+	__m128i t3 = _mm_unpackhi_epi16(a2, a3);
+	__m128i t4 = _mm_unpacklo_epi16(a4, a5);
+	__m128i t5 = _mm_unpackhi_epi16(a4, a5);
+	__m128i t6 = _mm_unpacklo_epi16(a6, a7);
+	__m128i t7 = _mm_unpackhi_epi16(a6, a7);
+
+	__m128i u0 = _mm_unpacklo_epi32(t0, t2);
+	__m128i u1 = _mm_unpackhi_epi32(t0, t2);
+	__m128i u2 = _mm_unpacklo_epi32(t1, t3);
+	__m128i u3 = _mm_unpackhi_epi32(t1, t3);
+	__m128i u4 = _mm_unpacklo_epi32(t4, t6);
+	__m128i u5 = _mm_unpackhi_epi32(t4, t6);
+	__m128i u6 = _mm_unpacklo_epi32(t5, t7);
+	__m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+	uint16_t *out = dst + (size_t)x * dst_stride + (h - 8 - y);
+	_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi64(u0, u4)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpackhi_epi64(u0, u4)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi64(u1, u5)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpackhi_epi64(u1, u5)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi64(u2, u6)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpackhi_epi64(u2, u6)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi64(u3, u7)); out += dst_stride;
+	_mm_storeu_si128((__m128i *)out, _mm_unpackhi_epi64(u3, u7));
+}
+
+#else
+
+static inline void rotate_tile(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int h, int x, int y)
+{
+	rotate_region_scalar(src, src_stride, dst, dst_stride, h, x, x + ROTATE_TILE, y, y + ROTATE_TILE);
+}
+
+#endif
+
+void lvgl_port_rotate90_rgb565(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h)
+{
+	if (w <= 0 || h <= 0) return;
+
+	int w8 = w & ~(ROTATE_TILE - 1);
+	int h8 = h & ~(ROTATE_TILE - 1);
+
+	// Whole tiles, one cache block at a time
+	for (int by = 0; by < h8; by += ROTATE_BLOCK) {
+
+		int by_end = (by + ROTATE_BLOCK < h8) ? by + ROTATE_BLOCK : h8;
+		for (int bx = 0; bx < w8; bx += ROTATE_BLOCK) {
+
+			int bx_end = (bx + ROTATE_BLOCK < w8) ? bx + ROTATE_BLOCK : w8;
+			for (int x = bx; x < bx_end; x += ROTATE_TILE) {
+				for (int y = by; y < by_end; y += ROTATE_TILE) {
+					rotate_tile(src, src_stride, dst, dst_stride, h, x, y);
+				}
+			}
+		}
+	}
+
+	// Ragged right columns and bottom rows
+	if (w8 < w) rotate_region_scalar(src, src_stride, dst, dst_stride, h, w8, w, 0, h8);
+	if (h8 < h) rotate_region_scalar(src, src_stride, dst, dst_stride, h, 0, w, h8, h);
+}
+
+const char *lvgl_port_rotate_isa(void)
+{
+#if LVGL_PORT_ROTATE_NEON
+	return "neon";
+#elif LVGL_PORT_ROTATE_SSE2
+	return "sse2";
+#else
+	return "scalar";
+#endif
+}
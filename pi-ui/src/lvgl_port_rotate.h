@@ -0,0 +1,42 @@
+#ifndef LVGL_PORT_ROTATE_H
+#define LVGL_PORT_ROTATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Software 90° clockwise rotation of RGB565 blocks, for displays where SDL's
+ * rotated copy runs on the software renderer.
+ *
+ * Cache-blocked 8x8 tile transposes: NEON on the Pi, SSE2 on x86 dev boxes.
+ * Define LVGL_PORT_ROTATE_SCALAR to force the scalar reference everywhere.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Who turns the portrait LVGL frame into the landscape panel
+typedef enum {
+	LVGL_PORT_ROTATE_SDL = 0,    // SDL_RenderCopyEx(…, 90, …) on the GPU / SDL renderer
+	LVGL_PORT_ROTATE_SOFTWARE,   // Flushed areas rotated on the CPU into a landscape texture
+} lvgl_port_rotation_t;
+
+// Parse "sdl" or "software" ("sw"). Returns false on a bad spec.
+bool lvgl_port_rotation_parse(const char *spec, lvgl_port_rotation_t *rotation);
+
+// Rotate a w x h block 90° clockwise: src pixel (x, y) goes to dst (h - 1 - y, x).
+// dst points at the top-left of the rotated (h x w) block. Strides are in pixels.
+void lvgl_port_rotate90_rgb565(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h);
+
+// Scalar reference (always built, used by the benchmark to check the fast path)
+void lvgl_port_rotate90_rgb565_scalar(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h);
+
+// Name of the instruction set the fast path was compiled for ("neon", "sse2" or "scalar")
+const char *lvgl_port_rotate_isa(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LVGL_PORT_ROTATE_H
@@ -1,125 +1,532 @@
 #include "lvgl_port_pi.h"
+#include "lvgl_port_profile.h"
 #include "screens/screen_manager.h"
+#include "screens/screen_transition.h"
 #include "screens/home_screen/home_screen.h"
 #include "screens/boot_screen/boot_screen.h"
 
 #include "state/device_state.h"
 #include "displayModules/shared/module_interface.h"
+#include "displayModules/power-monitor/power-monitor.h"
 #include "app_data_store.h"
 
 #include "data/config.h"
 #include "data/mock_data/mock_data.h"
 #include "data/real_data/real_data.h"
 #include "data/lerp_data/lerp_data.h"
+#include "fonts/app_fonts.h"
+#include "fonts/lv_font_noplato_14.h"
+#include "fonts/lv_font_noplato_24.h"
+#include "fonts/lv_font_zector_72.h"
 
 #include "utils/crash_handler.h"
+#include "utils/time_source.h"
+#include "utils/trace.h"
+#include "utils/log.h"
+#include "utils/startup_profile.h"
+#include "utils/font_warmup.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <time.h>
+#include <stdatomic.h>
 
 static const char *TAG = "main";
 
+// Set by the producer once it has written a sample (startup profiling)
+static atomic_bool data_produced = false;
+
 /* =========================
    LVGL UI UPDATE (LV TIMER)
    ========================= */
 void ui_update_timer_callback(lv_timer_t *timer)
 {
 	// 1. Update central app data store (all module data)
+	lvgl_port_phase_mark_t mark = lvgl_port_profile_mark();
 	app_data_store_update();
+	lvgl_port_profile_add(LVGL_PORT_PHASE_STORE, mark);
 
 	// 2. Update all display modules (includes data collection and UI rendering)
+	mark = lvgl_port_profile_mark();
 	display_modules_update_all();
+	lvgl_port_profile_add(LVGL_PORT_PHASE_MODULES, mark);
 
 	// 3. Handle screen transitions using screen manager
+	mark = lvgl_port_profile_mark();
 	screen_manager_update();
+	lvgl_port_profile_add(LVGL_PORT_PHASE_SCREENS, mark);
+
+	// 4. Vehicle off: the frame governor drops the refresh rate until someone touches the screen
+	power_monitor_data_t *power_data = power_monitor_get_data();
+	if (power_data) {
+		lvgl_port_set_ignition(power_data->ignition_on);
+	}
+
+	// 5. First produced sample went through the store and modules: the next frame shows it
+	static bool live_data_seen = false;
+	if (!live_data_seen && atomic_load_explicit(&data_produced, memory_order_acquire)) {
+		live_data_seen = true;
+		startup_profile_live_data();
+	}
 }
 
 /* =========================
    DATA PRODUCER TASK
    ========================= */
-static void data_task(void *arg)
+#define DATA_TASK_PERIOD_MS 20
+
+static void data_task_step(void)
 {
+	TRACE_SCOPE("data_task");
 
+	// The UI timer reads the state objects inside lv_timer_handler, which holds the LVGL
+	// lock; take it while writing them. Mock data is also re-published from the UI timer,
+	// so its generator runs under the lock too; real sensor reads stay outside it.
+	if (data_config_get_source() == DATA_SOURCE_MOCK) {
+		lvgl_port_lock(0);
+		mock_data_update();
+		mock_data_write_to_state_objects();
+		lvgl_port_unlock();
+	} else {
+		real_data_update();
+		lvgl_port_lock(0);
+		real_data_write_to_state_objects();
+		lvgl_port_unlock();
+	}
+	atomic_store_explicit(&data_produced, true, memory_order_release);
+}
+
+static void data_task(void *arg)
+{
+	trace_set_thread_name("data");
 
 	while (1) {
-		if (data_config_get_source() == DATA_SOURCE_MOCK) {
-			mock_data_update();
-			mock_data_write_to_state_objects();
-		} else {
-			real_data_update();
-			real_data_write_to_state_objects();
-		}
+		data_task_step();
 
-		// If you need to nudge UI without touching LVGL from here:
-		// (optional) lv_async_call(some_lightweight_cb, user_data);
+		// Wake the UI loop so new values show without waiting for the next UI tick
+		lvgl_port_notify_data();
 
 		// Minimal throttling for maximum performance
-		usleep(20000); // 20ms delay for maximum responsiveness
+		usleep(DATA_TASK_PERIOD_MS * 1000); // 20ms delay for maximum responsiveness
 	}
 }
 
+// Virtual clock: the producer runs as an LVGL timer so it follows simulated time and
+// interleaves with the UI the same way on every run
+static void data_timer_callback(lv_timer_t *timer)
+{
+	lvgl_port_phase_mark_t mark = lvgl_port_profile_mark();
+	data_task_step();
+	lvgl_port_profile_add(LVGL_PORT_PHASE_DATA, mark);
+}
+
+/* =========================
+   STARTUP
+   ========================= */
+// Work with no LVGL calls runs on worker threads while the boot screen is up;
+// the rest runs one step per LVGL timer tick so the progress bar is drawn between steps.
+
+static void load_device_state(void)
+{
+	device_state_init();
+}
+
+static void connect_data_source(void)
+{
+	if (data_config_get_source() == DATA_SOURCE_MOCK) {
+		mock_data_init();
+		mock_data_enable(true);  // Enable mock data updates
+		LOG_I(TAG, "Mock data component initialized");
+	} else {
+		real_data_init();
+		LOG_I(TAG, "Real data component initialized");
+	}
+}
+
+// Maps the app fonts when they come from files, then pages in the compiled-in fonts
+// of the home and detail screens (mapped fonts page in per view, see app_fonts_prefetch)
+static atomic_bool fonts_loaded;
+
+static void load_fonts(void)
+{
+	atomic_store(&fonts_loaded, app_fonts_init());
+
+	static const lv_font_t *const fonts[] = {
+		&lv_font_zector_72, &lv_font_noplato_24, &lv_font_noplato_14,
+		&lv_font_montserrat_12, &lv_font_montserrat_16, &lv_font_montserrat_20,
+	};
+	size_t bytes = font_warmup(fonts, (int)(sizeof(fonts) / sizeof(fonts[0])));
+	LOG_D("startup", "Font data paged in: %zu KB", bytes / 1024);
+}
+
+static startup_task_t state_task = STARTUP_TASK("device_state", load_device_state, 30);
+static startup_task_t source_task = STARTUP_TASK("data_source", connect_data_source, 20);
+static startup_task_t fonts_task = STARTUP_TASK("fonts", load_fonts, 10);
+
+typedef enum {
+	BOOT_STEP_STORE,        // App data store and LERP
+	BOOT_STEP_MODULES,      // Display modules: need device state and the data source
+	BOOT_STEP_SCREENS,      // Screen manager, UI timer and data producer
+	BOOT_STEP_DONE,
+} boot_step_t;
+
+// Shares of the progress bar for the main-thread steps (tasks carry their own)
+static const int boot_step_weight[BOOT_STEP_DONE] = { 10, 20, 10 };
+
+static boot_step_t boot_step = BOOT_STEP_STORE;
+static int boot_steps_progress = 0;
+static startup_phase_t boot_phase;
+static bool boot_complete = false;
+
+static int boot_progress(void)
+{
+	return boot_steps_progress
+		+ (startup_task_done(&state_task) ? state_task.weight : 0)
+		+ (startup_task_done(&source_task) ? source_task.weight : 0)
+		+ (startup_task_done(&fonts_task) ? fonts_task.weight : 0);
+}
+
+static void start_ui(void)
+{
+	boot_screen_cleanup();
+
+	// Init screen manager (creates Home/Detail etc.)
+	screen_manager_init();
+
+	// Modals and other reusable UI: skeletons now, the rest over the next frames
+	display_modules_prebuild_all();
+
+	// Create LVGL UI update timer (runs in LVGL context)
+	lv_timer_t *ui_timer = lv_timer_create(ui_update_timer_callback, 8, NULL); // 8ms (120 FPS) for maximum performance
+	lv_timer_set_repeat_count(ui_timer, -1);
+	lvgl_port_pace_timer(ui_timer, 8);
+	lvgl_port_set_data_timer(ui_timer);
+
+	// Start data producer task (no LVGL calls inside)
+	if (time_source_is_virtual()) {
+
+		lv_timer_create(data_timer_callback, DATA_TASK_PERIOD_MS, NULL);
+	} else {
+
+		pthread_t data_thread;
+		pthread_create(&data_thread, NULL, (void*)data_task, NULL);
+		pthread_detach(data_thread);
+	}
+}
+
+static void boot_timer_callback(lv_timer_t *timer)
+{
+	startup_phase_t phase;
+
+	switch (boot_step) {
+		case BOOT_STEP_STORE:
+			phase = startup_phase_begin("app_data_store");
+			app_data_store_init();
+			lerp_data_init();
+			startup_phase_end(phase);
+			break;
+
+		case BOOT_STEP_MODULES:
+			if (!startup_task_done(&state_task) || !startup_task_done(&source_task)) {
+
+				boot_screen_update_progress(boot_progress());
+				return; // Waiting on the workers
+			}
+			boot_screen_set_status("Building modules...");
+			phase = startup_phase_begin("display_modules");
+			display_modules_init_all();
+			startup_phase_end(phase);
+			break;
+
+		case BOOT_STEP_SCREENS:
+			// Views need mapped fonts loaded; compiled-in ones are only warmed up, never wait for that
+			if (app_fonts_mapped() && !startup_task_done(&fonts_task)) {
+
+				boot_screen_update_progress(boot_progress());
+				return;
+			}
+			if (app_fonts_mapped() && !atomic_load(&fonts_loaded)) {
+
+				// Mapped fonts missing (app_fonts_init logged which): no view can be drawn right
+				LOG_E(TAG, "Cannot start without the app fonts");
+				log_flush();
+				exit(EXIT_FAILURE);
+			}
+			phase = startup_phase_begin("screens");
+			start_ui();
+			startup_phase_end(phase);
+
+			lv_timer_delete(timer);
+			startup_phase_end(boot_phase);
+			boot_complete = true;
+			boot_step = BOOT_STEP_DONE;
+			return;
+
+		case BOOT_STEP_DONE:
+			return;
+	}
+
+	boot_steps_progress += boot_step_weight[boot_step];
+	boot_step++;
+	boot_screen_update_progress(boot_progress());
+	if (boot_step == BOOT_STEP_MODULES) boot_screen_set_status("Loading settings...");
+	if (boot_step == BOOT_STEP_SCREENS) boot_screen_set_status("Starting...");
+}
+
+bool app_main_ready(void)
+{
+	return boot_complete;
+}
+
 /* =========================
    APP MAIN
    ========================= */
 void app_main(void)
 {
-	printf("[I] main: Starting Jeep Sensor Hub UI\n");
+	LOG_I(TAG, "Starting Jeep Sensor Hub UI");
+	boot_phase = startup_phase_begin("boot");
 
 	// 0) Initialize crash handlers first
 	crash_handler_init();
 
 	// 1) Init LVGL port for Pi (starts LVGL tasks & tick internally)
+	startup_phase_t phase = startup_phase_begin("lvgl_port_init");
 	int ret = lvgl_port_init();
 	if (ret != 0) {
-		printf("[E] main: Failed to initialize LVGL display: %d\n", ret);
+		LOG_E(TAG, "Failed to initialize LVGL display: %d", ret);
 		return;
 	}
-	printf("[I] main: LVGL display initialized successfully\n");
+	startup_phase_end(phase);
+	LOG_I(TAG, "LVGL display initialized successfully");
 
+	// 2) Boot screen on the panel before anything else: the dash isn't blank while the rest loads
+	phase = startup_phase_begin("boot_screen");
+	boot_screen_init();
+	lv_refr_now(NULL);
+	startup_phase_end(phase);
 
-	// 2) Device/data init
-	device_state_init();
+	// 3) Device state, data source and fonts load on workers
 	data_config_init();
 
 	// Choose your data source
 	data_config_set_source(DATA_SOURCE_MOCK);   // or DATA_SOURCE_REAL
 
-	if (data_config_get_source() == DATA_SOURCE_MOCK) {
-		mock_data_init();
-		mock_data_enable(true);  // Enable mock data updates
-		printf("[I] main: Mock data component initialized\n");
-	} else {
-		real_data_init();
-		printf("[I] main: Real data component initialized\n");
+	startup_task_start(&state_task);
+	startup_task_start(&source_task);
+	startup_task_start(&fonts_task);
+
+	// 4) Store, LERP, display modules and screens: one step per tick (boot_timer_callback)
+	lv_timer_create(boot_timer_callback, 0, NULL);
+}
+
+// pi_ui_bench links this file for app_main and brings its own command line and main()
+#ifndef PI_UI_NO_MAIN
+
+/* =========================
+   COMMAND LINE
+   ========================= */
+static void print_usage(const char *prog)
+{
+	printf("Usage: %s [--buffer=full|direct|texture|partial[:lines]] [--rotate=sdl|software]\n", prog);
+	printf("          [--output=sdl|fbdev[:device]|file:<path>|memfd|headless[:ms]] [--present=thread|sync]\n");
+	printf("          [--governor=on|off] [--thermal=off|<path>[,<hot C>]] [--run-for=<ms>] [--screenshot=<path>]\n");
+	printf("          [--trace-budget=<ms>] [--trace-dir=<dir>] [--log=<level>[,<tag>=<level>...]]\n");
+	printf("          [--transitions=on|off]\n");
+	printf("  --buffer   LVGL draw buffer strategy (default partial:%d, env PI_UI_BUFFER)\n",
+		LVGL_PORT_PARTIAL_LINES_DEFAULT);
+	printf("  --rotate   Who rotates the portrait UI onto the panel (default sdl, env PI_UI_ROTATE)\n");
+	printf("  --output   Display backend (default sdl, env PI_UI_OUTPUT); headless:<ms> steps the virtual clock\n");
+	printf("  --present  Present SDL frames from a separate thread or inline (default thread, env PI_UI_PRESENT)\n");
+	printf("  --governor Adapt the frame rate to activity, ignition and heat (default on, env PI_UI_GOVERNOR)\n");
+	printf("  --thermal  Thermal zone for the governor (default %s,80, env PI_UI_THERMAL)\n",
+		LVGL_PORT_GOVERNOR_THERMAL_DEFAULT);
+	printf("  --run-for  Exit after this many milliseconds (simulated when headless:<ms>)\n");
+	printf("  --screenshot  Save the last headless frame as a PPM image on exit\n");
+	printf("  --trace-budget  Dump the trace when a frame takes longer (env PI_UI_TRACE_BUDGET; -DPI_UI_TRACE=ON builds)\n");
+	printf("  --trace-dir  Where trace dumps are written (default: working directory)\n");
+	printf("  --log      Log levels: none|error|warn|info|debug|verbose, per tag as <tag>=<level> (default info, env PI_UI_LOG)\n");
+	printf("  --transitions  Slide between screens from snapshots (default on, env PI_UI_TRANSITIONS)\n");
+}
+
+// Headless frame written on exit (--screenshot)
+static const char *screenshot_path = NULL;
+
+// Startup options; returns false if the program should exit
+static bool parse_args(int argc, char *argv[])
+{
+	const char *buffer_spec = getenv("PI_UI_BUFFER");
+	const char *rotate_spec = getenv("PI_UI_ROTATE");
+	const char *output_spec = getenv("PI_UI_OUTPUT");
+	const char *present_spec = getenv("PI_UI_PRESENT");
+	const char *governor_spec = getenv("PI_UI_GOVERNOR");
+	const char *thermal_spec = getenv("PI_UI_THERMAL");
+	const char *trace_budget_spec = getenv("PI_UI_TRACE_BUDGET");
+	const char *log_spec = getenv("PI_UI_LOG");
+	const char *transitions_spec = getenv("PI_UI_TRANSITIONS");
+
+	for (int i = 1; i < argc; i++) {
+
+		if (strncmp(argv[i], "--buffer=", 9) == 0) {
+
+			buffer_spec = argv[i] + 9;
+		} else if (strncmp(argv[i], "--rotate=", 9) == 0) {
+
+			rotate_spec = argv[i] + 9;
+		} else if (strncmp(argv[i], "--output=", 9) == 0) {
+
+			output_spec = argv[i] + 9;
+		} else if (strncmp(argv[i], "--present=", 10) == 0) {
+
+			present_spec = argv[i] + 10;
+		} else if (strncmp(argv[i], "--governor=", 11) == 0) {
+
+			governor_spec = argv[i] + 11;
+		} else if (strncmp(argv[i], "--thermal=", 10) == 0) {
+
+			thermal_spec = argv[i] + 10;
+		} else if (strncmp(argv[i], "--run-for=", 10) == 0) {
+
+			char *end;
+			long run_ms = strtol(argv[i] + 10, &end, 10);
+			if (end == argv[i] + 10 || *end != '\0' || run_ms <= 0) {
+
+				LOG_E(TAG, "Invalid run time '%s'", argv[i] + 10);
+				print_usage(argv[0]);
+				return false;
+			}
+			lvgl_port_set_run_limit((uint32_t)run_ms);
+		} else if (strncmp(argv[i], "--screenshot=", 13) == 0 && argv[i][13] != '\0') {
+
+			screenshot_path = argv[i] + 13;
+		} else if (strncmp(argv[i], "--trace-budget=", 15) == 0) {
+
+			trace_budget_spec = argv[i] + 15;
+		} else if (strncmp(argv[i], "--trace-dir=", 12) == 0 && argv[i][12] != '\0') {
+
+			trace_set_dir(argv[i] + 12);
+		} else if (strncmp(argv[i], "--log=", 6) == 0) {
+
+			log_spec = argv[i] + 6;
+		} else if (strncmp(argv[i], "--transitions=", 14) == 0) {
+
+			transitions_spec = argv[i] + 14;
+		} else {
+
+			print_usage(argv[0]);
+			return false;
+		}
 	}
 
-	// 3) Initialize central app data store (all module data lives here)
-	app_data_store_init();
+	if (buffer_spec) {
 
-	// 4) Initialize LERP data system
-	lerp_data_init();
+		lvgl_port_buffer_config_t config;
+		if (!lvgl_port_buffer_config_parse(buffer_spec, &config)) {
 
-	// 5) Initialize all display modules via standardized interface
-	display_modules_init_all();
+			LOG_E(TAG, "Invalid buffer strategy '%s'", buffer_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+		lvgl_port_set_buffer_config(&config);
+	}
 
-	boot_screen_init();
-	boot_screen_update_progress(100);
-	boot_screen_cleanup();
+	if (rotate_spec) {
 
-	// 6) Init screen manager (creates Home/Detail etc.)
-	screen_manager_init();
+		lvgl_port_rotation_t rotation;
+		if (!lvgl_port_rotation_parse(rotate_spec, &rotation)) {
 
-	// 7) Create LVGL UI update timer (runs in LVGL context)
-	lv_timer_t *ui_timer = lv_timer_create(ui_update_timer_callback, 8, NULL); // 8ms (120 FPS) for maximum performance
-	lv_timer_set_repeat_count(ui_timer, -1);
+			LOG_E(TAG, "Invalid rotation '%s'", rotate_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+		lvgl_port_set_rotation(rotation);
+	}
 
-	// 8) Start data producer task (no LVGL calls inside)
-	pthread_t data_thread;
-	pthread_create(&data_thread, NULL, (void*)data_task, NULL);
-	pthread_detach(data_thread);
+	if (output_spec && !lvgl_port_set_output(output_spec)) {
+
+		LOG_E(TAG, "Invalid output '%s'", output_spec);
+		print_usage(argv[0]);
+		return false;
+	}
 
+	if (present_spec) {
+
+		if (strcmp(present_spec, "thread") == 0) {
+
+			lvgl_port_set_present_threaded(true);
+		} else if (strcmp(present_spec, "sync") == 0) {
+
+			lvgl_port_set_present_threaded(false);
+		} else {
+
+			LOG_E(TAG, "Invalid present mode '%s'", present_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+	}
+
+	if (governor_spec) {
+
+		if (strcmp(governor_spec, "on") == 0) {
+
+			lvgl_port_set_governor_enabled(true);
+		} else if (strcmp(governor_spec, "off") == 0) {
+
+			lvgl_port_set_governor_enabled(false);
+		} else {
+
+			LOG_E(TAG, "Invalid governor setting '%s'", governor_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+	}
+
+	if (thermal_spec && !lvgl_port_set_thermal(thermal_spec)) {
+
+		LOG_E(TAG, "Invalid thermal zone '%s'", thermal_spec);
+		print_usage(argv[0]);
+		return false;
+	}
+
+	if (trace_budget_spec) {
+
+		char *end;
+		double budget_ms = strtod(trace_budget_spec, &end);
+		if (end == trace_budget_spec || *end != '\0' || budget_ms < 0) {
+
+			LOG_E(TAG, "Invalid trace budget '%s'", trace_budget_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+		trace_set_frame_budget_us((uint32_t)(budget_ms * 1000));
+	}
+
+	if (log_spec && !log_configure(log_spec)) {
+
+		LOG_E(TAG, "Invalid log levels '%s'", log_spec);
+		print_usage(argv[0]);
+		return false;
+	}
+
+	if (transitions_spec) {
+
+		if (strcmp(transitions_spec, "on") == 0) {
+
+			screen_transition_set_enabled(true);
+		} else if (strcmp(transitions_spec, "off") == 0) {
+
+			screen_transition_set_enabled(false);
+		} else {
+
+			LOG_E(TAG, "Invalid transitions setting '%s'", transitions_spec);
+			print_usage(argv[0]);
+			return false;
+		}
+	}
+
+	return true;
 }
 
 /* =========================
@@ -127,11 +534,25 @@ void app_main(void)
    ========================= */
 int main(int argc, char *argv[])
 {
+	startup_profile_init();
+
+	if (!parse_args(argc, argv)) {
+		return 1;
+	}
+
+	// Log output moves to the writer thread from here on
+	log_init();
+
 	// Initialize the application
 	app_main();
 
 	// Start the main event loop to keep the window alive and handle events
 	lvgl_port_main_loop();
 
+	if (screenshot_path && !lvgl_port_save_screenshot(screenshot_path)) {
+		return 1;
+	}
+
 	return 0;
 }
+#endif // PI_UI_NO_MAIN
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include "boot_screen.h"
+#include "../../utils/log.h"
 #include <lvgl.h>
 
 
@@ -12,7 +13,7 @@ static lv_obj_t *progress_bar = NULL;
 
 void boot_screen_init(void)
 {
-	printf("[I] boot_screen: Initializing boot screen\n");
+	LOG_I(TAG, "Initializing boot screen");
 
 	// Create main container
 	boot_container = lv_obj_create(lv_scr_act());
@@ -21,7 +22,7 @@ void boot_screen_init(void)
 	lv_obj_set_style_bg_color(boot_container, lv_color_hex(0x000000), 0); // Black background
 	lv_obj_set_style_border_width(boot_container, 0, 0);
 
-	printf("[I] boot_screen: Boot screen container created\n");
+	LOG_I(TAG, "Boot screen container created");
 
 	// Create logo/title label
 	logo_label = lv_label_create(boot_container);
@@ -46,23 +47,33 @@ void boot_screen_init(void)
 	lv_obj_set_style_bg_color(progress_bar, lv_color_hex(0x333333), LV_PART_MAIN);
 	lv_obj_set_style_bg_color(progress_bar, lv_color_hex(0x00AA00), LV_PART_INDICATOR);
 
-	printf("[I] boot_screen: Boot screen initialized successfully\n");
+	LOG_I(TAG, "Boot screen initialized successfully");
 }
 
 void boot_screen_update_progress(int progress)
 {
-		printf("[I] boot_screen: Updating boot screen progress: %d%%\n", progress);
+	// Called every tick while boot waits on its workers
+	if (progress_bar && lv_bar_get_value(progress_bar) == progress) return;
+
+		LOG_I(TAG, "Updating boot screen progress: %d%%", progress);
 	if (progress_bar) {
 		lv_bar_set_value(progress_bar, progress, LV_ANIM_ON);
-		printf("[I] boot_screen: Progress bar updated to %d%%\n", progress);
+		LOG_I(TAG, "Progress bar updated to %d%%", progress);
 	} else {
-		printf("[W] boot_screen: Progress bar not available for update\n");
+		LOG_W(TAG, "Progress bar not available for update");
+	}
+}
+
+void boot_screen_set_status(const char *text)
+{
+	if (loading_label) {
+		lv_label_set_text(loading_label, text);
 	}
 }
 
 void boot_screen_cleanup(void)
 {
-	printf("[I] boot_screen: Cleaning up boot screen\n");
+	LOG_I(TAG, "Cleaning up boot screen");
 	if (boot_container) {
 	// Clear all child objects first to avoid event handler issues
 	lv_obj_t *child = lv_obj_get_child(boot_container, 0);
@@ -83,8 +94,8 @@ void boot_screen_cleanup(void)
 		logo_label = NULL;
 		loading_label = NULL;
 		progress_bar = NULL;
-		printf("[I] boot_screen: Boot screen objects deleted\n");
+		LOG_I(TAG, "Boot screen objects deleted");
 	} else {
-		printf("[W] boot_screen: Boot container not found for cleanup\n");
+		LOG_W(TAG, "Boot container not found for cleanup");
 	}
 }
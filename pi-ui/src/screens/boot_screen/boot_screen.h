@@ -7,6 +7,7 @@ extern "C" {
 
 void boot_screen_init(void);
 void boot_screen_update_progress(int progress);
+void boot_screen_set_status(const char *text);
 void boot_screen_cleanup(void);
 
 #ifdef __cplusplus
@@ -4,15 +4,23 @@
 #include "../../displayModules/shared/palette.h"
 
 #include "../../lvgl_port_pi.h"
+#include "../../utils/trace.h"
 #include "../../fonts/lv_font_noplato_24.h"
+#include "../../utils/log.h"
 #include <stdlib.h>
 #include <string.h>
 
-// Simple modal tracking - only store modal pointers, read state from modal itself
+static const char *TAG = "detail_screen";
+
+// Modal pool: each modal is built once (ahead of time by detail_screen_prebuild_modal,
+// or on first open) and then only shown and hidden. Store the pointer and read the
+// state from the modal itself.
 typedef struct {
 	char name[32];
 	void* modal_pointer;
 	void (*destroy_func)(void* modal);
+	void (*show_func)(void* modal);
+	void (*hide_func)(void* modal);
 	bool (*is_visible_func)(void* modal); // Function to check if modal is visible
 } modal_tracking_t;
 
@@ -28,14 +36,14 @@ static int detail_screen_find_modal_slot(const char* modal_name)
 			return i;
 		}
 	}
-	return -1; // Not found
+	return -1;
 }
 
 // Allocate new modal tracking slot
 static int detail_screen_allocate_modal_slot(const char* modal_name)
 {
 	if (modal_count >= MAX_MODALS) {
-		printf("[E] detail_screen: Maximum number of modals reached\n");
+		LOG_E(TAG, "Maximum number of modals reached");
 		return -1;
 	}
 
@@ -44,107 +52,111 @@ static int detail_screen_allocate_modal_slot(const char* modal_name)
 	modal_tracking[slot].name[sizeof(modal_tracking[slot].name) - 1] = '\0';
 	modal_tracking[slot].modal_pointer = NULL;
 	modal_tracking[slot].destroy_func = NULL;
+	modal_tracking[slot].show_func = NULL;
+	modal_tracking[slot].hide_func = NULL;
 	modal_tracking[slot].is_visible_func = NULL;
 
 	return slot;
 }
 
-// Callback to clear modal pointer when modal is destroyed externally
-static void detail_screen_modal_destroyed_callback(const char* modal_name)
+// Called by a modal's own DONE/CANCEL: hide it and keep it for the next open
+static void detail_screen_modal_closed_callback(const char* modal_name)
 {
-	printf("[I] detail_screen: Modal destroyed callback for: %s\n", modal_name);
+	LOG_I(TAG, "Modal closed callback for: %s", modal_name);
 
 	int slot = detail_screen_find_modal_slot(modal_name);
-	if (slot != -1) {
-		modal_tracking[slot].modal_pointer = NULL;
-		printf("[I] detail_screen: Modal %s pointer cleared\n", modal_name);
+	if (slot != -1 && modal_tracking[slot].modal_pointer && modal_tracking[slot].hide_func) {
+		modal_tracking[slot].hide_func(modal_tracking[slot].modal_pointer);
 	}
 }
 
 // Wrapper callbacks for each modal type
-static void detail_screen_timeline_modal_destroyed_wrapper(void)
+static void detail_screen_timeline_modal_closed_wrapper(void)
+{
+	detail_screen_modal_closed_callback("timeline");
+}
+
+static void detail_screen_alerts_modal_closed_wrapper(void)
+{
+	detail_screen_modal_closed_callback("alerts");
+}
+
+// Finds or builds the pooled modal for modal_name; -1 if it can't be built
+static int detail_screen_get_modal(const char* modal_name,
+	void* (*create_func)(void* config, void (*on_close)(void)),
+	void (*destroy_func)(void* modal),
+	void (*show_func)(void* modal),
+	void (*hide_func)(void* modal),
+	bool (*is_visible_func)(void* modal),
+	void* config)
 {
-	// Find the modal and hide it before clearing the pointer
-	int slot = detail_screen_find_modal_slot("timeline");
-	if (slot != -1 && modal_tracking[slot].modal_pointer) {
-		extern void timeline_modal_hide(void* modal);
-		timeline_modal_hide(modal_tracking[slot].modal_pointer);
+	int slot = detail_screen_find_modal_slot(modal_name);
+	if (slot == -1) {
+		slot = detail_screen_allocate_modal_slot(modal_name);
+		if (slot == -1) return -1;
+	}
+
+	modal_tracking[slot].destroy_func = destroy_func;
+	modal_tracking[slot].show_func = show_func;
+	modal_tracking[slot].hide_func = hide_func;
+	modal_tracking[slot].is_visible_func = is_visible_func;
+	if (modal_tracking[slot].modal_pointer) return slot;
+
+	// Use appropriate wrapper callback
+	void (*wrapper_callback)(void) = NULL;
+	if (strcmp(modal_name, "timeline") == 0) {
+		wrapper_callback = detail_screen_timeline_modal_closed_wrapper;
+	} else if (strcmp(modal_name, "alerts") == 0) {
+		wrapper_callback = detail_screen_alerts_modal_closed_wrapper;
+	}
+
+	LOG_D(TAG, "Creating modal %s with config=%p, callback=%p", modal_name, config, wrapper_callback);
+	modal_tracking[slot].modal_pointer = create_func(config, wrapper_callback);
+	if (!modal_tracking[slot].modal_pointer) {
+		LOG_E(TAG, "Failed to create modal %s", modal_name);
+		return -1;
 	}
-	detail_screen_modal_destroyed_callback("timeline");
+	return slot;
 }
 
-static void detail_screen_alerts_modal_destroyed_wrapper(void)
+void detail_screen_prebuild_modal(const char* modal_name,
+	void* (*create_func)(void* config, void (*on_close)(void)),
+	void (*destroy_func)(void* modal),
+	void (*show_func)(void* modal),
+	void (*hide_func)(void* modal),
+	bool (*is_visible_func)(void* modal),
+	void* config)
 {
-	// Find the modal and hide it before clearing the pointer
-	int slot = detail_screen_find_modal_slot("alerts");
-	if (slot != -1 && modal_tracking[slot].modal_pointer) {
-		extern void alerts_modal_hide(void* modal);
-		alerts_modal_hide(modal_tracking[slot].modal_pointer);
+	// Created hidden; its build job fills it in over the next frames
+	if (detail_screen_get_modal(modal_name, create_func, destroy_func, show_func, hide_func, is_visible_func, config) != -1) {
+		LOG_I(TAG, "Modal %s prebuilt", modal_name);
 	}
-	detail_screen_modal_destroyed_callback("alerts");
 }
 
 void detail_screen_toggle_modal(const char* modal_name,
 	void* (*create_func)(void* config, void (*on_close)(void)),
 	void (*destroy_func)(void* modal),
 	void (*show_func)(void* modal),
+	void (*hide_func)(void* modal),
 	bool (*is_visible_func)(void* modal), // Function to check modal visibility
 	void* config,
 	void (*on_close_callback)(void))
 {
-	printf("[I] detail_screen: Toggling modal: %s\n", modal_name);
+	TRACE_SCOPE("modal_toggle");
+	LOG_I(TAG, "Toggling modal: %s", modal_name);
 
-	int slot = detail_screen_find_modal_slot(modal_name);
-	if (slot == -1) {
-		slot = detail_screen_allocate_modal_slot(modal_name);
-		if (slot == -1) return;
-	}
+	int slot = detail_screen_get_modal(modal_name, create_func, destroy_func, show_func, hide_func, is_visible_func, config);
+	if (slot == -1) return;
 
-	// Check if modal exists and is visible by reading from modal itself
-	bool is_visible = false;
-	if (modal_tracking[slot].modal_pointer && modal_tracking[slot].is_visible_func) {
-		printf("[D] detail_screen: Checking modal visibility for %s, modal_pointer=%p\n", modal_name, modal_tracking[slot].modal_pointer);
-		is_visible = modal_tracking[slot].is_visible_func(modal_tracking[slot].modal_pointer);
-		printf("[D] detail_screen: Modal %s visibility: %s\n", modal_name, is_visible ? "visible" : "hidden");
-	} else {
-		printf("[D] detail_screen: Modal %s not found or invalid (ptr=%p, func=%p)\n", modal_name, modal_tracking[slot].modal_pointer, modal_tracking[slot].is_visible_func);
-	}
-
-	if (is_visible) {
+	void* modal = modal_tracking[slot].modal_pointer;
+	if (is_visible_func(modal)) {
 		// Close modal
-		if (modal_tracking[slot].modal_pointer && modal_tracking[slot].destroy_func) {
-			modal_tracking[slot].destroy_func(modal_tracking[slot].modal_pointer);
-		}
-		modal_tracking[slot].modal_pointer = NULL;
-		printf("[I] detail_screen: Modal %s closed\n", modal_name);
+		hide_func(modal);
+		LOG_I(TAG, "Modal %s closed", modal_name);
 	} else {
-		// Open modal - destroy any existing modal first to prevent memory leaks
-		if (modal_tracking[slot].modal_pointer && modal_tracking[slot].destroy_func) {
-			printf("[I] detail_screen: Destroying existing %s modal before creating new one\n", modal_name);
-			modal_tracking[slot].destroy_func(modal_tracking[slot].modal_pointer);
-			modal_tracking[slot].modal_pointer = NULL;
-		}
-
-		// Use appropriate wrapper callback
-		void (*wrapper_callback)(void) = NULL;
-		if (strcmp(modal_name, "timeline") == 0) {
-			wrapper_callback = detail_screen_timeline_modal_destroyed_wrapper;
-		} else if (strcmp(modal_name, "alerts") == 0) {
-			wrapper_callback = detail_screen_alerts_modal_destroyed_wrapper;
-		}
-
-		modal_tracking[slot].destroy_func = destroy_func;
-		modal_tracking[slot].is_visible_func = is_visible_func;
-		printf("[D] detail_screen: Creating modal %s with config=%p, callback=%p\n", modal_name, config, wrapper_callback);
-		modal_tracking[slot].modal_pointer = create_func(config, wrapper_callback);
-		printf("[D] detail_screen: Modal %s created, ptr=%p\n", modal_name, modal_tracking[slot].modal_pointer);
-		if (modal_tracking[slot].modal_pointer) {
-			printf("[D] detail_screen: Showing modal %s\n", modal_name);
-			show_func(modal_tracking[slot].modal_pointer);
-			printf("[I] detail_screen: Modal %s opened\n", modal_name);
-		} else {
-			printf("[E] detail_screen: Failed to create modal %s\n", modal_name);
-		}
+		// Open modal: show() rebinds it to the current device state
+		show_func(modal);
+		LOG_I(TAG, "Modal %s opened", modal_name);
 	}
 }
 
@@ -157,13 +169,23 @@ bool detail_screen_is_modal_visible(const char* modal_name)
 	return modal_tracking[slot].is_visible_func(modal_tracking[slot].modal_pointer);
 }
 
-// Reset modal tracking system (call when detail screen is recreated)
+// Hide every modal (call when detail screen is recreated); they stay built
 void detail_screen_reset_modal_tracking(void)
 {
-	printf("[I] detail_screen: Resetting modal tracking system\n");
+	LOG_I(TAG, "Hiding pooled modals");
+	for (int i = 0; i < modal_count; i++) {
+		if (modal_tracking[i].modal_pointer && modal_tracking[i].hide_func) {
+			modal_tracking[i].hide_func(modal_tracking[i].modal_pointer);
+		}
+	}
+}
+
+void detail_screen_destroy_modals(void)
+{
+	LOG_I(TAG, "Destroying pooled modals");
 	for (int i = 0; i < modal_count; i++) {
 		if (modal_tracking[i].modal_pointer && modal_tracking[i].destroy_func) {
-			printf("[I] detail_screen: Destroying existing modal %s\n", modal_tracking[i].name);
+			LOG_I(TAG, "Destroying existing modal %s", modal_tracking[i].name);
 			// Call destroy function and immediately clear the pointer to prevent double-free
 			void* modal_pointer = modal_tracking[i].modal_pointer;
 			modal_tracking[i].modal_pointer = NULL;
@@ -171,13 +193,13 @@ void detail_screen_reset_modal_tracking(void)
 		}
 		modal_tracking[i].modal_pointer = NULL;
 		modal_tracking[i].destroy_func = NULL;
+		modal_tracking[i].show_func = NULL;
+		modal_tracking[i].hide_func = NULL;
 		modal_tracking[i].is_visible_func = NULL;
 	}
 	modal_count = 0;
 }
 
-static const char *TAG = "detail_screen_template";
-
 // ============================================================================
 // LAYOUT CONFIGURATION - Edit these values to change the layout
 // ============================================================================
@@ -210,13 +232,13 @@ static void back_button_event_cb(lv_event_t *e)
 	lv_event_code_t code = lv_event_get_code(e);
 
 	if (code == LV_EVENT_CLICKED) {
-		printf("[I] detail_screen: BACK button clicked\n");
+		LOG_I(TAG, "BACK button clicked");
 		detail_screen_t *detail = (detail_screen_t*)lv_event_get_user_data(e);
 		if (detail && detail->on_back_clicked) {
-			printf("[I] detail_screen: Calling back button handler\n");
+			LOG_I(TAG, "Calling back button handler");
 			detail->on_back_clicked();
 		} else {
-			printf("[W] detail_screen: Back button handler not available\n");
+			LOG_W(TAG, "Back button handler not available");
 		}
 	}
 	// LV_STATE_PRESSED and LV_STATE_RELEASED are handled automatically by LVGL styling
@@ -227,31 +249,31 @@ static void setting_button_event_cb(lv_event_t *e)
 	lv_event_code_t code = lv_event_get_code(e);
 
 	if (code == LV_EVENT_CLICKED) {
-		printf("[I] detail_screen: Setting button clicked\n");
+		LOG_I(TAG, "Setting button clicked");
 		lv_obj_t *button = lv_event_get_target(e);
 		detail_screen_t *detail = (detail_screen_t*)lv_event_get_user_data(e);
 		if (!detail) {
-			printf("[W] detail_screen: No detail screen data available\n");
+			LOG_W(TAG, "No detail screen data available");
 			return;
 		}
 
 		// Get the button index from the button's user data
 		int button_index = (int)(intptr_t)lv_obj_get_user_data(button);
-		printf("[I] detail_screen: Button index: %d\n", button_index);
+		LOG_I(TAG, "Button index: %d", button_index);
 
 		// Validate index and call the appropriate handler
 		if (button_index >= 0 && button_index < detail->setting_buttons_count) {
-			printf("[I] detail_screen: Setting button %d clicked: %s\n", button_index, detail->button_configs[button_index].text);
+			LOG_I(TAG, "Setting button %d clicked: %s", button_index, detail->button_configs[button_index].text);
 
 			// Call the button's click handler
 			if (detail->button_configs[button_index].on_clicked) {
-				printf("[I] detail_screen: Calling button handler for: %s\n", detail->button_configs[button_index].text);
+				LOG_I(TAG, "Calling button handler for: %s", detail->button_configs[button_index].text);
 				detail->button_configs[button_index].on_clicked();
 			} else {
-				printf("[W] detail_screen: No handler available for button: %s\n", detail->button_configs[button_index].text);
+				LOG_W(TAG, "No handler available for button: %s", detail->button_configs[button_index].text);
 			}
 		} else {
-			printf("[W] detail_screen: Invalid button index: %d (count: %d)\n", button_index, detail->setting_buttons_count);
+			LOG_W(TAG, "Invalid button index: %d (count: %d)", button_index, detail->setting_buttons_count);
 		}
 	}
 	// LV_STATE_PRESSED and LV_STATE_RELEASED are handled automatically by LVGL styling
@@ -265,6 +287,9 @@ static void view_container_event_cb(lv_event_t *e)
 
 	detail_screen_t *detail = (detail_screen_t*)lv_event_get_user_data(e);
 
+		// Cycling recreates the current view, so the first one must exist
+	ui_build_complete(&detail->build);
+
 		// Call the generic view callback if it exists
 	if (detail->on_view_clicked) {
 
@@ -277,16 +302,16 @@ static void view_container_event_cb(lv_event_t *e)
 detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 {
 	if (!config || !config->module_name || !config->display_name) {
-		printf("[E] detail_screen: Invalid configuration for detail screen\n");
+		LOG_E(TAG, "Invalid configuration for detail screen");
 		return NULL;
 	}
 
-	// Reset modal tracking system when creating new detail screen
+	// Hide any modal left open by the previous detail screen
 	detail_screen_reset_modal_tracking();
 
 	detail_screen_t* detail = malloc(sizeof(detail_screen_t));
 	if (!detail) {
-		printf("[E] detail_screen: Failed to allocate detail screen\n");
+		LOG_E(TAG, "Failed to allocate detail screen");
 		return NULL;
 	}
 
@@ -309,7 +334,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	if (config->setting_buttons_count > 0) {
 		detail->setting_buttons = calloc(config->setting_buttons_count, sizeof(lv_obj_t*));
 		if (!detail->setting_buttons) {
-			printf("[E] detail_screen: Failed to allocate setting buttons array\n");
+			LOG_E(TAG, "Failed to allocate setting buttons array");
 			free(detail);
 			return NULL;
 		}
@@ -317,7 +342,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 		// Store button configurations
 		detail->button_configs = calloc(config->setting_buttons_count, sizeof(detail_button_config_t));
 		if (!detail->button_configs) {
-			printf("[E] detail_screen: Failed to allocate button configs array\n");
+			LOG_E(TAG, "Failed to allocate button configs array");
 			free(detail->setting_buttons);
 			free(detail);
 			return NULL;
@@ -333,7 +358,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	lv_obj_t *scr = lv_scr_act();
 	detail->root = lv_obj_create(scr);
 	if (!detail->root) {
-		printf("[E] detail_screen: Failed to create detail root container\n");
+		LOG_E(TAG, "Failed to create detail root container");
 		free(detail);
 		return NULL;
 	}
@@ -350,7 +375,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	// Create main content container
 	detail->main_content = lv_obj_create(detail->root);
 	if (!detail->main_content) {
-		printf("[E] detail_screen: Failed to create main_content\n");
+		LOG_E(TAG, "Failed to create main_content");
 		if (detail->root) lv_obj_del(detail->root);
 		free(detail);
 		return NULL;
@@ -386,7 +411,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 
 	// Debug: Check if main_content is valid
 	if (!detail->main_content) {
-		printf("[E] detail_screen: ERROR: main_content is NULL!\n");
+		LOG_E(TAG, "ERROR: main_content is NULL!");
 		return NULL;
 	}
 		// main_content is valid
@@ -394,7 +419,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	// Create left column container for current view and raw values
 	detail->left_column = lv_obj_create(detail->main_content);
 	if (!detail->left_column) {
-		printf("[E] detail_screen: Failed to create left_column\n");
+		LOG_E(TAG, "Failed to create left_column");
 		return NULL; // Return early if creation failed
 	}
 
@@ -419,7 +444,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	if (config->show_gauges_section) {
 		detail->gauges_container = lv_obj_create(detail->main_content);
 		if (!detail->gauges_container) {
-			printf("[E] detail_screen: Failed to create gauges_container\n");
+			LOG_E(TAG, "Failed to create gauges_container");
 		} else {
 
 		lv_obj_set_size(detail->gauges_container, LV_PCT(GAUGES_CONTAINER_WIDTH_PERCENT), LV_PCT(100));
@@ -489,7 +514,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	if (config->show_settings_button) {
 		detail->settings_section = lv_obj_create(detail->left_column);
 		if (!detail->settings_section) {
-			printf("[E] detail_screen: Failed to create settings_section\n");
+			LOG_E(TAG, "Failed to create settings_section");
 			return NULL; // Return early if creation failed
 		}
 		lv_obj_set_size(detail->settings_section, LV_PCT(100), LV_SIZE_CONTENT); // Content-based height
@@ -531,17 +556,17 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 
 		// Position Title for Settings section inline with the section's top border
 		lv_obj_align_to(settings_title, detail->settings_section, LV_ALIGN_OUT_TOP_LEFT, 20, 10);
-		printf("[I] detail_screen: Created settings title inline with section border\n");
+		LOG_I(TAG, "Created settings title inline with section border");
 
 		// Get the settings section dimensions for proper button sizing
 		lv_coord_t settings_width = lv_obj_get_width(detail->settings_section);
 		lv_coord_t settings_height = lv_obj_get_height(detail->settings_section);
-		printf("[I] detail_screen: Settings section size: %dx%d\n", settings_width, settings_height);
+		LOG_I(TAG, "Settings section size: %dx%d", settings_width, settings_height);
 
 		// If settings section height is 0, use a default value
 		if (settings_height <= 0) {
 			settings_height = 100; // Default height for settings section
-			printf("[W] detail_screen: Settings section height is 0, using default: %d\n", settings_height);
+			LOG_W(TAG, "Settings section height is 0, using default: %d", settings_height);
 		}
 
 		// Create main button container with flexbox layout
@@ -560,7 +585,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 		lv_obj_set_flex_align(main_button_container, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
 		// BACK button Left side
-		printf("[I] detail_screen: Creating BACK button\n");
+		LOG_I(TAG, "Creating BACK button");
 		detail->back_button = lv_btn_create(main_button_container);
 		lv_obj_set_size(detail->back_button, LV_PCT(49), LV_PCT(96));
 
@@ -579,7 +604,7 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 		lv_obj_clear_flag(detail->back_button, LV_OBJ_FLAG_SCROLLABLE);
 
 		lv_obj_add_event_cb(detail->back_button, back_button_event_cb, LV_EVENT_ALL, detail);
-		printf("[I] detail_screen: Added event callback for BACK button\n");
+		LOG_I(TAG, "Added event callback for BACK button");
 
 		lv_obj_t *back_label = lv_label_create(detail->back_button);
 		lv_label_set_text(back_label, "BACK");
@@ -682,62 +707,70 @@ detail_screen_t* detail_screen_create(const detail_screen_config_t* config)
 	return detail;
 }
 
-void detail_screen_show(detail_screen_t* detail)
+// Incremental construction: detail_screen_show() shows the skeleton sections built by
+// detail_screen_create(), then the module fills the current view, the gauges and the
+// sensor data one step each, so the first frame doesn't wait for all three.
+static ui_build_status_t detail_screen_build_step(void* ctx, int step)
 {
-	if (!detail) return;
+	detail_screen_t* detail = (detail_screen_t*)ctx;
 
-	// Show overlay root on top
-	if (detail->root && lv_obj_is_valid(detail->root)) {
-		lv_obj_clear_flag(detail->root, LV_OBJ_FLAG_HIDDEN);
-		lv_obj_move_foreground(detail->root);
-	} else {
-		printf("[E] detail_screen: Detail root container is NULL or invalid for module: %s\n", detail->module_name);
-		return;
-	}
-
-	// Create content in all containers using generic callbacks
-	// Create current view content directly in the current view container
-	if (detail->current_view_container) {
-		int child_count = lv_obj_get_child_cnt(detail->current_view_container);
-		// current view container child count
+	switch (step) {
+	case 0:
+		// Create current view content directly in the current view container
+		if (detail->current_view_container) {
 
-		// Prepare layout using reusable function
-		if (!detail_screen_prepare_current_view_layout(detail)) {
-			// failed to prepare layout
-			return;
-		}
+			// Prepare layout using reusable function
+			if (!detail_screen_prepare_current_view_layout(detail)) {
+				// failed to prepare layout
+				return UI_BUILD_DONE;
+			}
 
-		// Call the generic callback to create current view content
-		if (detail->on_current_view_created) {
-			detail->on_current_view_created(detail->current_view_container);
+			// Call the generic callback to create current view content
+			if (detail->on_current_view_created) {
+				detail->on_current_view_created(detail->current_view_container);
+			}
 		}
-	}
+		return UI_BUILD_CONTINUE;
 
-	// Create gauges content in the gauges container
-	if (detail->gauges_container) {
-		int gauges_child_count = lv_obj_get_child_cnt(detail->gauges_container);
-		if (gauges_child_count == 0) {
-			// creating gauges content
+	case 1:
+		// Create gauges content in the gauges container
+		if (detail->gauges_container && lv_obj_get_child_cnt(detail->gauges_container) == 0) {
 			// Call the generic callback to create gauges content
 			if (detail->on_gauges_created) {
 				detail->on_gauges_created(detail->gauges_container);
 			}
-		} else {
-			// skipping gauges content creation
 		}
-	}
+		return UI_BUILD_CONTINUE;
 
-	// Create sensor data content in the sensor data section
-	if (detail->sensor_data_section) {
-		if (lv_obj_get_child_cnt(detail->sensor_data_section) == 0) {
+	default:
+		// Create sensor data content in the sensor data section
+		if (detail->sensor_data_section && lv_obj_get_child_cnt(detail->sensor_data_section) == 0) {
 			// Call the generic callback to create sensor data content
 			if (detail->on_sensor_data_created) {
 				detail->on_sensor_data_created(detail->sensor_data_section);
 			}
 		}
+		return UI_BUILD_DONE;
 	}
 }
 
+void detail_screen_show(detail_screen_t* detail)
+{
+	if (!detail) return;
+
+	// Show overlay root on top
+	if (detail->root && lv_obj_is_valid(detail->root)) {
+		lv_obj_clear_flag(detail->root, LV_OBJ_FLAG_HIDDEN);
+		lv_obj_move_foreground(detail->root);
+	} else {
+		LOG_E(TAG, "Detail root container is NULL or invalid for module: %s", detail->module_name);
+		return;
+	}
+
+	// The skeleton is up; the module content follows one container per frame
+	ui_build_start(&detail->build, "detail_screen_build", detail_screen_build_step, detail, NULL);
+}
+
 void detail_screen_hide(detail_screen_t* detail)
 {
 	if (!detail) return;
@@ -759,6 +792,7 @@ void detail_screen_destroy(detail_screen_t* detail)
 {
 	if (!detail) return;
 
+	ui_build_cancel(&detail->build);
 
 	// Free dynamic buttons array
 	if (detail->setting_buttons) {
@@ -809,7 +843,7 @@ lv_obj_t* detail_screen_get_status_container(detail_screen_t* detail)
 void detail_screen_restore_current_view_styling(lv_obj_t* container)
 {
 	if (!container) {
-		printf("[E] detail_screen: Container is NULL in restore styling\n");
+		LOG_E(TAG, "Container is NULL in restore styling");
 		return;
 	}
 
@@ -845,7 +879,7 @@ void detail_screen_restore_current_view_styling(lv_obj_t* container)
 bool detail_screen_prepare_current_view_layout(detail_screen_t* detail)
 {
 	if (!detail || !detail->current_view_container || !detail->left_column) {
-		printf("[E] detail_screen: Invalid detail screen or containers in layout preparation\n");
+		LOG_E(TAG, "Invalid detail screen or containers in layout preparation");
 		return false;
 	}
 
@@ -2,6 +2,7 @@
 #define DETAIL_SCREEN_H
 
 #include <lvgl.h>
+#include "../../utils/ui_build.h"
 
 // Forward declaration for overlay (not used in Pi port)
 // typedef struct overlay_instance overlay_instance_t; // Removed to avoid conflicts
@@ -61,6 +62,8 @@ typedef struct {
 	void (*on_current_view_created)(lv_obj_t* container); // Callback when current view container is ready
 	void (*on_gauges_created)(lv_obj_t* container);       // Callback when gauges container is ready
 	void (*on_sensor_data_created)(lv_obj_t* container);  // Callback when sensor data container is ready
+
+	ui_build_job_t build;                // Runs the three callbacks above, one per step, after show
 } detail_screen_t;
 
 /**
@@ -161,10 +164,15 @@ bool detail_screen_prepare_current_view_layout(detail_screen_t* detail);
 
 /**
  * @brief Generic modal toggle function
+ *
+ * Modals are pooled: the first open (or detail_screen_prebuild_modal) builds the
+ * modal, later opens only rebind it (show_func) and closes only hide it.
+ *
  * @param modal_name Name of the modal to toggle
  * @param create_func Function to create the modal
  * @param destroy_func Function to destroy the modal
- * @param show_func Function to show the modal
+ * @param show_func Function to show the modal (reloads its values)
+ * @param hide_func Function to hide the modal
  * @param is_visible_func Function to check if modal is visible
  * @param config Configuration for the modal
  * @param on_close_callback Callback when modal is closed
@@ -173,10 +181,23 @@ void detail_screen_toggle_modal(const char* modal_name,
 	void* (*create_func)(void* config, void (*on_close)(void)),
 	void (*destroy_func)(void* modal),
 	void (*show_func)(void* modal),
+	void (*hide_func)(void* modal),
 	bool (*is_visible_func)(void* modal),
 	void* config,
 	void (*on_close_callback)(void));
 
+/**
+ * @brief Build a pooled modal ahead of its first open (hidden)
+ * @param modal_name Name of the modal, as passed to detail_screen_toggle_modal
+ */
+void detail_screen_prebuild_modal(const char* modal_name,
+	void* (*create_func)(void* config, void (*on_close)(void)),
+	void (*destroy_func)(void* modal),
+	void (*show_func)(void* modal),
+	void (*hide_func)(void* modal),
+	bool (*is_visible_func)(void* modal),
+	void* config);
+
 /**
  * @brief Check if a modal is currently visible
  * @param modal_name Name of the modal to check
@@ -185,10 +206,15 @@ void detail_screen_toggle_modal(const char* modal_name,
 bool detail_screen_is_modal_visible(const char* modal_name);
 
 /**
- * @brief Reset modal tracking system (call when detail screen is recreated)
+ * @brief Hide all pooled modals (call when detail screen is recreated)
  */
 void detail_screen_reset_modal_tracking(void);
 
+/**
+ * @brief Destroy all pooled modals (module cleanup)
+ */
+void detail_screen_destroy_modals(void);
+
 #ifdef __cplusplus
 }
 #endif
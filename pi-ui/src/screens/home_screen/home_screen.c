@@ -1,10 +1,14 @@
 #include <stdio.h>
 #include "home_screen.h"
 #include "../../lvgl_port_pi.h"
+#include "../../utils/time_source.h"
 #include "../../displayModules/power-monitor/power-monitor.h"
 #include "../../displayModules/shared/display_module_base.h"
+#include "../../fonts/app_fonts.h"
 #include "../../fonts/lv_font_noplato_10.h"
 #include "../../fonts/lv_font_noplato_18.h"
+#include "../../utils/log.h"
+#include "../../utils/ui_build.h"
 #include <lvgl.h>
 
 #include <stdio.h>
@@ -13,6 +17,11 @@
 
 static const char *TAG = "home_screen";
 
+// Glyphs drawn in the app fonts: the uptime clock
+static const app_font_glyphs_t view_glyphs[] = {
+	{ &lv_font_noplato_18, APP_FONT_GLYPHS_TIME },
+};
+
 // Track if home screen has been initialized
 static bool s_home_screen_initialized = false;
 
@@ -119,12 +128,16 @@ static lv_obj_t *uptime_time_label = NULL;
 static display_module_t display_modules[MAX_MODULES];
 static int module_count = 0;
 
+// Fills the module tiles after home_screen_init() put up the skeleton
+static ui_build_job_t s_build_job;
+static ui_build_status_t home_screen_build_step(void *ctx, int step);
+
 // Uptime timer callback
 static void uptime_timer_cb(lv_timer_t *timer)
 {
 	if (!uptime_time_label) return; // Update only the time numbers
 
-	time_t current_time = time(NULL); // Get actual system time
+	time_t current_time = time_source_wall(); // Get actual system time
 	time_t uptime_seconds = current_time - s_device_start_time;
 
 	// Convert to hours:minutes:seconds
@@ -160,7 +173,7 @@ static void display_module_init(display_module_t *module, lv_obj_t *parent, int
 	// Debug: Log the actual size after setting
 	lv_area_t area;
 	lv_obj_get_coords(module->container, &area);
-		printf("[W] home_screen: Home module created: requested=(%d,%d %dx%d) actual=(%d,%d %dx%d)\n",
+		LOG_W(TAG, "Home module created: requested=(%d,%d %dx%d) actual=(%d,%d %dx%d)",
 		x, y, width, height, area.x1, area.y1, lv_area_get_width(&area), lv_area_get_height(&area));
 	// Clear any default padding that might be causing the 17px offset
 	lv_obj_set_style_pad_all(module->container, 0, 0);
@@ -209,6 +222,8 @@ static void display_module_cleanup(display_module_t *module)
 
 void home_screen_init(void)
 {
+	app_fonts_prefetch(view_glyphs, (int)(sizeof(view_glyphs) / sizeof(view_glyphs[0])));
+
 	// Get display dimensions from LVGL port (NO individual screen configs!)
 	uint32_t screen_width, screen_height;
 	lvgl_port_get_display_size(&screen_width, &screen_height);
@@ -296,7 +311,7 @@ void home_screen_init(void)
 	lv_obj_align_to(uptime_time_label, telemetry_label, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
 
 	// Initialize device start time and create uptime timer
-	s_device_start_time = time(NULL); // Start time in actual system time
+	s_device_start_time = time_source_wall(); // Start time in actual system time
 	s_uptime_timer = lv_timer_create(uptime_timer_cb, 1000, NULL); // Update every second (1000ms)
 	lv_timer_set_repeat_count(s_uptime_timer, -1); // Repeat indefinitely
 
@@ -395,8 +410,8 @@ void home_screen_init(void)
 	lv_obj_set_style_text_color(message_count, lv_color_hex(0x888888), 0);
 	lv_obj_align(message_count, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
 
-	// Render all modules after they are created
-	home_screen_update_modules();
+	// The tiles are up; their module UIs follow one per step
+	ui_build_start(&s_build_job, "home_screen_build", home_screen_build_step, NULL, NULL);
 }
 
 void home_screen_update_status(const char *status)
@@ -462,6 +477,33 @@ void home_screen_update_context_panel(const char *connection_status, const char
 	// LVGL mutex unlock removed - no longer needed
 }
 
+// Creates a module's UI in its tile, once
+static void render_module(display_module_t *module)
+{
+	// Get the module's container
+	lv_obj_t *module_container = module->container;
+	if (!module_container || module->rendered_once) return;
+
+	if (strcmp(module->module_name, "power-monitor") == 0) {
+		// Use display_module_base lifecycle for power-monitor
+		extern void power_monitor_create(void);
+		extern display_module_base_t* power_monitor_get_module_base(void);
+
+		// Ensure module is created (idempotent)
+		power_monitor_create();
+
+		// Create UI in container
+		display_module_base_t* base = power_monitor_get_module_base();
+		if (base) {
+			display_module_base_create(base, module_container);
+		}
+	} else if (module->interface.renderCurrentView) {
+		// Legacy modules - use old interface
+		module->interface.renderCurrentView(module_container);
+	}
+	module->rendered_once = true;
+}
+
 void home_screen_update_modules(void)
 {
 	// Check if home screen is actually visible before updating
@@ -476,45 +518,29 @@ void home_screen_update_modules(void)
 
 	// Create module UIs on first render
 	for (int i = 0; i < module_count; i++) {
-		// Safety check - make sure the module is valid
-		if (i >= module_count || i < 0) {
-			break;
-		}
-
-		// Get the module's container
-		lv_obj_t *module_container = display_modules[i].container;
-		if (module_container) {
-			// Only create the module UI once
-			if (!display_modules[i].rendered_once) {
-				if (strcmp(display_modules[i].module_name, "power-monitor") == 0) {
-					// Use display_module_base lifecycle for power-monitor
-					extern void power_monitor_create(void);
-					extern display_module_base_t* power_monitor_get_module_base(void);
-
-					// Ensure module is created (idempotent)
-					power_monitor_create();
-
-					// Create UI in container
-					display_module_base_t* base = power_monitor_get_module_base();
-					if (base) {
-						display_module_base_create(base, module_container);
-					}
-				} else if (display_modules[i].interface.renderCurrentView) {
-					// Legacy modules - use old interface
-					display_modules[i].interface.renderCurrentView(module_container);
-				}
-				display_modules[i].rendered_once = true;
-			}
-		}
+		render_module(&display_modules[i]);
 	}
 }
 
+// Incremental construction: home_screen_init() builds the containers, the context panel
+// and the empty tiles, then each tile's module UI is created in its own step, so the
+// screen switch doesn't wait for every module in one frame.
+static ui_build_status_t home_screen_build_step(void *ctx, int step)
+{
+	(void)ctx;
+
+	if (step < module_count) render_module(&display_modules[step]);
+	return step + 1 < module_count ? UI_BUILD_CONTINUE : UI_BUILD_DONE;
+}
+
 
 
 
 
 void home_screen_cleanup(void)
 {
+	ui_build_cancel(&s_build_job);
+
 	// Cleanup uptime timer
 	if (s_uptime_timer) {
 		lv_timer_delete(s_uptime_timer);
@@ -560,6 +586,11 @@ void home_screen_destroy(void)
 	home_screen_cleanup();
 }
 
+struct ui_build_job* home_screen_build_job(void)
+{
+	return &s_build_job;
+}
+
 void home_screen_update_module_data(void)
 {
 	// Check if home screen is actually visible before updating data
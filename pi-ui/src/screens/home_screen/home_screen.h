@@ -22,6 +22,7 @@ void home_screen_cleanup(void);
 // Screen manager wrapper functions
 void home_screen_show(void);
 void home_screen_destroy(void);
+struct ui_build_job* home_screen_build_job(void);
 lv_obj_t* get_power_monitor_container(void);
 
 #ifdef __cplusplus
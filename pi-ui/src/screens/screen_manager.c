@@ -1,9 +1,13 @@
 #include <stdio.h>
 #include <time.h>
 #include "screen_manager.h"
+#include "screen_transition.h"
 #include "home_screen/home_screen.h"
 #include "../displayModules/power-monitor/power-monitor.h"
 #include "../lvgl_port_pi.h"
+#include "../utils/mem_region.h"
+#include "../utils/time_source.h"
+#include "../utils/log.h"
 
 #include <string.h>
 
@@ -22,25 +26,47 @@ static bool transition_pending = false;
 static uint32_t last_transition_time = 0;
 #define MIN_TRANSITION_INTERVAL_MS 50  // Minimum 50ms between transitions
 
+// Screen to create once the frame after the destroy is drawn (under the outgoing snapshot)
+static bool create_pending = false;
+static screen_type_t pending_screen_type = SCREEN_NONE;
+static char pending_module_name[32] = {0};
+static lv_timer_t *create_timer = NULL;
+
 // Screen definitions - all screens that can be created
 static const screen_definition_t screen_definitions[] = {
 	{
 		.screen_type = SCREEN_HOME,
 		.module_name = NULL,
 		.create_func = home_screen_show,
-		.destroy_func = home_screen_destroy
+		.destroy_func = home_screen_destroy,
+		.build_job_func = home_screen_build_job
 	},
 	{
 		.screen_type = SCREEN_DETAIL_VIEW,
 		.module_name = "power-monitor",
 		.create_func = power_monitor_show_detail_screen,
-		.destroy_func = power_monitor_destroy_detail_screen
+		.destroy_func = power_monitor_destroy_detail_screen,
+		.build_job_func = power_monitor_detail_build_job
 	}
 	// Add more screens here as needed
 };
 
 #define SCREEN_DEFINITIONS_COUNT (sizeof(screen_definitions) / sizeof(screen_definitions[0]))
 
+// One allocation region per screen definition: everything a screen's create (and its
+// build jobs) allocates lands there, and the region is dropped in one step once the
+// screen's tree is deleted. The detail screens finish deleting theirs from a deferred
+// timer, so a torn-down region is polled until its last block is freed; blocks still
+// live after REGION_TEARDOWN_TIMEOUT_MS outlived the screen and are logged as errors.
+#define REGION_TEARDOWN_TIMEOUT_MS 500
+#define REGION_POLL_MS 20
+static mem_region_t *screen_regions[SCREEN_DEFINITIONS_COUNT];
+static bool region_closing[SCREEN_DEFINITIONS_COUNT];
+static uint32_t region_closed_ms[SCREEN_DEFINITIONS_COUNT];
+static lv_timer_t *region_timer = NULL;
+static uint32_t regions_released = 0;
+static uint32_t regions_leaked = 0;
+
 /**
  * @brief Find screen definition by type and module name
  */
@@ -70,18 +96,71 @@ static const screen_definition_t* find_screen_definition(screen_type_t screen_ty
 	return NULL;
 }
 
+static const char *screen_region_name(size_t index)
+{
+	return screen_definitions[index].module_name ? screen_definitions[index].module_name : "home";
+}
+
+// Drops the region of a torn-down screen if nothing it allocated is live any more
+static bool release_screen_region(size_t index)
+{
+	if (!mem_region_reset(screen_regions[index])) return false;
+
+	region_closing[index] = false;
+	regions_released++;
+	return true;
+}
+
+static void region_timer_cb(lv_timer_t *timer)
+{
+	bool waiting = false;
+
+	for (size_t i = 0; i < SCREEN_DEFINITIONS_COUNT; i++) {
+
+		if (!region_closing[i] || release_screen_region(i)) continue;
+
+		if (time_source_ms() - region_closed_ms[i] < REGION_TEARDOWN_TIMEOUT_MS) {
+
+			waiting = true;
+			continue;
+		}
+
+		// A leak, or something that belongs in the global region (mem_region_push(NULL))
+		mem_region_stats_t stats;
+		mem_region_get_stats(screen_regions[i], &stats);
+		LOG_E(TAG, "%u blocks (%u KB) outlived the %s screen's teardown, region not reset",
+			(unsigned)stats.live_blocks, (unsigned)(stats.used_bytes / 1024), screen_region_name(i));
+		region_closing[i] = false;
+		regions_leaked++;
+	}
+
+	if (!waiting) lv_timer_pause(timer);
+}
+
+/**
+ * @brief After a screen's destroy: drop its region now or once its deferred teardown is done
+ */
+static void close_screen_region(const screen_definition_t *def)
+{
+	size_t index = (size_t)(def - screen_definitions);
+	if (!screen_regions[index] || release_screen_region(index)) return;
+
+	region_closing[index] = true;
+	region_closed_ms[index] = time_source_ms();
+	if (region_timer) lv_timer_resume(region_timer);
+}
+
 /**
  * @brief Destroy the current screen completely
  */
 static void destroy_current_screen(void)
 {
 	if (current_screen_type == SCREEN_NONE) {
-		printf("[D] screen_manager: No current screen to destroy\n");
+		LOG_D(TAG, "No current screen to destroy");
 		return;
 	}
 
-	printf(
-		"[I] screen_manager: Destroying current screen: type=%d, module=%s\n",
+	LOG_I(TAG, "Destroying current screen: type=%d, module=%s",
 		current_screen_type, current_module_name[0] ? current_module_name : "none"
 	);
 
@@ -94,19 +173,47 @@ static void destroy_current_screen(void)
 
 		def->destroy_func();
 	}
+	if (def) close_screen_region(def);
 
 	// Clear current screen state
 	current_screen_type = SCREEN_NONE;
 	memset(current_module_name, 0, sizeof(current_module_name));
 }
 
+/**
+ * @brief Region for a screen definition, empty unless its last visit is still tearing down
+ */
+static mem_region_t *enter_screen_region(const screen_definition_t *def)
+{
+	size_t index = (size_t)(def - screen_definitions);
+
+	if (!screen_regions[index]) {
+
+		screen_regions[index] = mem_region_create(screen_region_name(index));
+		return screen_regions[index];
+	}
+
+	mem_region_t *region = screen_regions[index];
+	if (region_closing[index] && !release_screen_region(index)) {
+
+		// Back before the last visit's deferred destroy ran: both share the region, and it
+		// is dropped after a later teardown that frees them all
+		mem_region_stats_t stats;
+		mem_region_get_stats(region, &stats);
+		LOG_W(TAG, "%u blocks (%u KB) of the last %s screen still live, region not reset",
+			(unsigned)stats.live_blocks, (unsigned)(stats.used_bytes / 1024), screen_region_name(index));
+		region_closing[index] = false;
+	}
+	return region;
+}
+
 /**
  * @brief Create and show a new screen
+ * @return The new screen's build job, NULL if it has none
  */
-static void create_and_show_screen(screen_type_t screen_type, const char *module_name)
+static struct ui_build_job *create_and_show_screen(screen_type_t screen_type, const char *module_name)
 {
-	printf(
-		"[I] screen_manager: Creating new screen: type=%d, module=%s\n",
+	LOG_I(TAG, "Creating new screen: type=%d, module=%s",
 		screen_type, module_name ? module_name : "none"
 	);
 
@@ -115,7 +222,7 @@ static void create_and_show_screen(screen_type_t screen_type, const char *module
 
 	if (!def || !def->create_func) {
 
-		return;
+		return NULL;
 	}
 
 	// Update current screen state BEFORE creating (in case create function checks it)
@@ -129,15 +236,56 @@ static void create_and_show_screen(screen_type_t screen_type, const char *module
 		memset(current_module_name, 0, sizeof(current_module_name));
 	}
 
-	// Create the new screen
+	// Create the new screen inside its region, emptied first
+	mem_region_t *region = enter_screen_region(def);
+	mem_region_push(region);
 	def->create_func();
+	mem_region_pop();
 
 	// Update global device state to match
 	screen_navigation_set_current_screen(screen_type, module_name);
+
+	return def->build_job_func ? def->build_job_func() : NULL;
+}
+
+static screen_transition_dir_t transition_dir(screen_type_t screen_type)
+{
+	return screen_type == SCREEN_HOME ? SCREEN_TRANSITION_BACK : SCREEN_TRANSITION_FORWARD;
+}
+
+static void create_timer_cb(lv_timer_t *timer)
+{
+	lv_timer_pause(timer);
+	if (!create_pending) return;
+
+	create_pending = false;
+	struct ui_build_job *build = create_and_show_screen(pending_screen_type, pending_module_name[0] ? pending_module_name : NULL);
+	screen_transition_start(transition_dir(pending_screen_type), build);
+}
+
+// The refresh after a destroy has been drawn: the create goes to the next timer pass
+static void refr_ready_cb(lv_event_t *e)
+{
+	(void)e;
+	if (create_pending && create_timer) lv_timer_resume(create_timer);
 }
 
 void screen_manager_init(void)
 {
+	// Snapshot buffers for animated switches
+	screen_transition_init();
+
+	if (!create_timer) {
+
+		create_timer = lv_timer_create(create_timer_cb, 0, NULL);
+		lv_timer_pause(create_timer);
+		lv_display_add_event_cb(lv_display_get_default(), refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+	}
+	if (!region_timer) {
+
+		region_timer = lv_timer_create(region_timer_cb, REGION_POLL_MS, NULL);
+		lv_timer_pause(region_timer);
+	}
 
 	// Initialize state
 	current_screen_type = SCREEN_NONE;
@@ -148,15 +296,14 @@ void screen_manager_init(void)
 	screen_type_t initial_screen = screen_navigation_get_current_screen();
 	const char *initial_module = screen_navigation_get_current_module();
 
-	printf(
-		"[I] screen_manager: Initial screen from state: type=%d, module=%s\n",
+	LOG_I(TAG, "Initial screen from state: type=%d, module=%s",
 		initial_screen, initial_module ? initial_module : "none"
 	);
 
 	// If no screen is set in state, default to home screen
 	if (initial_screen == SCREEN_NONE) {
 
-		printf("[I] screen_manager: No initial screen in state, defaulting to home screen\n");
+		LOG_I(TAG, "No initial screen in state, defaulting to home screen");
 		initial_screen = SCREEN_HOME;
 		initial_module = NULL;
 	}
@@ -174,9 +321,7 @@ void screen_manager_update(void)
 	}
 
 	// Check transition rate limiting
-	struct timespec ts;
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	uint32_t current_time = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+	uint32_t current_time = time_source_ms();
 
 	if (current_time - last_transition_time < MIN_TRANSITION_INTERVAL_MS) {
 
@@ -225,18 +370,61 @@ void screen_manager_show_screen(screen_type_t screen_type, const char *module_na
 		return;
 	}
 
+	// The outgoing screen stays up as a snapshot until the new one slides in
+	bool covered = screen_transition_capture();
+
 	// Step 1: Destroy current screen
 	destroy_current_screen();
 
-	// Step 2: Create new screen
-	create_and_show_screen(screen_type, module_name);
+	// Step 2: Create new screen. Under the snapshot that waits for the next frame, so
+	// the destroy and the create's skeleton never share one; the create's build jobs
+	// then run a slice per frame
+	if (covered) {
+
+		pending_screen_type = screen_type;
+		if (module_name) {
+
+			strncpy(pending_module_name, module_name, sizeof(pending_module_name) - 1);
+			pending_module_name[sizeof(pending_module_name) - 1] = '\0';
+		} else {
+
+			pending_module_name[0] = '\0';
+		}
+		create_pending = true;
+		return;
+	}
+	create_pending = false;
+	struct ui_build_job *build = create_and_show_screen(screen_type, module_name);
+
+	// Step 3: Slide it in once it is built (a no-op without a capture)
+	screen_transition_start(transition_dir(screen_type), build);
 }
 
 void screen_manager_cleanup(void)
 {
+	create_pending = false;
+	if (create_timer) {
+
+		lv_display_remove_event_cb_with_user_data(lv_display_get_default(), refr_ready_cb, NULL);
+		lv_timer_delete(create_timer);
+		create_timer = NULL;
+	}
 
 	// Destroy current screen
 	destroy_current_screen();
+	screen_transition_cleanup();
+
+	if (region_timer) {
+
+		lv_timer_delete(region_timer);
+		region_timer = NULL;
+	}
+}
+
+void screen_manager_get_region_counts(uint32_t *released, uint32_t *leaked)
+{
+	*released = regions_released;
+	*leaked = regions_leaked;
 }
 
 screen_type_t screen_navigation_get_current_screen(void)
@@ -26,6 +26,7 @@ typedef enum {
  * - Every screen transition creates the new screen from scratch
  * - No state is maintained between transitions (state is in device_state)
  * - Clean, predictable behavior with proper resource management
+ * - Switches are animated from snapshots of both screens (screen_transition.h)
  */
 
 // Screen creation function type - creates screen from scratch
@@ -34,12 +35,16 @@ typedef void (*screen_create_func_t)(void);
 // Screen destruction function type - completely destroys screen
 typedef void (*screen_destroy_func_t)(void);
 
+// The created screen's build job, which the transition waits for (NULL if it has none)
+typedef struct ui_build_job *(*screen_build_job_func_t)(void);
+
 // Screen definition
 typedef struct {
 	screen_type_t screen_type;
 	const char *module_name;  // NULL for non-module screens
 	screen_create_func_t create_func;
 	screen_destroy_func_t destroy_func;
+	screen_build_job_func_t build_job_func;  // Optional
 } screen_definition_t;
 
 /**
@@ -65,6 +70,12 @@ void screen_manager_show_screen(screen_type_t screen_type, const char *module_na
  */
 void screen_manager_cleanup(void);
 
+/**
+ * @brief Screen teardowns whose allocation region was reset, and those that left
+ * blocks behind (each logged as an error)
+ */
+void screen_manager_get_region_counts(uint32_t *released, uint32_t *leaked);
+
 
 // Screen navigation functions (for backward compatibility)
 screen_type_t screen_navigation_get_current_screen(void);
@@ -0,0 +1,319 @@
+#include "screen_transition.h"
+#include "../utils/log.h"
+#include "../utils/time_source.h"
+#include "../utils/trace.h"
+#include "../utils/ui_build.h"
+
+#include <lvgl.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "transition";
+
+#define TRANSITION_SLIDE_MS 220
+#define TRANSITION_BUILD_WAIT_MS 300    // Then the rest of the incoming build runs in one go
+#define TRANSITION_CAPTURE_TIMEOUT_MS 1000  // Capture never followed by a start
+#define TRANSITION_POLL_MS 5
+#define SNAPSHOT_ALIGN 64
+
+typedef enum {
+	TRANSITION_IDLE = 0,
+	TRANSITION_CAPTURED,    // Outgoing snapshot covers the screen
+	TRANSITION_WAITING,     // Incoming screen created, its build still running
+	TRANSITION_SLIDING,
+} transition_state_t;
+
+static bool enabled = true;
+static bool available = false;
+static transition_state_t state = TRANSITION_IDLE;
+static screen_transition_dir_t direction = SCREEN_TRANSITION_FORWARD;
+static ui_build_job_t *incoming_build = NULL;   // Owned by the incoming screen
+
+// 0 = outgoing, 1 = incoming
+static lv_draw_buf_t snapshots[2];
+static uint8_t *snapshot_data[2];
+static lv_obj_t *images[2];
+
+static lv_timer_t *poll_timer = NULL;
+static uint32_t phase_start_ms = 0;
+static uint32_t capture_ms = 0;
+static int32_t slide_width = 0;
+
+// Screen children hidden during the slide, shown again at the end; grows to the
+// largest child count seen
+static lv_obj_t **hidden_roots = NULL;
+static uint32_t hidden_root_capacity = 0;
+static int hidden_root_count = 0;
+
+// False (nothing hidden) if there is no room to remember the roots
+static bool hide_live_tree(void)
+{
+	lv_obj_t *scr = lv_screen_active();
+	uint32_t count = lv_obj_get_child_count(scr);
+
+	hidden_root_count = 0;
+	if (count > hidden_root_capacity) {
+
+		lv_obj_t **grown = realloc(hidden_roots, count * sizeof(*grown));
+		if (!grown) return false;
+		hidden_roots = grown;
+		hidden_root_capacity = count;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+
+		lv_obj_t *child = lv_obj_get_child(scr, i);
+		if (lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+		lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+		hidden_roots[hidden_root_count++] = child;
+	}
+	return true;
+}
+
+static void show_live_tree(void)
+{
+	for (int i = 0; i < hidden_root_count; i++) {
+
+		// Deferred destroys may have deleted a root during the slide
+		if (lv_obj_is_valid(hidden_roots[i])) lv_obj_remove_flag(hidden_roots[i], LV_OBJ_FLAG_HIDDEN);
+	}
+	hidden_root_count = 0;
+}
+
+static lv_obj_t *create_snapshot_image(lv_draw_buf_t *snapshot)
+{
+	// Same buffer, new pixels
+	lv_image_cache_drop(snapshot);
+
+	lv_obj_t *img = lv_image_create(lv_layer_top());
+	lv_image_set_src(img, snapshot);
+	lv_obj_set_pos(img, 0, 0);
+	lv_obj_add_flag(img, LV_OBJ_FLAG_CLICKABLE); // Swallows touches meant for the tree underneath
+	lv_obj_move_foreground(img);
+	return img;
+}
+
+static void slide_exec(void *var, int32_t value)
+{
+	(void)var;
+
+	if (direction == SCREEN_TRANSITION_BACK) {
+
+		lv_obj_set_x(images[0], value);
+		lv_obj_set_x(images[1], value - slide_width);
+	} else {
+
+		lv_obj_set_x(images[0], -value);
+		lv_obj_set_x(images[1], slide_width - value);
+	}
+}
+
+// Back to the live tree, whatever the current phase
+static void finish(void)
+{
+	lv_anim_delete(&slide_width, slide_exec);
+
+	if (poll_timer) lv_timer_pause(poll_timer);
+
+	for (int i = 0; i < 2; i++) {
+
+		if (images[i]) {
+
+			lv_obj_delete(images[i]);
+			images[i] = NULL;
+		}
+		lv_image_cache_drop(&snapshots[i]);
+	}
+	show_live_tree();
+	incoming_build = NULL;
+	state = TRANSITION_IDLE;
+}
+
+static void slide_completed(lv_anim_t *a)
+{
+	(void)a;
+
+	LOG_D(TAG, "Switched in %u ms", (unsigned)(time_source_ms() - capture_ms));
+	finish();
+}
+
+static void begin_slide(void)
+{
+	lv_timer_pause(poll_timer);
+
+	// Never snapshot a half-built screen: a build still running after the wait
+	// finishes here, in this one frame
+	if (incoming_build && ui_build_is_active(incoming_build)) {
+
+		LOG_W(TAG, "Incoming screen not built after %d ms, completing it", TRANSITION_BUILD_WAIT_MS);
+		ui_build_complete(incoming_build);
+	}
+
+	lv_obj_t *scr = lv_screen_active();
+	lv_obj_update_layout(scr);
+
+	TRACE_BEGIN("transition_snapshot_in");
+	lv_result_t res = lv_snapshot_take_to_draw_buf(scr, LV_COLOR_FORMAT_NATIVE, &snapshots[1]);
+	TRACE_END();
+	if (res != LV_RESULT_OK) {
+
+		LOG_W(TAG, "Incoming snapshot failed, showing the screen without a transition");
+		finish();
+		return;
+	}
+
+	// From here on only the two images are drawn
+	if (!hide_live_tree()) {
+
+		LOG_W(TAG, "No memory to hide the live tree, showing the screen without a transition");
+		finish();
+		return;
+	}
+	images[1] = create_snapshot_image(&snapshots[1]);
+
+	slide_width = lv_obj_get_width(scr);
+	slide_exec(NULL, 0);
+
+	lv_anim_t a;
+	lv_anim_init(&a);
+	lv_anim_set_var(&a, &slide_width);
+	lv_anim_set_values(&a, 0, slide_width);
+	lv_anim_set_duration(&a, TRANSITION_SLIDE_MS);
+	lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+	lv_anim_set_exec_cb(&a, slide_exec);
+	lv_anim_set_ready_cb(&a, slide_completed);
+	lv_anim_start(&a);
+
+	state = TRANSITION_SLIDING;
+}
+
+static void poll_timer_cb(lv_timer_t *timer)
+{
+	(void)timer;
+	uint32_t elapsed = time_source_ms() - phase_start_ms;
+
+	if (state == TRANSITION_CAPTURED) {
+
+		if (elapsed >= TRANSITION_CAPTURE_TIMEOUT_MS) {
+
+			LOG_W(TAG, "No screen followed the capture, dropping it");
+			finish();
+		}
+		return;
+	}
+
+	if (state != TRANSITION_WAITING) return;
+
+	// Only the incoming screen's own job counts: modal prebuilds may still be running
+	if (incoming_build && ui_build_is_active(incoming_build) && elapsed < TRANSITION_BUILD_WAIT_MS) return;
+
+	begin_slide();
+}
+
+static void start_polling(void)
+{
+	phase_start_ms = time_source_ms();
+	if (!poll_timer) {
+
+		poll_timer = lv_timer_create(poll_timer_cb, TRANSITION_POLL_MS, NULL);
+	} else {
+
+		lv_timer_resume(poll_timer);
+	}
+}
+
+void screen_transition_set_enabled(bool on)
+{
+	enabled = on;
+}
+
+void screen_transition_init(void)
+{
+	if (!enabled || available) return;
+
+	lv_obj_t *scr = lv_screen_active();
+	lv_obj_update_layout(scr);
+	int32_t width = lv_obj_get_width(scr);
+	int32_t height = lv_obj_get_height(scr);
+	uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_NATIVE);
+	uint32_t size = stride * height;
+
+	for (int i = 0; i < 2; i++) {
+
+		void *data = NULL;
+		if (posix_memalign(&data, SNAPSHOT_ALIGN, size) != 0) {
+
+			LOG_W(TAG, "No memory for snapshots (%u KB), switching screens without transitions", (unsigned)(size / 1024));
+			screen_transition_cleanup();
+			return;
+		}
+		snapshot_data[i] = data;
+		lv_draw_buf_init(&snapshots[i], width, height, LV_COLOR_FORMAT_NATIVE, stride, data, size);
+	}
+
+	available = true;
+	LOG_I(TAG, "Snapshots %dx%d, %u KB each", (int)width, (int)height, (unsigned)(size / 1024));
+}
+
+void screen_transition_cleanup(void)
+{
+	if (state != TRANSITION_IDLE) finish();
+
+	if (poll_timer) {
+
+		lv_timer_delete(poll_timer);
+		poll_timer = NULL;
+	}
+	free(hidden_roots);
+	hidden_roots = NULL;
+	hidden_root_capacity = 0;
+
+	for (int i = 0; i < 2; i++) {
+
+		free(snapshot_data[i]);
+		snapshot_data[i] = NULL;
+		memset(&snapshots[i], 0, sizeof(snapshots[i]));
+	}
+	available = false;
+}
+
+bool screen_transition_capture(void)
+{
+	if (!available) return false;
+	if (state == TRANSITION_CAPTURED) return true;
+	if (state != TRANSITION_IDLE) finish();
+
+	lv_obj_t *scr = lv_screen_active();
+	lv_obj_update_layout(scr);
+
+	TRACE_BEGIN("transition_snapshot_out");
+	lv_result_t res = lv_snapshot_take_to_draw_buf(scr, LV_COLOR_FORMAT_NATIVE, &snapshots[0]);
+	TRACE_END();
+	if (res != LV_RESULT_OK) {
+
+		LOG_W(TAG, "Outgoing snapshot failed, switching without a transition");
+		return false;
+	}
+
+	images[0] = create_snapshot_image(&snapshots[0]);
+	state = TRANSITION_CAPTURED;
+	capture_ms = time_source_ms();
+	start_polling();
+	return true;
+}
+
+void screen_transition_start(screen_transition_dir_t dir, struct ui_build_job *build)
+{
+	if (state != TRANSITION_CAPTURED) return;
+
+	direction = dir;
+	incoming_build = build;
+	state = TRANSITION_WAITING;
+	start_polling();
+}
+
+bool screen_transition_is_active(void)
+{
+	return state != TRANSITION_IDLE;
+}
@@ -0,0 +1,55 @@
+#ifndef SCREEN_TRANSITION_H
+#define SCREEN_TRANSITION_H
+
+#include <stdbool.h>
+
+struct ui_build_job;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Snapshot-based screen transitions
+ *
+ * Before the screen manager destroys the outgoing screen it is captured into a
+ * snapshot shown on the top layer, so the destroy/create frame never shows. The
+ * incoming screen is built underneath; once it is laid out and its ui_build job
+ * is done it is captured too, the live tree is hidden and the two snapshots slide
+ * across as plain image blits. The live tree comes back when the slide ends.
+ *
+ * The snapshots use two full-screen buffers taken once from the system heap, outside
+ * the screens' allocation regions, so they outlive every screen visit and are never
+ * part of a region reset. Without them (or when disabled) screens switch instantly.
+ * LVGL thread only.
+ */
+
+typedef enum {
+	SCREEN_TRANSITION_FORWARD = 0,  // Incoming screen slides in from the right
+	SCREEN_TRANSITION_BACK,         // Incoming screen slides in from the left
+} screen_transition_dir_t;
+
+// Before screen_transition_init(); on by default
+void screen_transition_set_enabled(bool enabled);
+
+// Allocates the snapshot buffers for the active screen's size
+void screen_transition_init(void);
+void screen_transition_cleanup(void);
+
+// Captures the active screen and covers it with the snapshot. Screens that tear
+// themselves down before requesting the switch call this first; a second capture
+// before screen_transition_start() is a no-op. A running transition is cut short.
+bool screen_transition_capture(void);
+
+// After the incoming screen was created: slides it in once incoming_build (its own
+// job, NULL if it has none) is done, or after a bounded wait with the rest of the
+// build run first. Without a capture this does nothing.
+void screen_transition_start(screen_transition_dir_t dir, struct ui_build_job *incoming_build);
+
+bool screen_transition_is_active(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCREEN_TRANSITION_H
@@ -1,4 +1,7 @@
 #include "device_state.h"
+#include "../utils/time_source.h"
+#include "../utils/trace.h"
+#include "../utils/log.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,6 +10,8 @@
 #include <sys/stat.h>
 #include <errno.h>
 
+static const char *TAG = "device_state";
+
 // Global device state
 static cJSON *g_root = NULL;
 
@@ -45,7 +50,7 @@ static void ensure_state_directory_exists(void) {
 
 		// Create directory with 0755 permissions (rwxr-xr-x)
 		if (mkdir(dir_path, 0755) != 0 && errno != EEXIST) {
-			printf("[W] device_state: Failed to create directory %s: %s\n", dir_path, strerror(errno));
+			LOG_W(TAG, "Failed to create directory %s: %s", dir_path, strerror(errno));
 		}
 	}
 
@@ -54,12 +59,12 @@ static void ensure_state_directory_exists(void) {
 
 // Initialize device state with default values
 void device_state_init(void) {
-	printf("[I] device_state: Initializing device state\n");
+	LOG_I(TAG, "Initializing device state");
 
 	// Create root JSON object
 	g_root = cJSON_CreateObject();
 	if (!g_root) {
-		printf("[E] device_state: Failed to create root JSON object\n");
+		LOG_E(TAG, "Failed to create root JSON object");
 		return;
 	}
 
@@ -79,7 +84,7 @@ void device_state_init(void) {
 	cJSON *system = cJSON_CreateObject();
 	if (system) {
 		cJSON_AddBoolToObject(system, "initialized", true);
-		cJSON_AddNumberToObject(system, "last_save_timestamp", (uint32_t)time(NULL));
+		cJSON_AddNumberToObject(system, "last_save_timestamp", (uint32_t)time_source_wall());
 		cJSON_AddItemToObject(g_root, "system", system);
 	}
 
@@ -89,7 +94,7 @@ void device_state_init(void) {
 
 // Cleanup device state
 void device_state_cleanup(void) {
-	printf("[I] device_state: Cleaning up JSON device state\n");
+	LOG_I(TAG, "Cleaning up JSON device state");
 	if (g_root) {
 		cJSON_Delete(g_root);
 		g_root = NULL;
@@ -285,8 +290,10 @@ int device_state_get_float_array(const char* path, float* out_values, int max_co
 
 // Save device state to JSON file
 void device_state_save(void) {
+	TRACE_SCOPE("device_state_save");
+
 	if (!g_root) {
-		printf("[W] device_state: Cannot save - not initialized\n");
+		LOG_W(TAG, "Cannot save - not initialized");
 		return;
 	}
 
@@ -298,20 +305,20 @@ void device_state_save(void) {
 	if (system_obj && cJSON_IsObject(system_obj)) {
 		cJSON* timestamp_obj = cJSON_GetObjectItemCaseSensitive(system_obj, "last_save_timestamp");
 		if (timestamp_obj && cJSON_IsNumber(timestamp_obj)) {
-			cJSON_SetNumberValue(timestamp_obj, (double)time(NULL));
+			cJSON_SetNumberValue(timestamp_obj, (double)time_source_wall());
 		}
 	}
 
 	// Write to file
 	char *json_string = cJSON_Print(g_root);
 	if (!json_string) {
-		printf("[E] device_state: Failed to convert JSON to string\n");
+		LOG_E(TAG, "Failed to convert JSON to string");
 		return;
 	}
 
 	FILE *file = fopen(get_state_file_path(), "w");
 	if (!file) {
-		printf("[E] device_state: Failed to open state file for writing: %s\n", get_state_file_path());
+		LOG_E(TAG, "Failed to open state file for writing: %s", get_state_file_path());
 		free(json_string);
 		return;
 	}
@@ -325,15 +332,15 @@ void device_state_save(void) {
 // Load device state from JSON file
 void device_state_load(void) {
 	if (!g_root) {
-		printf("[W] device_state: Cannot load - not initialized\n");
+		LOG_W(TAG, "Cannot load - not initialized");
 		return;
 	}
 
-	printf("[I] device_state: Loading device state from JSON file\n");
+	LOG_I(TAG, "Loading device state from JSON file");
 
 	FILE *file = fopen(get_state_file_path(), "r");
 	if (!file) {
-		printf("[W] device_state: State file not found, using defaults: %s\n", get_state_file_path());
+		LOG_W(TAG, "State file not found, using defaults: %s", get_state_file_path());
 		return;
 	}
 
@@ -343,7 +350,7 @@ void device_state_load(void) {
 	fseek(file, 0, SEEK_SET);
 
 	if (file_size <= 0) {
-		printf("[W] device_state: State file is empty, using defaults\n");
+		LOG_W(TAG, "State file is empty, using defaults");
 		fclose(file);
 		return;
 	}
@@ -351,7 +358,7 @@ void device_state_load(void) {
 	// Read file content
 	char *json_string = malloc(file_size + 1);
 	if (!json_string) {
-		printf("[E] device_state: Failed to allocate memory for JSON string\n");
+		LOG_E(TAG, "Failed to allocate memory for JSON string");
 		fclose(file);
 		return;
 	}
@@ -365,7 +372,7 @@ void device_state_load(void) {
 	free(json_string);
 
 	if (!loaded_root) {
-		printf("[E] device_state: Failed to parse JSON: %s\n", cJSON_GetErrorPtr());
+		LOG_E(TAG, "Failed to parse JSON: %s", cJSON_GetErrorPtr());
 		return;
 	}
 
@@ -373,7 +380,7 @@ void device_state_load(void) {
 	cJSON_Delete(g_root);
 	g_root = loaded_root;
 
-	printf("[I] device_state: Device state loaded successfully\n");
+	LOG_I(TAG, "Device state loaded successfully");
 }
 
 
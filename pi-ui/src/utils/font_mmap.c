@@ -0,0 +1,639 @@
+#include "font_mmap.h"
+#include "log.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *TAG = "font_mmap";
+
+/* ===== File format ===== */
+// lv_font_conv --format bin, as read by LVGL's lv_binfont_loader: tables "head", "cmap",
+// "loca", "glyf" and optionally "kern", each starting with its length (including the
+// 8-byte table header) and label. Little endian, like every target this runs on.
+
+typedef struct {
+	uint32_t version;
+	uint16_t tables_count;
+	uint16_t font_size;
+	uint16_t ascent;
+	int16_t descent;
+	uint16_t typo_ascent;
+	int16_t typo_descent;
+	uint16_t typo_line_gap;
+	int16_t min_y;
+	int16_t max_y;
+	uint16_t default_advance_width;
+	uint16_t kerning_scale;
+	uint8_t index_to_loc_format;
+	uint8_t glyph_id_format;
+	uint8_t advance_width_format;
+	uint8_t bits_per_pixel;
+	uint8_t xy_bits;
+	uint8_t wh_bits;
+	uint8_t advance_width_bits;
+	uint8_t compression_id;
+	uint8_t subpixels_mode;
+	uint8_t padding;
+	int16_t underline_position;
+	uint16_t underline_thickness;
+} bin_head_t;
+
+typedef struct {
+	uint32_t data_offset;
+	uint32_t range_start;
+	uint16_t range_length;
+	uint16_t glyph_id_start;
+	uint16_t data_entries_count;
+	uint8_t format_type;
+	uint8_t padding;
+} bin_cmap_t;
+
+#define TABLE_HEADER_SIZE 8
+#define MAP_SIZE_MAX (1u << 20)     // lv_font_fmt_txt_glyph_dsc_t.bitmap_index is 20 bits
+
+/* ===== Loaded fonts ===== */
+
+typedef struct alloc_block {
+	struct alloc_block *next;
+	max_align_t data[];
+} alloc_block_t;
+
+typedef struct font_mmap {
+	struct font_mmap *next;
+	lv_font_t *font;
+	char name[48];
+
+	const uint8_t *map;
+	size_t map_size;
+	bin_head_t head;
+	uint32_t head_bits;            // Size of a glyph's header in the glyph table
+
+	lv_font_fmt_txt_dsc_t dsc;
+	lv_font_fmt_txt_kern_pair_t kern_pairs;
+	lv_font_fmt_txt_kern_classes_t kern_classes;
+
+	const uint8_t *glyf;           // Glyph table, table header included (loca offsets count from it)
+	uint32_t glyf_size;
+	const uint32_t *loca;
+	uint32_t glyph_count;
+
+	// Decoded on first use; ready[id] is set (release) once glyph id is
+	lv_font_fmt_txt_glyph_dsc_t *glyphs;
+	uint8_t *bitmaps;              // Headers that aren't whole bytes: bitmaps shifted in here, at their loca offset
+	atomic_uchar *ready;
+	pthread_mutex_t decode_lock;
+
+	alloc_block_t *blocks;
+	size_t heap_bytes;
+	atomic_uint prefetched;
+	atomic_uint lazy;
+} font_mmap_t;
+
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static font_mmap_t *registry = NULL;
+
+static bool glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next);
+
+// Zeroed, freed with the font
+static void *font_alloc(font_mmap_t *fm, size_t bytes)
+{
+	alloc_block_t *block = calloc(1, sizeof(alloc_block_t) + bytes);
+	if (!block) return NULL;
+
+	block->next = fm->blocks;
+	fm->blocks = block;
+	fm->heap_bytes += bytes;
+	return block->data;
+}
+
+static void font_destroy(font_mmap_t *fm)
+{
+	while (fm->blocks) {
+
+		alloc_block_t *next = fm->blocks->next;
+		free(fm->blocks);
+		fm->blocks = next;
+	}
+	if (fm->map) munmap((void *)fm->map, fm->map_size);
+	pthread_mutex_destroy(&fm->decode_lock);
+	free(fm);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+	uint16_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t read_u32(const uint8_t *p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+// Table length (header included) if a table with this label starts at offset, else -1
+static int32_t table_at(const font_mmap_t *fm, size_t offset, const char *label)
+{
+	if (offset + TABLE_HEADER_SIZE > fm->map_size) return -1;
+
+	uint32_t length = read_u32(fm->map + offset);
+	if (memcmp(fm->map + offset + 4, label, 4) != 0) return -1;
+	if (length < TABLE_HEADER_SIZE || length > fm->map_size - offset) return -1;
+	return (int32_t)length;
+}
+
+// uint16_t lists are used in place when aligned, copied otherwise
+static const uint16_t *u16_list(font_mmap_t *fm, const uint8_t *data, uint32_t count)
+{
+	if (((uintptr_t)data & 1) == 0) return (const uint16_t *)(const void *)data;
+
+	uint16_t *copy = font_alloc(fm, (size_t)count * sizeof(uint16_t));
+	if (copy) memcpy(copy, data, (size_t)count * sizeof(uint16_t));
+	return copy;
+}
+
+/* ===== Tables ===== */
+
+static int32_t parse_cmaps(font_mmap_t *fm, size_t start)
+{
+	int32_t length = table_at(fm, start, "cmap");
+	if (length < TABLE_HEADER_SIZE + 4) return -1;
+
+	const uint8_t *table = fm->map + start;
+	uint32_t count = read_u32(table + TABLE_HEADER_SIZE);
+	if (count == 0 || count > 511 || TABLE_HEADER_SIZE + 4 + (size_t)count * sizeof(bin_cmap_t) > (size_t)length) return -1;
+
+	lv_font_fmt_txt_cmap_t *cmaps = font_alloc(fm, count * sizeof(*cmaps));
+	if (!cmaps) return -1;
+
+	for (uint32_t i = 0; i < count; i++) {
+
+		bin_cmap_t entry;
+		memcpy(&entry, table + TABLE_HEADER_SIZE + 4 + i * sizeof(bin_cmap_t), sizeof(entry));
+
+		size_t entries = entry.data_entries_count;
+		size_t data_size = 0;
+		switch (entry.format_type) {
+			case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: data_size = entries; break;
+			case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: data_size = entries * 4; break;
+			case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: data_size = entries * 2; break;
+			case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY: break;
+			default: return -1;
+		}
+		if (entry.data_offset > (uint32_t)length || data_size > (size_t)length - entry.data_offset) return -1;
+
+		const uint8_t *data = table + entry.data_offset;
+		lv_font_fmt_txt_cmap_t *cmap = &cmaps[i];
+		cmap->range_start = entry.range_start;
+		cmap->range_length = entry.range_length;
+		cmap->glyph_id_start = entry.glyph_id_start;
+		cmap->type = entry.format_type;
+
+		switch (entry.format_type) {
+			case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+				cmap->glyph_id_ofs_list = data;
+				cmap->list_length = entry.range_length;
+				break;
+			case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+			case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+				cmap->unicode_list = u16_list(fm, data, entry.data_entries_count);
+				cmap->list_length = entry.data_entries_count;
+				if (!cmap->unicode_list) return -1;
+				if (entry.format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+
+					cmap->glyph_id_ofs_list = u16_list(fm, data + entries * 2, entry.data_entries_count);
+					if (!cmap->glyph_id_ofs_list) return -1;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	fm->dsc.cmaps = cmaps;
+	fm->dsc.cmap_num = count;
+	return length;
+}
+
+static int32_t parse_loca(font_mmap_t *fm, size_t start)
+{
+	int32_t length = table_at(fm, start, "loca");
+	if (length < TABLE_HEADER_SIZE + 4) return -1;
+
+	const uint8_t *table = fm->map + start;
+	uint32_t count = read_u32(table + TABLE_HEADER_SIZE);
+	size_t entry_size = fm->head.index_to_loc_format ? 4 : 2;
+	if (count == 0 || TABLE_HEADER_SIZE + 4 + count * entry_size > (size_t)length) return -1;
+
+	uint32_t *loca = font_alloc(fm, count * sizeof(uint32_t));
+	if (!loca) return -1;
+
+	const uint8_t *entries = table + TABLE_HEADER_SIZE + 4;
+	for (uint32_t i = 0; i < count; i++) {
+		loca[i] = entry_size == 4 ? read_u32(entries + i * 4) : read_u16(entries + i * 2);
+	}
+
+	fm->loca = loca;
+	fm->glyph_count = count;
+	return length;
+}
+
+static int32_t parse_kern(font_mmap_t *fm, size_t start)
+{
+	int32_t length = table_at(fm, start, "kern");
+	if (length < TABLE_HEADER_SIZE + 4) return -1;
+
+	const uint8_t *table = fm->map + start;
+	uint8_t format = table[TABLE_HEADER_SIZE];  // Then 3 bytes of padding
+	const uint8_t *data = table + TABLE_HEADER_SIZE + 4;
+	size_t available = (size_t)length - TABLE_HEADER_SIZE - 4;
+
+	if (format == 0) {
+
+		// Sorted glyph id pairs, then one value per pair
+		if (available < 4) return -1;
+		uint32_t pairs = read_u32(data);
+		size_t ids_size = (size_t)pairs * (fm->head.glyph_id_format ? 4 : 2);
+		if (4 + ids_size + pairs > available) return -1;
+
+		fm->kern_pairs.glyph_ids = fm->head.glyph_id_format ? (const void *)u16_list(fm, data + 4, pairs * 2) : (const void *)(data + 4);
+		fm->kern_pairs.values = (const int8_t *)(data + 4 + ids_size);
+		fm->kern_pairs.pair_cnt = pairs;
+		fm->kern_pairs.glyph_ids_size = fm->head.glyph_id_format;
+		if (!fm->kern_pairs.glyph_ids) return -1;
+
+		fm->dsc.kern_dsc = &fm->kern_pairs;
+		fm->dsc.kern_classes = 0;
+	} else if (format == 3) {
+
+		// Left and right class of each glyph, then a rows x cols value table
+		if (available < 4) return -1;
+		uint16_t mapping_length = read_u16(data);
+		uint8_t rows = data[2];
+		uint8_t cols = data[3];
+		if (4 + 2 * (size_t)mapping_length + (size_t)rows * cols > available) return -1;
+
+		fm->kern_classes.left_class_mapping = data + 4;
+		fm->kern_classes.right_class_mapping = data + 4 + mapping_length;
+		fm->kern_classes.class_pair_values = (const int8_t *)(data + 4 + 2 * mapping_length);
+		fm->kern_classes.left_class_cnt = rows;
+		fm->kern_classes.right_class_cnt = cols;
+
+		fm->dsc.kern_dsc = &fm->kern_classes;
+		fm->dsc.kern_classes = 1;
+	} else {
+
+		return -1;
+	}
+	return length;
+}
+
+static bool parse_font(font_mmap_t *fm)
+{
+	int32_t head_length = table_at(fm, 0, "head");
+	if (head_length < TABLE_HEADER_SIZE + (int32_t)sizeof(bin_head_t)) return false;
+	memcpy(&fm->head, fm->map + TABLE_HEADER_SIZE, sizeof(bin_head_t));
+
+	const bin_head_t *head = &fm->head;
+	uint8_t bpp = head->bits_per_pixel;
+	if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) return false;
+
+	// Glyphs are decoded as plain bitmaps: convert with --no-compress
+	if (head->compression_id != 0) {
+
+		LOG_W(TAG, "%s: compressed glyph bitmaps (compression %u) are not supported", fm->name, (unsigned)head->compression_id);
+		return false;
+	}
+
+	size_t cmap_start = (size_t)head_length;
+	int32_t cmap_length = parse_cmaps(fm, cmap_start);
+	if (cmap_length < 0) return false;
+
+	size_t loca_start = cmap_start + (size_t)cmap_length;
+	int32_t loca_length = parse_loca(fm, loca_start);
+	if (loca_length < 0) return false;
+
+	size_t glyf_start = loca_start + (size_t)loca_length;
+	int32_t glyf_length = table_at(fm, glyf_start, "glyf");
+	if (glyf_length < 0) return false;
+	fm->glyf = fm->map + glyf_start;
+	fm->glyf_size = (uint32_t)glyf_length;
+
+	for (uint32_t i = 1; i < fm->glyph_count; i++) {
+		if (fm->loca[i] < TABLE_HEADER_SIZE || fm->loca[i] >= fm->glyf_size) return false;
+	}
+
+	size_t kern_start = glyf_start + (size_t)glyf_length;
+	if (head->tables_count >= 4 && kern_start < fm->map_size && parse_kern(fm, kern_start) < 0) return false;
+
+	fm->glyphs = font_alloc(fm, fm->glyph_count * sizeof(*fm->glyphs));
+	fm->ready = font_alloc(fm, fm->glyph_count * sizeof(*fm->ready));
+	if (!fm->glyphs || !fm->ready) return false;
+	atomic_store(&fm->ready[0], 1); // Glyph 0 is "no glyph"
+
+	fm->head_bits = head->advance_width_bits + 2u * head->xy_bits + 2u * head->wh_bits;
+	if (fm->head_bits % 8) {
+
+		// Only the pages of glyphs that get decoded are ever touched
+		fm->bitmaps = font_alloc(fm, fm->glyf_size);
+		if (!fm->bitmaps) return false;
+	}
+
+	fm->dsc.glyph_bitmap = fm->bitmaps ? fm->bitmaps : fm->map;
+	fm->dsc.glyph_dsc = fm->glyphs;
+	fm->dsc.kern_scale = head->kerning_scale;
+	fm->dsc.bpp = bpp;
+	fm->dsc.bitmap_format = LV_FONT_FMT_TXT_PLAIN;
+	return true;
+}
+
+/* ===== Glyphs ===== */
+
+// Bit reader over the glyph table, MSB first like lv_font_conv writes it
+typedef struct {
+	const uint8_t *data;
+	size_t size;
+	size_t bit;
+} bit_reader_t;
+
+static uint32_t read_bits(bit_reader_t *reader, uint32_t count)
+{
+	uint32_t value = 0;
+	while (count--) {
+
+		size_t byte = reader->bit >> 3;
+		uint8_t bits = byte < reader->size ? reader->data[byte] : 0;
+		value = (value << 1) | ((bits >> (7 - (reader->bit & 7))) & 1u);
+		reader->bit++;
+	}
+	return value;
+}
+
+static int32_t read_bits_signed(bit_reader_t *reader, uint32_t count)
+{
+	uint32_t value = read_bits(reader, count);
+	if (count && (value & (1u << (count - 1)))) value |= ~0u << count;
+	return (int32_t)value;
+}
+
+static void glyph_decode(font_mmap_t *fm, uint32_t id)
+{
+	const bin_head_t *head = &fm->head;
+	uint32_t offset = fm->loca[id];
+	uint32_t next = id + 1 < fm->glyph_count ? fm->loca[id + 1] : fm->glyf_size;
+	bit_reader_t reader = { fm->glyf + offset, next > offset ? next - offset : 0, 0 };
+
+	lv_font_fmt_txt_glyph_dsc_t *glyph = &fm->glyphs[id];
+	uint32_t adv_w = head->advance_width_bits ? read_bits(&reader, head->advance_width_bits) : head->default_advance_width;
+	glyph->adv_w = head->advance_width_format == 0 ? adv_w * 16 : adv_w;
+	glyph->ofs_x = (int8_t)read_bits_signed(&reader, head->xy_bits);
+	glyph->ofs_y = (int8_t)read_bits_signed(&reader, head->xy_bits);
+	glyph->box_w = (uint8_t)read_bits(&reader, head->wh_bits);
+	glyph->box_h = (uint8_t)read_bits(&reader, head->wh_bits);
+
+	size_t bitmap_size = reader.size > fm->head_bits / 8 ? reader.size - fm->head_bits / 8 : 0;
+	if (!glyph->box_w || !glyph->box_h || !bitmap_size) return;
+
+	if (!fm->bitmaps) {
+
+		// Bitmap right after the header, in the mapping: fault its pages in now
+		size_t start = (size_t)(fm->glyf - fm->map) + offset + fm->head_bits / 8;
+		glyph->bitmap_index = (uint32_t)start;
+		volatile uint8_t sink = 0;
+		for (size_t i = 0; i < bitmap_size; i += 1024) sink ^= fm->map[start + i];
+		sink ^= fm->map[start + bitmap_size - 1];
+		(void)sink;
+		return;
+	}
+
+	// Shift the bitmap onto a byte boundary, the way lv_binfont_loader does
+	uint8_t *out = fm->bitmaps + offset;
+	for (size_t i = 0; i + 1 < bitmap_size; i++) {
+		out[i] = (uint8_t)read_bits(&reader, 8);
+	}
+	uint32_t tail_bits = 8 - fm->head_bits % 8;
+	out[bitmap_size - 1] = (uint8_t)(read_bits(&reader, tail_bits) << (8 - tail_bits));
+	glyph->bitmap_index = offset;
+}
+
+static int compare_u16(const void *key, const void *item)
+{
+	return (int)*(const uint16_t *)key - (int)*(const uint16_t *)item;
+}
+
+// Same lookup as lv_font_fmt_txt; 0 if the font has no such letter
+static uint32_t glyph_id(const font_mmap_t *fm, uint32_t letter)
+{
+	for (uint32_t i = 0; i < fm->dsc.cmap_num; i++) {
+
+		const lv_font_fmt_txt_cmap_t *cmap = &fm->dsc.cmaps[i];
+		uint32_t rcp = letter - cmap->range_start;
+		if (rcp >= cmap->range_length) continue;
+
+		if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) return cmap->glyph_id_start + rcp;
+		if (cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+			return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+		}
+
+		uint16_t key = (uint16_t)rcp;
+		const uint16_t *found = bsearch(&key, cmap->unicode_list, cmap->list_length, sizeof(uint16_t), compare_u16);
+		if (!found) continue;
+
+		size_t index = (size_t)(found - cmap->unicode_list);
+		if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + index;
+		return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[index];
+	}
+	return 0;
+}
+
+// Decodes glyph id unless done already; true if this call did it
+static bool glyph_page_in(font_mmap_t *fm, uint32_t id, bool prefetch)
+{
+	if (id >= fm->glyph_count) return false;
+	if (atomic_load_explicit(&fm->ready[id], memory_order_acquire)) return false;
+
+	pthread_mutex_lock(&fm->decode_lock);
+	bool fresh = !atomic_load_explicit(&fm->ready[id], memory_order_relaxed);
+	if (fresh) {
+
+		glyph_decode(fm, id);
+		atomic_store_explicit(&fm->ready[id], 1, memory_order_release);
+	}
+	pthread_mutex_unlock(&fm->decode_lock);
+
+	if (fresh && prefetch) {
+
+		atomic_fetch_add_explicit(&fm->prefetched, 1, memory_order_relaxed);
+	} else if (fresh) {
+
+		atomic_fetch_add_explicit(&fm->lazy, 1, memory_order_relaxed);
+		LOG_D(TAG, "%s: glyph %u first drawn without a prefetch", fm->name, (unsigned)id);
+	}
+	return fresh;
+}
+
+// Runs on the UI thread and on draw units, ahead of every glyph bitmap lookup
+static bool glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter, uint32_t letter_next)
+{
+	font_mmap_t *fm = font->user_data;
+	glyph_page_in(fm, glyph_id(fm, letter == '\t' ? ' ' : letter), false);
+	return lv_font_get_glyph_dsc_fmt_txt(font, dsc_out, letter, letter_next);
+}
+
+static uint32_t utf8_next(const char **text)
+{
+	const uint8_t *p = (const uint8_t *)*text;
+	uint32_t letter = *p++;
+	int extra = letter < 0xC0 ? 0 : letter < 0xE0 ? 1 : letter < 0xF0 ? 2 : 3;
+	if (extra) letter &= 0x3Fu >> extra;
+	for (int i = 0; i < extra && (*p & 0xC0) == 0x80; i++) {
+		letter = (letter << 6) | (*p++ & 0x3Fu);
+	}
+	*text = (const char *)p;
+	return letter;
+}
+
+/* ===== API ===== */
+
+bool font_mmap_load(lv_font_t *font, const char *path)
+{
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+
+		LOG_E(TAG, "%s: %s", path, strerror(errno));
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < TABLE_HEADER_SIZE + (off_t)sizeof(bin_head_t) || st.st_size >= MAP_SIZE_MAX) {
+
+		LOG_E(TAG, "%s: not a binary font under %u KB", path, MAP_SIZE_MAX / 1024);
+		close(fd);
+		return false;
+	}
+
+	void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+
+		LOG_E(TAG, "%s: mmap failed: %s", path, strerror(errno));
+		return false;
+	}
+	// Glyphs are looked up one by one: don't read ahead the rest of the file on each fault
+	madvise(map, (size_t)st.st_size, MADV_RANDOM);
+
+	font_mmap_t *fm = calloc(1, sizeof(*fm));
+	if (!fm) {
+
+		munmap(map, (size_t)st.st_size);
+		return false;
+	}
+	fm->map = map;
+	fm->map_size = (size_t)st.st_size;
+	pthread_mutex_init(&fm->decode_lock, NULL);
+	const char *base = strrchr(path, '/');
+	snprintf(fm->name, sizeof(fm->name), "%s", base ? base + 1 : path);
+
+	if (!parse_font(fm)) {
+
+		LOG_E(TAG, "%s: unsupported or corrupt binary font", path);
+		font_destroy(fm);
+		return false;
+	}
+
+	memset(font, 0, sizeof(*font));
+	font->get_glyph_dsc = glyph_dsc_cb;
+	font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+	font->line_height = fm->head.ascent - fm->head.descent;
+	font->base_line = -fm->head.descent;
+	font->subpx = fm->head.subpixels_mode;
+	font->underline_position = (int8_t)fm->head.underline_position;
+	font->underline_thickness = (int8_t)fm->head.underline_thickness;
+	font->dsc = &fm->dsc;
+	font->user_data = fm;
+	fm->font = font;
+
+	pthread_mutex_lock(&registry_lock);
+	fm->next = registry;
+	registry = fm;
+	pthread_mutex_unlock(&registry_lock);
+
+	LOG_I(TAG, "%s: %u glyphs, %zu KB mapped, %zu B decoded at load%s", fm->name, (unsigned)fm->glyph_count,
+		fm->map_size / 1024, fm->heap_bytes, fm->bitmaps ? ", bitmaps shifted on first use" : "");
+	return true;
+}
+
+void font_mmap_release(lv_font_t *font)
+{
+	if (!font_mmap_is_mapped(font)) return;
+
+	font_mmap_t *fm = font->user_data;
+	pthread_mutex_lock(&registry_lock);
+	for (font_mmap_t **link = &registry; *link; link = &(*link)->next) {
+
+		if (*link == fm) {
+
+			*link = fm->next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&registry_lock);
+
+	memset(font, 0, sizeof(*font));
+	font_destroy(fm);
+}
+
+bool font_mmap_is_mapped(const lv_font_t *font)
+{
+	return font && font->get_glyph_dsc == glyph_dsc_cb;
+}
+
+uint32_t font_mmap_prefetch(const lv_font_t *font, const char *utf8)
+{
+	if (!font_mmap_is_mapped(font) || !utf8) return 0;
+
+	font_mmap_t *fm = font->user_data;
+	uint32_t fresh = 0;
+	while (*utf8) {
+
+		if (glyph_page_in(fm, glyph_id(fm, utf8_next(&utf8)), true)) fresh++;
+	}
+	return fresh;
+}
+
+void font_mmap_get_stats(font_mmap_stats_t *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+	pthread_mutex_lock(&registry_lock);
+	for (font_mmap_t *fm = registry; fm; fm = fm->next) {
+
+		stats->fonts++;
+		stats->file_bytes += fm->map_size;
+		stats->heap_bytes += fm->heap_bytes;
+		stats->glyphs_prefetched += atomic_load_explicit(&fm->prefetched, memory_order_relaxed);
+		stats->glyphs_lazy += atomic_load_explicit(&fm->lazy, memory_order_relaxed);
+
+		size_t pages = (fm->map_size + page - 1) / page;
+		unsigned char *resident = malloc(pages);
+		if (resident && mincore((void *)fm->map, fm->map_size, resident) == 0) {
+
+			for (size_t i = 0; i < pages; i++) {
+				if (resident[i] & 1) stats->resident_bytes += page;
+			}
+		}
+		free(resident);
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
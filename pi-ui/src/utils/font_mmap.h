@@ -0,0 +1,47 @@
+#ifndef FONT_MMAP_H
+#define FONT_MMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL binary fonts (lv_font_conv --format bin) served straight from a read-only
+// shared mapping of the file: nothing of the font is in the executable, the page cache
+// copy is shared between processes, and only the header, character maps, glyph offsets
+// and kerning are read at load. A glyph's descriptor is decoded, and its bitmap paged
+// in, the first time the glyph is looked up. Views declare the glyphs they draw and
+// prefetch them when they are built, so those page faults happen there instead of
+// mid-frame; glyphs drawn without a prefetch are counted (glyphs_lazy) and logged at
+// debug level so a missing declaration shows up.
+
+// Maps path into font (which must outlive the mapping). Leaves font untouched and
+// returns false if the file is missing or not a font LVGL can draw.
+bool font_mmap_load(lv_font_t *font, const char *path);
+void font_mmap_release(lv_font_t *font);
+bool font_mmap_is_mapped(const lv_font_t *font);
+
+// Decodes and pages in the glyphs of utf8 (any thread). Returns how many were new;
+// always 0 for compiled-in fonts.
+uint32_t font_mmap_prefetch(const lv_font_t *font, const char *utf8);
+
+typedef struct {
+	int fonts;
+	size_t file_bytes;         // Mapped font files
+	size_t resident_bytes;     // Of those, in RAM now (mincore)
+	size_t heap_bytes;         // Descriptors, character maps and decoded bitmaps
+	uint32_t glyphs_prefetched;
+	uint32_t glyphs_lazy;      // Decoded on first draw: not in any view's declared subset
+} font_mmap_stats_t;
+
+void font_mmap_get_stats(font_mmap_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_MMAP_H
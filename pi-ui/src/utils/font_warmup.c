@@ -0,0 +1,84 @@
+#include "font_warmup.h"
+#include "font_mmap.h"
+
+#include <stdint.h>
+#include <unistd.h>
+
+// Highest glyph id a character map can produce (ids start at 1)
+static uint32_t cmap_last_glyph(const lv_font_fmt_txt_cmap_t *cmap)
+{
+	uint32_t last_ofs = 0;
+	switch (cmap->type) {
+		case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+			last_ofs = cmap->range_length ? cmap->range_length - 1u : 0;
+			break;
+		case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+			last_ofs = cmap->list_length ? cmap->list_length - 1u : 0;
+			break;
+		case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+			const uint8_t *ofs = cmap->glyph_id_ofs_list;
+			for (uint32_t i = 0; i < cmap->range_length; i++) {
+				if (ofs[i] > last_ofs) last_ofs = ofs[i];
+			}
+			break;
+		}
+		case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+			const uint16_t *ofs = cmap->glyph_id_ofs_list;
+			for (uint32_t i = 0; i < cmap->list_length; i++) {
+				if (ofs[i] > last_ofs) last_ofs = ofs[i];
+			}
+			break;
+		}
+	}
+	return cmap->glyph_id_start + last_ofs;
+}
+
+static size_t touch_pages(const uint8_t *start, size_t bytes, size_t page)
+{
+	volatile uint8_t sink = 0;
+	for (size_t offset = 0; offset < bytes; offset += page) {
+		sink ^= start[offset];
+	}
+	if (bytes) sink ^= start[bytes - 1];
+	(void)sink;
+	return bytes;
+}
+
+size_t font_warmup(const lv_font_t *const *fonts, int count)
+{
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t total = 0;
+
+	for (int f = 0; f < count; f++) {
+
+		// Mapped fonts page in glyph by glyph (font_mmap_prefetch)
+		if (font_mmap_is_mapped(fonts[f])) continue;
+
+		const lv_font_fmt_txt_dsc_t *dsc = fonts[f] ? fonts[f]->dsc : NULL;
+		if (!dsc || !dsc->glyph_bitmap || !dsc->glyph_dsc) continue;
+
+		uint32_t last_glyph = 0;
+		for (uint32_t c = 0; c < dsc->cmap_num; c++) {
+
+			uint32_t last = cmap_last_glyph(&dsc->cmaps[c]);
+			if (last > last_glyph) last_glyph = last;
+		}
+
+		// Glyphs are usually stored in id order, but don't rely on it
+		size_t bitmap_end = 0;
+		for (uint32_t id = 1; id <= last_glyph; id++) {
+
+			const lv_font_fmt_txt_glyph_dsc_t *glyph = &dsc->glyph_dsc[id];
+			size_t end = glyph->bitmap_index;
+			if (dsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+				// Compressed glyphs have no known size: stop at their start
+				end += ((size_t)glyph->box_w * glyph->box_h * dsc->bpp + 7) / 8;
+			}
+			if (end > bitmap_end) bitmap_end = end;
+		}
+
+		total += touch_pages((const uint8_t *)dsc->glyph_dsc, (last_glyph + 1) * sizeof(*dsc->glyph_dsc), page);
+		total += touch_pages(dsc->glyph_bitmap, bitmap_end, page);
+	}
+	return total;
+}
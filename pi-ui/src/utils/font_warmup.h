@@ -0,0 +1,22 @@
+#ifndef FONT_WARMUP_H
+#define FONT_WARMUP_H
+
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Compiled-in fonts live in the executable's read-only data and are paged in from
+// disk on first touch, which otherwise happens mid-frame the first time a glyph is
+// drawn. Reading one byte per page of each font's glyph data ahead of time moves those
+// page faults off the UI thread. Only touches lv_font_fmt_txt data (read-only, safe
+// from any thread); returns the bytes covered.
+size_t font_warmup(const lv_font_t *const *fonts, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_WARMUP_H
@@ -0,0 +1,342 @@
+#include "log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+static const char *TAG = "log";
+
+#define LOG_WRITER_PERIOD_MS 20             // Writer wakes at least this often
+#define LOG_TAG_LEVELS_MAX 32
+#define LOG_BATCH_BYTES 16384               // Written to stdout in one go
+
+atomic_uint_fast32_t log_generation = 1;
+
+/* ===== Runtime levels ===== */
+
+typedef struct {
+	char tag[32];
+	log_level_t level;
+} log_tag_level_t;
+
+static pthread_mutex_t levels_mutex = PTHREAD_MUTEX_INITIALIZER;
+static log_level_t default_level = LOG_DEFAULT_LEVEL;
+static log_tag_level_t tag_levels[LOG_TAG_LEVELS_MAX];
+static int tag_level_count = 0;
+
+log_level_t log_site_refresh(log_site_t *site, const char *tag)
+{
+	uint32_t generation = (uint32_t)atomic_load(&log_generation);
+
+	pthread_mutex_lock(&levels_mutex);
+	log_level_t level = default_level;
+	for (int i = 0; i < tag_level_count; i++) {
+
+		if (strcmp(tag_levels[i].tag, tag) == 0) {
+			level = tag_levels[i].level;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&levels_mutex);
+
+	// Changed meanwhile: the stale generation makes the next call read it again
+	atomic_store_explicit(&site->state, (generation << 8) | (uint32_t)level, memory_order_relaxed);
+	return level;
+}
+
+// Generation lives in the upper 24 bits of each site's state; 0 is never used
+static void levels_changed(void)
+{
+	uint32_t next = ((uint32_t)atomic_load(&log_generation) + 1) & 0xFFFFFF;
+	atomic_store(&log_generation, next ? next : 1);
+}
+
+void log_set_level(log_level_t level)
+{
+	pthread_mutex_lock(&levels_mutex);
+	default_level = level;
+	pthread_mutex_unlock(&levels_mutex);
+	levels_changed();
+}
+
+void log_set_tag_level(const char *tag, log_level_t level)
+{
+	pthread_mutex_lock(&levels_mutex);
+	int i = 0;
+	while (i < tag_level_count && strcmp(tag_levels[i].tag, tag) != 0) i++;
+
+	if (i == LOG_TAG_LEVELS_MAX) {
+
+		pthread_mutex_unlock(&levels_mutex);
+		log_write(LOG_LEVEL_WARN, TAG, "Too many tag levels, ignoring %s", tag);
+		return;
+	}
+	if (i == tag_level_count) {
+
+		snprintf(tag_levels[i].tag, sizeof(tag_levels[i].tag), "%s", tag);
+		tag_level_count++;
+	}
+	tag_levels[i].level = level;
+	pthread_mutex_unlock(&levels_mutex);
+	levels_changed();
+}
+
+static bool parse_level(const char *name, log_level_t *level)
+{
+	static const char *names[] = { "none", "error", "warn", "info", "debug", "verbose" };
+	for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+
+		if (strcmp(name, names[i]) == 0) {
+			*level = (log_level_t)i;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool log_configure(const char *spec)
+{
+	char copy[256];
+	snprintf(copy, sizeof(copy), "%s", spec);
+
+	// Check everything before applying anything
+	for (int pass = 0; pass < 2; pass++) {
+
+		char buffer[256];
+		memcpy(buffer, copy, sizeof(buffer));
+
+		char *save = NULL;
+		for (char *item = strtok_r(buffer, ",", &save); item; item = strtok_r(NULL, ",", &save)) {
+
+			log_level_t level;
+			char *equals = strchr(item, '=');
+			if (equals) *equals = '\0';
+			if (!parse_level(equals ? equals + 1 : item, &level) || (equals && equals == item)) {
+				return false;
+			}
+
+			if (pass == 1) {
+
+				if (equals) {
+					log_set_tag_level(item, level);
+				} else {
+					log_set_level(level);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/* ===== Ring ===== */
+
+// Bounded MPSC queue: a slot is free for position p when seq == p, holds the message
+// for p when seq == p + 1, and is handed back as p + LOG_RING_SLOTS
+typedef struct {
+	atomic_uint seq;
+	uint8_t level;
+	const char *tag;
+	char text[LOG_MESSAGE_MAX];
+} log_slot_t;
+
+static log_slot_t slots[LOG_RING_SLOTS];
+static atomic_uint enqueue_pos;
+static unsigned dequeue_pos;                // Under drain_mutex
+static atomic_bool ring_active = false;
+static atomic_uint dropped = 0;
+static unsigned dropped_reported = 0;       // Under drain_mutex
+
+static pthread_mutex_t drain_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t writer_thread;
+static sem_t writer_wake;
+static atomic_bool writer_stop = false;
+
+static char level_char(log_level_t level)
+{
+	switch (level) {
+		case LOG_LEVEL_ERROR:   return 'E';
+		case LOG_LEVEL_WARN:    return 'W';
+		case LOG_LEVEL_INFO:    return 'I';
+		case LOG_LEVEL_DEBUG:   return 'D';
+		case LOG_LEVEL_VERBOSE: return 'V';
+		default:                return '?';
+	}
+}
+
+void log_write(log_level_t level, const char *tag, const char *fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+
+	if (!atomic_load_explicit(&ring_active, memory_order_acquire)) {
+
+		char text[LOG_MESSAGE_MAX];
+		vsnprintf(text, sizeof(text), fmt, args);
+		va_end(args);
+		printf("[%c] %s: %s\n", level_char(level), tag, text);
+		return;
+	}
+
+	// Claim a slot; give up rather than wait when the writer is behind
+	log_slot_t *slot;
+	unsigned pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+	while (true) {
+
+		slot = &slots[pos & (LOG_RING_SLOTS - 1)];
+		int diff = (int)(atomic_load_explicit(&slot->seq, memory_order_acquire) - pos);
+		if (diff == 0) {
+
+			if (atomic_compare_exchange_weak_explicit(&enqueue_pos, &pos, pos + 1,
+				memory_order_relaxed, memory_order_relaxed)) break;
+		} else if (diff < 0) {
+
+			va_end(args);
+			atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+			return;
+		} else {
+
+			pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+		}
+	}
+
+	slot->level = (uint8_t)level;
+	slot->tag = tag;
+	vsnprintf(slot->text, sizeof(slot->text), fmt, args);
+	va_end(args);
+	atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+
+	// Problems show up right away rather than on the next writer period
+	if (level <= LOG_LEVEL_WARN) {
+		sem_post(&writer_wake);
+	}
+}
+
+static char batch[LOG_BATCH_BYTES];         // Under drain_mutex
+static size_t batch_used = 0;
+
+static void batch_append(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static void batch_append(const char *fmt, ...)
+{
+	if (batch_used + LOG_MESSAGE_MAX + 64 > sizeof(batch)) {
+
+		fwrite(batch, 1, batch_used, stdout);
+		batch_used = 0;
+	}
+
+	va_list args;
+	va_start(args, fmt);
+	int len = vsnprintf(batch + batch_used, sizeof(batch) - batch_used, fmt, args);
+	va_end(args);
+
+	// Truncated at the end of the batch
+	if (len > 0) batch_used += (size_t)len < sizeof(batch) - batch_used ? (size_t)len : sizeof(batch) - batch_used - 1;
+}
+
+static void drain(void)
+{
+	pthread_mutex_lock(&drain_mutex);
+	while (true) {
+
+		log_slot_t *slot = &slots[dequeue_pos & (LOG_RING_SLOTS - 1)];
+		if (atomic_load_explicit(&slot->seq, memory_order_acquire) != dequeue_pos + 1) break;
+
+		batch_append("[%c] %s: %s\n", level_char((log_level_t)slot->level), slot->tag, slot->text);
+		atomic_store_explicit(&slot->seq, dequeue_pos + LOG_RING_SLOTS, memory_order_release);
+		dequeue_pos++;
+	}
+
+	unsigned lost = atomic_load_explicit(&dropped, memory_order_relaxed);
+	if (lost != dropped_reported) {
+
+		batch_append("[W] %s: %u messages dropped (ring full)\n", TAG, lost - dropped_reported);
+		dropped_reported = lost;
+	}
+
+	if (batch_used) {
+
+		fwrite(batch, 1, batch_used, stdout);
+		fflush(stdout);
+		batch_used = 0;
+	}
+	pthread_mutex_unlock(&drain_mutex);
+}
+
+static void *writer_main(void *arg)
+{
+	(void)arg;
+
+	while (!atomic_load(&writer_stop)) {
+
+		drain();
+
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += LOG_WRITER_PERIOD_MS * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+		while (sem_timedwait(&writer_wake, &deadline) != 0 && errno == EINTR) {}
+	}
+
+	drain();
+	return NULL;
+}
+
+void log_init(void)
+{
+	if (atomic_load(&ring_active)) return;
+
+	for (unsigned i = 0; i < LOG_RING_SLOTS; i++) {
+		atomic_store_explicit(&slots[i].seq, i, memory_order_relaxed);
+	}
+	atomic_store(&enqueue_pos, 0);
+	dequeue_pos = 0;
+	atomic_store(&writer_stop, false);
+	sem_init(&writer_wake, 0, 0);
+
+	if (pthread_create(&writer_thread, NULL, writer_main, NULL) != 0) {
+
+		printf("[E] %s: Cannot start writer thread, logging synchronously\n", TAG);
+		return;
+	}
+
+	// Everything printed so far goes out before the first queued message
+	fflush(stdout);
+	atomic_store_explicit(&ring_active, true, memory_order_release);
+
+	static bool registered = false;
+	if (!registered) {
+		atexit(log_shutdown);
+		registered = true;
+	}
+}
+
+void log_shutdown(void)
+{
+	if (!atomic_exchange(&ring_active, false)) return;
+
+	atomic_store(&writer_stop, true);
+	sem_post(&writer_wake);
+	pthread_join(writer_thread, NULL);
+	sem_destroy(&writer_wake);
+}
+
+void log_flush(void)
+{
+	if (atomic_load(&ring_active)) {
+		drain();
+	} else {
+		fflush(stdout);
+	}
+}
+
+uint32_t log_dropped(void)
+{
+	return atomic_load_explicit(&dropped, memory_order_relaxed);
+}
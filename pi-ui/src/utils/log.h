@@ -0,0 +1,103 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Leveled logging that keeps stdio off the UI thread.
+//
+//   static const char *TAG = "power_grid_view";
+//   LOG_D(TAG, "Computed power bounds for %s", base_name);
+//
+// prints "[D] power_grid_view: Computed power bounds for ..." (newline added) like the
+// printf lines elsewhere. Calls above LOG_MAX_LEVEL are removed at compile time; the
+// rest are checked against the runtime level of their tag, cached per call site, so a
+// suppressed call costs a load and two compares. Enabled calls are formatted by the
+// caller into a lock-free ring, and a background thread writes them to stdout in
+// batches. When the ring is full, messages are dropped (and counted) instead of blocking.
+// Before log_init() and after log_shutdown() messages are written synchronously.
+
+typedef enum {
+	LOG_LEVEL_NONE = 0,
+	LOG_LEVEL_ERROR,
+	LOG_LEVEL_WARN,
+	LOG_LEVEL_INFO,
+	LOG_LEVEL_DEBUG,
+	LOG_LEVEL_VERBOSE,
+} log_level_t;
+
+// Highest level compiled in (cmake -DPI_UI_LOG_MAX_LEVEL=INFO strips DEBUG and VERBOSE)
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+#define LOG_DEFAULT_LEVEL LOG_LEVEL_INFO
+#define LOG_RING_SLOTS 1024                 // Power of two
+#define LOG_MESSAGE_MAX 240                 // Longer messages are truncated
+
+// Start the writer thread; flushed and stopped by log_shutdown() (also registered with atexit)
+void log_init(void);
+void log_shutdown(void);
+
+// Write everything queued so far (blocks until written)
+void log_flush(void);
+
+// Runtime levels: default for all tags, or per tag (tag strings are compared, not pointers)
+void log_set_level(log_level_t level);
+void log_set_tag_level(const char *tag, log_level_t level);
+
+// "info", "real_data=debug,positioning=warn" or "warn,power_grid_view=verbose";
+// level names are none, error, warn, info, debug, verbose. Returns false if malformed.
+bool log_configure(const char *spec);
+
+// Messages lost to a full ring since start
+uint32_t log_dropped(void);
+
+void log_write(log_level_t level, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+/* ===== Call sites ===== */
+
+// Cached level of the tag and the configuration generation it was read at
+typedef struct {
+	atomic_uint_fast32_t state;             // generation << 8 | level; 0 = not read yet
+} log_site_t;
+
+extern atomic_uint_fast32_t log_generation; // Starts at 1, bumped on every level change
+
+log_level_t log_site_refresh(log_site_t *site, const char *tag);
+
+static inline bool log_site_enabled(log_site_t *site, const char *tag, log_level_t level)
+{
+	uint32_t state = (uint32_t)atomic_load_explicit(&site->state, memory_order_relaxed);
+	if ((state >> 8) != (uint32_t)atomic_load_explicit(&log_generation, memory_order_relaxed)) {
+
+		return level <= log_site_refresh(site, tag);
+	}
+	return level <= (log_level_t)(state & 0xFF);
+}
+
+#define LOG_AT(level, tag, fmt, ...) do { \
+	if ((level) <= LOG_MAX_LEVEL) { \
+		static log_site_t log_site_; \
+		if (log_site_enabled(&log_site_, (tag), (level))) { \
+			log_write((level), (tag), fmt, ##__VA_ARGS__); \
+		} \
+	} \
+} while (0)
+
+#define LOG_E(tag, fmt, ...) LOG_AT(LOG_LEVEL_ERROR, tag, fmt, ##__VA_ARGS__)
+#define LOG_W(tag, fmt, ...) LOG_AT(LOG_LEVEL_WARN, tag, fmt, ##__VA_ARGS__)
+#define LOG_I(tag, fmt, ...) LOG_AT(LOG_LEVEL_INFO, tag, fmt, ##__VA_ARGS__)
+#define LOG_D(tag, fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, tag, fmt, ##__VA_ARGS__)
+#define LOG_V(tag, fmt, ...) LOG_AT(LOG_LEVEL_VERBOSE, tag, fmt, ##__VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,353 @@
+#include "mem_region.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOCK_ALIGN 16
+#define SIZE_CLASSES (MEM_REGION_SMALL_MAX / BLOCK_ALIGN)
+#define LARGE_CLASS 0xFFFFFFFFu
+
+// In front of every block; BLOCK_ALIGN bytes so the payload stays aligned
+typedef struct {
+	mem_region_t *region;
+	uint32_t size_class;        // Payload is (size_class + 1) * BLOCK_ALIGN, or LARGE_CLASS
+	uint32_t size;              // Requested bytes
+} block_header_t;
+
+#define HEADER_SIZE BLOCK_ALIGN
+_Static_assert(sizeof(block_header_t) <= HEADER_SIZE, "block header must fit in one alignment unit");
+
+typedef struct chunk {
+	struct chunk *next;
+} chunk_t;
+
+#define CHUNK_HEADER_SIZE BLOCK_ALIGN
+
+struct mem_region {
+	const char *name;
+	bool shared;                // Global only: the one region other threads allocate from
+	pthread_mutex_t lock;       // Taken only when shared
+	chunk_t *chunks;            // Newest first; the oldest is kept by a reset
+	uint8_t *bump;
+	uint8_t *bump_end;
+	void *free_lists[SIZE_CLASSES];
+	mem_region_stats_t stats;
+	mem_region_t *next;         // Registry, for the totals
+};
+
+static mem_region_t global_region = {
+	.name = "global",
+	.shared = true,
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static mem_region_t *registry = NULL;
+
+static _Thread_local mem_region_t *scope_stack[MEM_REGION_DEPTH];
+static _Thread_local int scope_depth = 0;
+
+// A screen region is only touched from the LVGL thread (under the LVGL lock), so only
+// the global region pays for the mutex
+static inline void region_lock(mem_region_t *region)
+{
+	if (region->shared) pthread_mutex_lock(&region->lock);
+}
+
+static inline void region_unlock(mem_region_t *region)
+{
+	if (region->shared) pthread_mutex_unlock(&region->lock);
+}
+
+static inline block_header_t *header_of(void *ptr)
+{
+	return (block_header_t *)((uint8_t *)ptr - HEADER_SIZE);
+}
+
+static inline size_t class_payload(uint32_t size_class)
+{
+	return (size_t)(size_class + 1) * BLOCK_ALIGN;
+}
+
+static void count_alloc(mem_region_t *region, size_t bytes, bool large)
+{
+	region->stats.live_blocks++;
+	region->stats.used_bytes += bytes;
+	if (large) region->stats.large_bytes += bytes;
+	if (region->stats.used_bytes > region->stats.max_used_bytes) region->stats.max_used_bytes = region->stats.used_bytes;
+}
+
+static void count_free(mem_region_t *region, size_t bytes, bool large)
+{
+	region->stats.live_blocks--;
+	region->stats.used_bytes -= bytes;
+	if (large) region->stats.large_bytes -= bytes;
+}
+
+// Region locked
+static bool add_chunk(mem_region_t *region)
+{
+	void *mem = NULL;
+	if (posix_memalign(&mem, BLOCK_ALIGN, MEM_REGION_CHUNK_SIZE) != 0) return false;
+
+	chunk_t *chunk = mem;
+	chunk->next = region->chunks;
+	region->chunks = chunk;
+	region->bump = (uint8_t *)mem + CHUNK_HEADER_SIZE;
+	region->bump_end = (uint8_t *)mem + MEM_REGION_CHUNK_SIZE;
+	region->stats.chunk_bytes += MEM_REGION_CHUNK_SIZE;
+	return true;
+}
+
+static void *alloc_large(mem_region_t *region, size_t size)
+{
+	void *mem = NULL;
+	if (posix_memalign(&mem, BLOCK_ALIGN, HEADER_SIZE + size) != 0) return NULL;
+
+	block_header_t *header = mem;
+	header->region = region;
+	header->size_class = LARGE_CLASS;
+	header->size = (uint32_t)size;
+
+	region_lock(region);
+	count_alloc(region, HEADER_SIZE + size, true);
+	region_unlock(region);
+	return (uint8_t *)mem + HEADER_SIZE;
+}
+
+void *mem_region_alloc(mem_region_t *region, size_t size)
+{
+	if (!region) region = &global_region;
+	if (size == 0) size = 1;
+	if (size > MEM_REGION_SMALL_MAX) return alloc_large(region, size);
+
+	uint32_t size_class = (uint32_t)((size - 1) / BLOCK_ALIGN);
+	size_t block_bytes = HEADER_SIZE + class_payload(size_class);
+
+	region_lock(region);
+
+	uint8_t *block = region->free_lists[size_class];
+	if (block) {
+
+		region->free_lists[size_class] = *(void **)(block + HEADER_SIZE);
+		region->stats.free_list_bytes -= block_bytes;
+	} else {
+
+		if ((size_t)(region->bump_end - region->bump) < block_bytes && !add_chunk(region)) {
+
+			region_unlock(region);
+			return NULL;
+		}
+		block = region->bump;
+		region->bump += block_bytes;
+	}
+	count_alloc(region, block_bytes, false);
+
+	region_unlock(region);
+
+	block_header_t *header = (block_header_t *)block;
+	header->region = region;
+	header->size_class = size_class;
+	header->size = (uint32_t)size;
+	return block + HEADER_SIZE;
+}
+
+void mem_region_free(void *ptr)
+{
+	if (!ptr) return;
+
+	block_header_t *header = header_of(ptr);
+	mem_region_t *region = header->region;
+
+	if (header->size_class == LARGE_CLASS) {
+
+		region_lock(region);
+		count_free(region, HEADER_SIZE + header->size, true);
+		region_unlock(region);
+		free(header);
+		return;
+	}
+
+	uint32_t size_class = header->size_class;
+	region_lock(region);
+	*(void **)ptr = region->free_lists[size_class];
+	region->free_lists[size_class] = header;
+	count_free(region, HEADER_SIZE + class_payload(size_class), false);
+	region->stats.free_list_bytes += HEADER_SIZE + class_payload(size_class);
+	region_unlock(region);
+}
+
+void *mem_region_realloc(void *ptr, size_t size)
+{
+	if (!ptr) return mem_region_alloc_current(size);
+
+	block_header_t *header = header_of(ptr);
+
+	// Still fits its size class
+	if (header->size_class != LARGE_CLASS && size > 0 && size <= class_payload(header->size_class)) {
+
+		header->size = (uint32_t)size;
+		return ptr;
+	}
+
+	void *moved = mem_region_alloc(header->region, size);
+	if (!moved) return NULL;
+
+	memcpy(moved, ptr, header->size < size ? header->size : size);
+	mem_region_free(ptr);
+	return moved;
+}
+
+mem_region_t *mem_region_create(const char *name)
+{
+	mem_region_t *region = calloc(1, sizeof(mem_region_t));
+	if (!region) return NULL;
+
+	region->name = name;
+
+	pthread_mutex_lock(&registry_lock);
+	region->next = registry;
+	registry = region;
+	pthread_mutex_unlock(&registry_lock);
+	return region;
+}
+
+bool mem_region_destroy(mem_region_t *region)
+{
+	if (!region || region == &global_region) return false;
+
+	region_lock(region);
+	uint32_t live_blocks = region->stats.live_blocks;
+	region_unlock(region);
+	if (live_blocks) return false;
+
+	pthread_mutex_lock(&registry_lock);
+	for (mem_region_t **it = &registry; *it; it = &(*it)->next) {
+
+		if (*it != region) continue;
+
+		*it = region->next;
+		break;
+	}
+	pthread_mutex_unlock(&registry_lock);
+
+	while (region->chunks) {
+
+		chunk_t *next = region->chunks->next;
+		free(region->chunks);
+		region->chunks = next;
+	}
+	free(region);
+	return true;
+}
+
+const char *mem_region_name(const mem_region_t *region)
+{
+	return region ? region->name : global_region.name;
+}
+
+bool mem_region_reset(mem_region_t *region)
+{
+	if (!region || region == &global_region) return false;
+
+	region_lock(region);
+	if (region->stats.live_blocks) {
+
+		region_unlock(region);
+		return false;
+	}
+
+	// Keep the oldest chunk for the next visit
+	chunk_t *oldest = NULL;
+	while (region->chunks) {
+
+		chunk_t *next = region->chunks->next;
+		if (!next) {
+
+			oldest = region->chunks;
+			break;
+		}
+		free(region->chunks);
+		region->stats.chunk_bytes -= MEM_REGION_CHUNK_SIZE;
+		region->chunks = next;
+	}
+	region->chunks = oldest;
+	region->bump = oldest ? (uint8_t *)oldest + CHUNK_HEADER_SIZE : NULL;
+	region->bump_end = oldest ? (uint8_t *)oldest + MEM_REGION_CHUNK_SIZE : NULL;
+	memset(region->free_lists, 0, sizeof(region->free_lists));
+	region->stats.free_list_bytes = 0;
+	region->stats.resets++;
+
+	region_unlock(region);
+	return true;
+}
+
+void mem_region_push(mem_region_t *region)
+{
+	// Deeper scopes fall through to the innermost one that fits
+	if (scope_depth < MEM_REGION_DEPTH) scope_stack[scope_depth] = region;
+	scope_depth++;
+}
+
+void mem_region_pop(void)
+{
+	if (scope_depth > 0) scope_depth--;
+}
+
+mem_region_t *mem_region_current(void)
+{
+	if (scope_depth == 0) return NULL;
+	return scope_stack[(scope_depth <= MEM_REGION_DEPTH ? scope_depth : MEM_REGION_DEPTH) - 1];
+}
+
+void *mem_region_alloc_current(size_t size)
+{
+	return mem_region_alloc(mem_region_current(), size);
+}
+
+// Region locked: the rest of the newest chunk, or the largest size class with a free block
+static size_t biggest_free(const mem_region_t *region)
+{
+	size_t bump = (size_t)(region->bump_end - region->bump);
+	size_t biggest = bump > HEADER_SIZE ? bump - HEADER_SIZE : 0;
+	if (biggest > MEM_REGION_SMALL_MAX) biggest = MEM_REGION_SMALL_MAX;
+
+	for (uint32_t size_class = SIZE_CLASSES; size_class-- > 0;) {
+
+		if (class_payload(size_class) <= biggest) break;
+		if (region->free_lists[size_class]) return class_payload(size_class);
+	}
+	return biggest;
+}
+
+void mem_region_get_stats(mem_region_t *region, mem_region_stats_t *stats)
+{
+	if (!region) region = &global_region;
+
+	region_lock(region);
+	*stats = region->stats;
+	stats->biggest_free = biggest_free(region);
+	region_unlock(region);
+}
+
+void mem_region_get_total_stats(mem_region_stats_t *stats)
+{
+	mem_region_get_stats(NULL, stats);
+
+	pthread_mutex_lock(&registry_lock);
+	for (mem_region_t *region = registry; region; region = region->next) {
+
+		mem_region_stats_t one;
+		mem_region_get_stats(region, &one);
+		stats->chunk_bytes += one.chunk_bytes;
+		stats->used_bytes += one.used_bytes;
+		stats->max_used_bytes += one.max_used_bytes;
+		stats->large_bytes += one.large_bytes;
+		stats->free_list_bytes += one.free_list_bytes;
+		if (one.biggest_free > stats->biggest_free) stats->biggest_free = one.biggest_free;
+		stats->live_blocks += one.live_blocks;
+		stats->resets += one.resets;
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
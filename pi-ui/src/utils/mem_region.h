@@ -0,0 +1,78 @@
+#ifndef MEM_REGION_H
+#define MEM_REGION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Region allocator behind lv_malloc (lvgl_port_mem.c) and the screens' module buffers.
+//
+// A region hands out small blocks from 64 KB chunks: a bump pointer for new blocks and
+// one free list per 16-byte size class for freed ones, so a free is a push and nothing
+// ever coalesces or splits. Blocks above MEM_REGION_SMALL_MAX come from the system heap
+// on their own. Every block records its region, so it can be freed at any time.
+//
+// Each screen owns a region and pushes it while it builds (ui_build jobs carry it to
+// their later steps); the LVGL thread's allocations then land in it. Only the global
+// region takes a lock: the draw threads allocate and free there, while a created
+// region must only be used from one thread at a time (the LVGL thread, under the LVGL
+// lock), blocks included. Once everything
+// the screen allocated is freed, mem_region_reset() returns all chunks but the first and
+// rewinds it in one step, so a screen's churn never fragments what outlives it or the
+// next screen. A region with live blocks is not reset: something created on the screen
+// outlived it. Everything outside a scope goes to the global region, never reset.
+
+#define MEM_REGION_CHUNK_SIZE (64 * 1024)
+#define MEM_REGION_SMALL_MAX 1024
+
+typedef struct mem_region mem_region_t;
+
+typedef struct {
+	size_t chunk_bytes;         // Held in chunks
+	size_t used_bytes;          // Live blocks, headers included
+	size_t max_used_bytes;
+	size_t large_bytes;         // Live blocks above MEM_REGION_SMALL_MAX
+	size_t free_list_bytes;     // Freed small blocks waiting for reuse, headers included
+	size_t biggest_free;        // Largest small request served without a new chunk
+	uint32_t live_blocks;
+	uint32_t resets;
+} mem_region_stats_t;
+
+mem_region_t *mem_region_create(const char *name);
+// Only an empty region; false (and nothing freed) otherwise
+bool mem_region_destroy(mem_region_t *region);
+const char *mem_region_name(const mem_region_t *region);
+
+// NULL region = global
+void *mem_region_alloc(mem_region_t *region, size_t size);
+// Stays in ptr's region; NULL ptr allocates from the current one
+void *mem_region_realloc(void *ptr, size_t size);
+void mem_region_free(void *ptr);
+
+// Allocations of the calling thread go to the innermost pushed region; pushing NULL
+// selects the global region (for objects that outlive the scope). Nests MEM_REGION_DEPTH deep.
+#define MEM_REGION_DEPTH 8
+void mem_region_push(mem_region_t *region);
+void mem_region_pop(void);
+mem_region_t *mem_region_current(void);
+
+// Module buffers that live as long as the screen being built
+void *mem_region_alloc_current(size_t size);
+
+// Drops everything at once if no block is live; true if it did
+bool mem_region_reset(mem_region_t *region);
+
+// NULL region = global
+void mem_region_get_stats(mem_region_t *region, mem_region_stats_t *stats);
+// Global and every region together; biggest_free is the largest of any region
+void mem_region_get_total_stats(mem_region_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MEM_REGION_H
@@ -0,0 +1,114 @@
+#include "startup_profile.h"
+#include "log.h"
+
+#include <time.h>
+
+static const char *TAG = "startup";
+
+static uint64_t base_us = 0;
+static uint64_t first_frame_us = 0;
+static uint64_t first_live_value_us = 0;
+static bool live_data_pending = false;
+
+static uint64_t monotonic_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+void startup_profile_init(void)
+{
+	base_us = monotonic_us();
+	first_frame_us = 0;
+	first_live_value_us = 0;
+	live_data_pending = false;
+}
+
+uint64_t startup_profile_now_us(void)
+{
+	return monotonic_us() - base_us;
+}
+
+startup_phase_t startup_phase_begin(const char *name)
+{
+	startup_phase_t phase = { name, startup_profile_now_us() };
+	return phase;
+}
+
+void startup_phase_end(startup_phase_t phase)
+{
+	uint64_t now = startup_profile_now_us();
+	LOG_I(TAG, "%-16s %7.1f ms  (done at %7.1f ms)", phase.name, (now - phase.start_us) / 1000.0, now / 1000.0);
+}
+
+/* ===== Background tasks ===== */
+
+static void task_run(startup_task_t *task)
+{
+	task->start_us = startup_profile_now_us();
+	task->fn();
+	task->end_us = startup_profile_now_us();
+	LOG_I(TAG, "%-16s %7.1f ms  (done at %7.1f ms, %s)", task->name,
+		(task->end_us - task->start_us) / 1000.0, task->end_us / 1000.0, task->threaded ? "worker" : "inline");
+	atomic_store_explicit(&task->done, true, memory_order_release);
+}
+
+static void *task_main(void *arg)
+{
+	task_run(arg);
+	return NULL;
+}
+
+void startup_task_start(startup_task_t *task)
+{
+	atomic_store(&task->done, false);
+	task->threaded = pthread_create(&task->thread, NULL, task_main, task) == 0;
+	if (task->threaded) {
+
+		pthread_detach(task->thread);
+	} else {
+
+		LOG_W(TAG, "Cannot start a thread for %s, running it inline", task->name);
+		task_run(task);
+	}
+}
+
+bool startup_task_done(startup_task_t *task)
+{
+	return atomic_load_explicit(&task->done, memory_order_acquire);
+}
+
+/* ===== Milestones ===== */
+
+void startup_profile_frame_rendered(void)
+{
+	if (first_live_value_us) return;
+
+	uint64_t now = startup_profile_now_us();
+	if (!first_frame_us) {
+
+		first_frame_us = now;
+		LOG_I(TAG, "First frame at %.1f ms", now / 1000.0);
+	}
+	if (live_data_pending) {
+
+		first_live_value_us = now;
+		LOG_I(TAG, "First live value on screen at %.1f ms", now / 1000.0);
+	}
+}
+
+void startup_profile_live_data(void)
+{
+	live_data_pending = true;
+}
+
+uint64_t startup_profile_first_frame_us(void)
+{
+	return first_frame_us;
+}
+
+uint64_t startup_profile_first_live_value_us(void)
+{
+	return first_live_value_us;
+}
@@ -0,0 +1,59 @@
+#ifndef STARTUP_PROFILE_H
+#define STARTUP_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Boot timeline, logged under the "startup" tag: how long each init phase and
+// background task took, when the first frame was drawn and when the first live value
+// reached the screen. Times are real (CLOCK_MONOTONIC, also on the virtual clock) and
+// counted from startup_profile_init().
+
+void startup_profile_init(void);
+uint64_t startup_profile_now_us(void);
+
+// Main-thread phases
+typedef struct {
+	const char *name;
+	uint64_t start_us;
+} startup_phase_t;
+
+startup_phase_t startup_phase_begin(const char *name);
+void startup_phase_end(startup_phase_t phase);
+
+// Init work with no LVGL calls that can run next to the rest of the boot.
+// weight is the task's share of the boot progress bar.
+typedef struct {
+	const char *name;
+	void (*fn)(void);
+	int weight;
+	pthread_t thread;
+	bool threaded;
+	atomic_bool done;
+	uint64_t start_us;
+	uint64_t end_us;
+} startup_task_t;
+
+#define STARTUP_TASK(task_name, task_fn, task_weight) { .name = (task_name), .fn = (task_fn), .weight = (task_weight) }
+
+// Runs fn on a worker thread (inline if no thread can be started)
+void startup_task_start(startup_task_t *task);
+bool startup_task_done(startup_task_t *task);
+
+// Milestones, from the LVGL thread
+void startup_profile_frame_rendered(void);  // A refresh drew something
+void startup_profile_live_data(void);       // The UI took in a produced sample: the next frame shows it
+uint64_t startup_profile_first_frame_us(void);        // 0 until reached
+uint64_t startup_profile_first_live_value_us(void);   // 0 until reached
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STARTUP_PROFILE_H
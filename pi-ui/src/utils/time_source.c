@@ -0,0 +1,55 @@
+#include "time_source.h"
+#include "log.h"
+#include <stdio.h>
+#include <stdatomic.h>
+
+static const char *TAG = "time_source";
+
+static atomic_bool virtual_mode = false;
+
+// Virtual monotonic time; starts at 1 s so "0 = never" timestamps stay meaningful
+static atomic_uint_fast64_t virtual_us = 1000000;
+static time_t virtual_start_wall = TIME_SOURCE_VIRTUAL_EPOCH;
+
+void time_source_set_virtual(time_t start_wall)
+{
+	virtual_start_wall = start_wall;
+	atomic_store(&virtual_mode, true);
+	LOG_I(TAG, "Virtual clock from %lld", (long long)start_wall);
+}
+
+bool time_source_is_virtual(void)
+{
+	return atomic_load(&virtual_mode);
+}
+
+void time_source_advance(uint32_t ms)
+{
+	if (!atomic_load(&virtual_mode)) return;
+
+	atomic_fetch_add(&virtual_us, (uint64_t)ms * 1000);
+}
+
+uint64_t time_source_us(void)
+{
+	if (atomic_load(&virtual_mode)) return atomic_load(&virtual_us);
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+uint32_t time_source_ms(void)
+{
+	return (uint32_t)(time_source_us() / 1000);
+}
+
+time_t time_source_wall(void)
+{
+	if (atomic_load(&virtual_mode)) {
+
+		return virtual_start_wall + (time_t)((atomic_load(&virtual_us) - 1000000) / 1000000);
+	}
+
+	return time(NULL);
+}
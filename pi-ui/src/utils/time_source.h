@@ -0,0 +1,41 @@
+#ifndef TIME_SOURCE_H
+#define TIME_SOURCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Single clock for the whole UI: LVGL ticks, LERP, gauge animation, history sampling,
+// alert flashing, mock data and timestamps all read it. Normally it follows
+// CLOCK_MONOTONIC / CLOCK_REALTIME; in virtual mode it only moves when
+// time_source_advance() is called, so hours of UI behaviour can be simulated in
+// seconds and replayed exactly.
+
+// Wall clock a virtual run starts at (2024-01-01 00:00:00 UTC)
+#define TIME_SOURCE_VIRTUAL_EPOCH 1704067200
+
+// Switch to the virtual clock (before anything reads the time)
+void time_source_set_virtual(time_t start_wall);
+bool time_source_is_virtual(void);
+
+// Move the virtual clock forward; ignored on the real clock
+void time_source_advance(uint32_t ms);
+
+// Monotonic milliseconds (wraps after ~49 days, compare with subtraction)
+uint32_t time_source_ms(void);
+
+// Monotonic microseconds
+uint64_t time_source_us(void);
+
+// Seconds since the epoch, replaces time(NULL)
+time_t time_source_wall(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIME_SOURCE_H
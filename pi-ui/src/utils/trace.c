@@ -0,0 +1,239 @@
+#include "trace.h"
+#include "log.h"
+
+#if defined(PI_UI_TRACE) && PI_UI_TRACE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <time.h>
+
+static const char *TAG = "trace";
+
+#define AUTO_DUMP_INTERVAL_NS 10000000000ull    // At most one over-budget dump per 10 s
+#define DUMP_SKIP_EVENTS 256                    // Oldest events the writer may be overwriting
+
+typedef enum {
+	TRACE_EVENT_BEGIN = 0,
+	TRACE_EVENT_END,
+	TRACE_EVENT_INSTANT,
+	TRACE_EVENT_COUNTER,
+} trace_event_type_t;
+
+typedef struct {
+	uint64_t ts_ns;
+	const char *name;
+	int64_t value;
+	uint32_t type;
+} trace_event_t;
+
+typedef struct trace_ring {
+	struct trace_ring *next;
+	atomic_uint_fast64_t head;                  // Events ever written; the owner is the only writer
+	int tid;
+	char thread_name[32];
+	trace_event_t events[TRACE_RING_EVENTS];
+} trace_ring_t;
+
+static _Atomic(trace_ring_t *) rings = NULL;
+static atomic_int next_tid = 0;
+static _Thread_local trace_ring_t *thread_ring = NULL;
+
+static uint64_t base_ns = 0;
+static char dump_dir[256] = ".";
+static uint32_t frame_budget_us = 0;
+static atomic_bool dump_requested = false;
+static int dump_count = 0;
+static uint64_t frame_start_ns = 0;
+static uint64_t last_auto_dump_ns = 0;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// First event on a thread: allocate its ring and push it on the list
+static trace_ring_t *ring_create(void)
+{
+	trace_ring_t *ring = calloc(1, sizeof(*ring));
+	if (!ring) return NULL;
+
+	ring->tid = atomic_fetch_add(&next_tid, 1) + 1;
+	snprintf(ring->thread_name, sizeof(ring->thread_name), "thread %d", ring->tid);
+
+	trace_ring_t *head = atomic_load(&rings);
+	do {
+		ring->next = head;
+	} while (!atomic_compare_exchange_weak(&rings, &head, ring));
+
+	thread_ring = ring;
+	return ring;
+}
+
+static void emit(trace_event_type_t type, const char *name, int64_t value)
+{
+	trace_ring_t *ring = thread_ring ? thread_ring : ring_create();
+	if (!ring) return;
+
+	uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	trace_event_t *event = &ring->events[head & (TRACE_RING_EVENTS - 1)];
+	event->ts_ns = now_ns();
+	event->name = name;
+	event->value = value;
+	event->type = type;
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+static void sigusr1_handler(int sig)
+{
+	(void)sig;
+	trace_request_dump();
+}
+
+void trace_init(void)
+{
+	base_ns = now_ns();
+	signal(SIGUSR1, sigusr1_handler);
+	LOG_I(TAG, "Tracing on, %d events per thread; SIGUSR1 or 'T' dumps", TRACE_RING_EVENTS);
+}
+
+void trace_set_thread_name(const char *name)
+{
+	trace_ring_t *ring = thread_ring ? thread_ring : ring_create();
+	if (!ring) return;
+
+	snprintf(ring->thread_name, sizeof(ring->thread_name), "%s", name);
+}
+
+void trace_set_dir(const char *dir)
+{
+	snprintf(dump_dir, sizeof(dump_dir), "%s", dir);
+}
+
+void trace_set_frame_budget_us(uint32_t us)
+{
+	frame_budget_us = us;
+}
+
+void trace_begin(const char *name)
+{
+	emit(TRACE_EVENT_BEGIN, name, 0);
+}
+
+void trace_end(void)
+{
+	emit(TRACE_EVENT_END, NULL, 0);
+}
+
+void trace_instant(const char *name)
+{
+	emit(TRACE_EVENT_INSTANT, name, 0);
+}
+
+void trace_counter(const char *name, int64_t value)
+{
+	emit(TRACE_EVENT_COUNTER, name, value);
+}
+
+void trace_request_dump(void)
+{
+	atomic_store(&dump_requested, true);
+}
+
+void trace_frame_begin(void)
+{
+	frame_start_ns = now_ns();
+	emit(TRACE_EVENT_BEGIN, "frame", 0);
+}
+
+void trace_frame_end(void)
+{
+	emit(TRACE_EVENT_END, NULL, 0);
+
+	uint64_t end_ns = now_ns();
+	if (atomic_exchange(&dump_requested, false)) {
+
+		trace_dump("requested");
+	} else if (frame_budget_us && end_ns - frame_start_ns > (uint64_t)frame_budget_us * 1000
+		&& (last_auto_dump_ns == 0 || end_ns - last_auto_dump_ns >= AUTO_DUMP_INTERVAL_NS)) {
+
+		last_auto_dump_ns = end_ns;
+		char reason[64];
+		snprintf(reason, sizeof(reason), "frame of %.1f ms", (end_ns - frame_start_ns) / 1e6);
+		trace_dump(reason);
+	}
+}
+
+static void write_event(FILE *file, const trace_ring_t *ring, const trace_event_t *event, bool *first)
+{
+	double ts_us = (double)(event->ts_ns - base_ns) / 1000.0;
+
+	fprintf(file, "%s\n", *first ? "" : ",");
+	*first = false;
+
+	switch (event->type) {
+		case TRACE_EVENT_BEGIN:
+			fprintf(file, "{\"ph\":\"B\",\"name\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", event->name, ts_us, ring->tid);
+			break;
+		case TRACE_EVENT_END:
+			fprintf(file, "{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", ts_us, ring->tid);
+			break;
+		case TRACE_EVENT_INSTANT:
+			fprintf(file, "{\"ph\":\"i\",\"s\":\"t\",\"name\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", event->name, ts_us, ring->tid);
+			break;
+		default:
+			fprintf(file, "{\"ph\":\"C\",\"name\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%d,\"args\":{\"value\":%lld}}",
+				event->name, ts_us, ring->tid, (long long)event->value);
+			break;
+	}
+}
+
+// Other threads keep writing while this runs: their oldest DUMP_SKIP_EVENTS are left out
+// since they may be overwritten mid-read
+bool trace_dump(const char *reason)
+{
+	char path[320];
+	snprintf(path, sizeof(path), "%s/pi_ui_trace_%d.json", dump_dir, ++dump_count);
+
+	FILE *file = fopen(path, "w");
+	if (!file) {
+
+		LOG_E(TAG, "Cannot write %s", path);
+		return false;
+	}
+
+	uint64_t start_ns = now_ns();
+	size_t written = 0;
+	bool first = true;
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"reason\":\"%s\"},\"traceEvents\":[", reason);
+
+	for (trace_ring_t *ring = atomic_load(&rings); ring; ring = ring->next) {
+
+		fprintf(file, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+			first ? "" : ",", ring->tid, ring->thread_name);
+		first = false;
+
+		uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+		uint64_t tail = 0;
+		if (head > TRACE_RING_EVENTS) {
+			tail = head - TRACE_RING_EVENTS + (ring == thread_ring ? 0 : DUMP_SKIP_EVENTS);
+		}
+
+		for (uint64_t i = tail; i < head; i++) {
+
+			write_event(file, ring, &ring->events[i & (TRACE_RING_EVENTS - 1)], &first);
+			written++;
+		}
+	}
+
+	fprintf(file, "\n]}\n");
+	bool ok = fclose(file) == 0;
+	LOG_I(TAG, "%s: %zu events to %s in %.1f ms", reason, written, path, (now_ns() - start_ns) / 1e6);
+	return ok;
+}
+
+#endif // PI_UI_TRACE
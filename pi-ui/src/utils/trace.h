@@ -0,0 +1,80 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Event tracing in Chrome trace format (chrome://tracing, ui.perfetto.dev).
+//
+// Every thread writes begin/end, instant and counter events into its own ring
+// (single writer, no locks); the rings keep the last TRACE_RING_EVENTS events
+// per thread. A dump writes them all as one JSON file: on SIGUSR1, on the 'T'
+// key, or on its own when a frame runs over the configured budget.
+//
+// Built only with -DPI_UI_TRACE=1 (cmake -DPI_UI_TRACE=ON); otherwise every macro
+// and call below compiles to nothing. Event names must be string literals.
+
+#if defined(PI_UI_TRACE) && PI_UI_TRACE
+
+#define TRACE_RING_EVENTS 16384                 // Per thread, power of two
+
+void trace_init(void);
+void trace_set_thread_name(const char *name);
+void trace_set_dir(const char *dir);            // Where dumps go (default: working directory)
+void trace_set_frame_budget_us(uint32_t us);    // Auto-dump above this; 0 = never
+
+void trace_begin(const char *name);
+void trace_end(void);
+void trace_instant(const char *name);
+void trace_counter(const char *name, int64_t value);
+
+// Main loop: frame boundaries; the end also performs requested and over-budget dumps
+void trace_frame_begin(void);
+void trace_frame_end(void);
+
+void trace_request_dump(void);                  // Async-signal-safe; dumped at the next frame end
+bool trace_dump(const char *reason);
+
+typedef struct { int unused; } trace_scope_t;
+static inline trace_scope_t trace_scope_begin(const char *name) { trace_begin(name); return (trace_scope_t){ 0 }; }
+static inline void trace_scope_end(trace_scope_t *scope) { (void)scope; trace_end(); }
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#define TRACE_BEGIN(name)           trace_begin(name)
+#define TRACE_END()                 trace_end()
+#define TRACE_INSTANT(name)         trace_instant(name)
+#define TRACE_COUNTER(name, value)  trace_counter(name, (int64_t)(value))
+// Until the end of the enclosing block
+#define TRACE_SCOPE(name) \
+	trace_scope_t TRACE_CONCAT(trace_scope_, __LINE__) __attribute__((cleanup(trace_scope_end), unused)) = trace_scope_begin(name)
+
+#else
+
+static inline void trace_init(void) {}
+static inline void trace_set_thread_name(const char *name) { (void)name; }
+static inline void trace_set_dir(const char *dir) { (void)dir; }
+static inline void trace_set_frame_budget_us(uint32_t us) { (void)us; }
+static inline void trace_frame_begin(void) {}
+static inline void trace_frame_end(void) {}
+static inline void trace_request_dump(void) {}
+static inline bool trace_dump(const char *reason) { (void)reason; return false; }
+
+#define TRACE_BEGIN(name)           ((void)0)
+#define TRACE_END()                 ((void)0)
+#define TRACE_INSTANT(name)         ((void)0)
+#define TRACE_COUNTER(name, value)  ((void)0)
+#define TRACE_SCOPE(name)           ((void)0)
+
+#endif // PI_UI_TRACE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,153 @@
+#include "ui_build.h"
+#include "log.h"
+#include "mem_region.h"
+#include "time_source.h"
+#include "trace.h"
+
+#include <lvgl.h>
+
+static const char *TAG = "ui_build";
+
+static ui_build_job_t *jobs_head = NULL;   // FIFO: one job at a time, in start order
+static ui_build_job_t *jobs_tail = NULL;
+static lv_timer_t *build_timer = NULL;
+static uint32_t budget_us = UI_BUILD_DEFAULT_BUDGET_US;
+
+// No time passes inside a tick on the virtual clock: one step per tick there, so
+// headless runs slice a build the same way every time
+static bool budget_left(uint64_t start_us)
+{
+	if (time_source_is_virtual()) return false;
+	return time_source_us() - start_us < budget_us;
+}
+
+static void unlink_job(ui_build_job_t *job)
+{
+	ui_build_job_t *prev = NULL;
+	for (ui_build_job_t *it = jobs_head; it; prev = it, it = it->next) {
+
+		if (it != job) continue;
+
+		if (prev) prev->next = job->next;
+		else jobs_head = job->next;
+		if (jobs_tail == job) jobs_tail = prev;
+		break;
+	}
+	job->next = NULL;
+	job->active = false;
+
+	if (!jobs_head && build_timer) lv_timer_pause(build_timer);
+}
+
+static void finish_job(ui_build_job_t *job)
+{
+	unlink_job(job);
+	LOG_D(TAG, "%s: %d steps over %u ticks, %.1f ms busy, %.1f ms to complete", job->name, job->step,
+		(unsigned)job->ticks, job->busy_us / 1000.0, (time_source_us() - job->start_us) / 1000.0);
+	if (job->on_done) job->on_done(job->ctx);
+}
+
+// One step; true once the job is finished (the job may be gone then)
+static bool run_step(ui_build_job_t *job)
+{
+	uint64_t start = time_source_us();
+	bool done = false;
+
+	// Later steps allocate where the owner's create() did
+	mem_region_push(job->region);
+	TRACE_BEGIN(job->name);
+	ui_build_status_t status = job->step_fn(job->ctx, job->step);
+	TRACE_END();
+	job->step++;
+	job->busy_us += time_source_us() - start;
+	if (status == UI_BUILD_DONE) {
+
+		finish_job(job);
+		done = true;
+	}
+	mem_region_pop();
+	return done;
+}
+
+static void build_timer_cb(lv_timer_t *timer)
+{
+	uint64_t start = time_source_us();
+	ui_build_job_t *ticked = NULL;
+
+	// At least one step per tick, so a slow step can't stall its job
+	do {
+		ui_build_job_t *job = jobs_head;
+		if (!job) break;
+
+		if (job != ticked) {
+
+			job->ticks++;
+			ticked = job;
+		}
+		run_step(job);
+	} while (budget_left(start));
+}
+
+void ui_build_start(ui_build_job_t *job, const char *name, ui_build_step_t step_fn, void *ctx, void (*on_done)(void *ctx))
+{
+	if (job->active) ui_build_cancel(job);
+
+	job->name = name;
+	job->step_fn = step_fn;
+	job->on_done = on_done;
+	job->ctx = ctx;
+	job->step = 0;
+	job->active = true;
+	job->ticks = 0;
+	job->start_us = time_source_us();
+	job->busy_us = 0;
+	job->region = mem_region_current();
+	job->next = NULL;
+
+	if (jobs_tail) jobs_tail->next = job;
+	else jobs_head = job;
+	jobs_tail = job;
+
+	if (!build_timer) {
+
+		// Outlives the screen that started the first job
+		mem_region_push(NULL);
+		build_timer = lv_timer_create(build_timer_cb, 0, NULL);
+		mem_region_pop();
+	} else {
+
+		lv_timer_resume(build_timer);
+	}
+}
+
+void ui_build_cancel(ui_build_job_t *job)
+{
+	if (!job || !job->active) return;
+
+	LOG_D(TAG, "%s: cancelled after %d steps", job->name, job->step);
+	unlink_job(job);
+}
+
+void ui_build_complete(ui_build_job_t *job)
+{
+	if (!job || !job->active) return;
+
+	LOG_D(TAG, "%s: completing synchronously from step %d", job->name, job->step);
+	while (job->active && !run_step(job)) {
+	}
+}
+
+bool ui_build_is_active(const ui_build_job_t *job)
+{
+	return job && job->active;
+}
+
+bool ui_build_pending(void)
+{
+	return jobs_head != NULL;
+}
+
+void ui_build_set_budget_us(uint32_t us)
+{
+	budget_us = us;
+}
@@ -0,0 +1,57 @@
+#ifndef UI_BUILD_H
+#define UI_BUILD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Builds large widget trees a slice at a time instead of in one LVGL callback.
+// The owner creates a skeleton (containers and buttons) right away and starts a job;
+// the job's step function is then called with step 0, 1, 2... from an LVGL timer,
+// as many steps per tick as fit the per-frame budget (at least one, and exactly one
+// on the virtual clock), until it returns UI_BUILD_DONE. Each step must leave the
+// tree drawable and must not cancel its own job (on_done may free it). LVGL thread only.
+
+#define UI_BUILD_DEFAULT_BUDGET_US 4000
+
+typedef enum {
+	UI_BUILD_CONTINUE,
+	UI_BUILD_DONE,
+} ui_build_status_t;
+
+typedef ui_build_status_t (*ui_build_step_t)(void *ctx, int step);
+
+// Embedded in the owner; no allocation
+typedef struct ui_build_job {
+	const char *name;               // Static string: trace scope and log
+	ui_build_step_t step_fn;
+	void (*on_done)(void *ctx);     // Optional, after the last step
+	void *ctx;
+	int step;
+	bool active;
+	uint32_t ticks;
+	uint64_t start_us;
+	uint64_t busy_us;
+	struct mem_region *region;      // Current at start; pushed around every step
+	struct ui_build_job *next;
+} ui_build_job_t;
+
+void ui_build_start(ui_build_job_t *job, const char *name, ui_build_step_t step_fn, void *ctx, void (*on_done)(void *ctx));
+// Drops the remaining steps (owner being destroyed); on_done is not called
+void ui_build_cancel(ui_build_job_t *job);
+// Runs the remaining steps now, e.g. when the user acts on parts not built yet
+void ui_build_complete(ui_build_job_t *job);
+bool ui_build_is_active(const ui_build_job_t *job);
+// True while any job has steps left
+bool ui_build_pending(void);
+
+void ui_build_set_budget_us(uint32_t us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_BUILD_H